@@ -171,6 +171,7 @@ VCL_APIEXPORT vcl_result_t VCL_APICALL vclCompilerGetProperties(vcl_compiler_han
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Creates an executable object and returns the executable handle
 ///  Compiles modelIRData in the executable descriptor to blob and store it in the executable.
+///  The weights are read in place, modelIRData must stay valid and unchanged until the call returns.
 VCL_APIEXPORT vcl_result_t VCL_APICALL vclExecutableCreate(vcl_compiler_handle_t compiler, vcl_executable_desc_t desc,
                                                            vcl_executable_handle_t* executable);
 
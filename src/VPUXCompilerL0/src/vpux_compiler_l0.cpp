@@ -17,6 +17,7 @@
 
 #include <chrono>
 #include <istream>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <utility>
@@ -180,25 +181,19 @@ public:
 private:
     NetworkDescription::Ptr _networkDesc;
     bool enableProfiling;
-    std::vector<char> _blob;
+    // The blob stays owned by the network description, exportNetwork copies it straight to the caller's buffer.
+    // getCompiledNetwork() is never called, it would make an extra copy of the blob.
+    const void* _blob;
+    uint64_t _blobSize;
 };
 
 VPUXExecutableL0::VPUXExecutableL0(NetworkDescription::Ptr networkDesc, bool enableProfiling)
-        : _networkDesc(networkDesc), enableProfiling(enableProfiling) {
-    _blob.clear();
+        : _networkDesc(networkDesc), enableProfiling(enableProfiling), _blob(nullptr), _blobSize(0) {
 }
 
 vcl_result_t VPUXExecutableL0::serializeNetwork() {
-    StopWatch stopWatch;
-    if (enableProfiling)
-        stopWatch.start();
-
-    _blob = _networkDesc->getCompiledNetwork();
-
-    if (enableProfiling) {
-        stopWatch.stop();
-        std::cout << "getCompiledNetwork time: " << stopWatch.delta_ms() << "ms" << std::endl;
-    }
+    _blob = _networkDesc->getNetworkModel();
+    _blobSize = _blob != nullptr ? _networkDesc->getNetworkModelSize() : 0;
     return VCL_RESULT_SUCCESS;
 }
 
@@ -206,7 +201,7 @@ vcl_result_t VPUXExecutableL0::getNetworkSize(uint64_t* blobSize) {
     if (blobSize == nullptr) {
         return VCL_RESULT_ERROR_INVALID_ARGUMENT;
     }
-    *blobSize = _blob.size();
+    *blobSize = _blobSize;
     if (*blobSize == 0) {
         // The executable handle do not contain a legal network.
         return VCL_RESULT_ERROR_UNKNOWN;
@@ -216,7 +211,7 @@ vcl_result_t VPUXExecutableL0::getNetworkSize(uint64_t* blobSize) {
 }
 
 vcl_result_t VPUXExecutableL0::exportNetwork(uint8_t* blob, uint64_t blobSize) {
-    if (!blob || blobSize != _blob.size()) {
+    if (!blob || _blob == nullptr || blobSize != _blobSize) {
         return VCL_RESULT_ERROR_INVALID_ARGUMENT;
     }
 
@@ -224,7 +219,7 @@ vcl_result_t VPUXExecutableL0::exportNetwork(uint8_t* blob, uint64_t blobSize) {
     if (enableProfiling)
         stopWatch.start();
 
-    memcpy(blob, _blob.data(), blobSize);
+    memcpy(blob, _blob, blobSize);
 
     if (enableProfiling) {
         stopWatch.stop();
@@ -256,8 +251,11 @@ public:
 private:
     std::shared_ptr<OptionsDesc> _options;
     Compiler::Ptr _compiler = NULL;
+    // Created once per compiler handle, the plugins registry is not loaded again for every executable
+    InferenceEngine::Core _ieCore;
     vcl_compiler_properties_t _compilerProp;
     vcl_compiler_desc_t _compilerDesc;
+    // Serializes the network reading on the shared Core
     std::mutex _mlock;
 };
 
@@ -284,21 +282,26 @@ std::pair<VPUXExecutableL0*, vcl_result_t> VPUXCompilerL0::importNetwork(const u
     if (buffer == nullptr || weights == nullptr) {
         return std::pair<VPUXExecutableL0*, vcl_result_t>(nullptr, VCL_RESULT_ERROR_INVALID_ARGUMENT);
     }
+    // ReadNetwork takes the model as a string, so the XML is still copied. It is small next to the weights.
     std::string model(buffer, buffer + bufferSize);
     InferenceEngine::MemoryBlob::Ptr weightsBlob;
     if (weightsSize != 0) {
         InferenceEngine::TensorDesc tensorDesc(InferenceEngine::Precision::U8, {weightsSize},
                                                InferenceEngine::Layout::C);
-        weightsBlob = InferenceEngine::make_shared_blob<uint8_t>(tensorDesc);
-        weightsBlob->allocate();
-        memcpy(weightsBlob->rwmap().as<uint8_t*>(), weights, weightsSize);
+        // Wrap the caller's weights without copying them. The caller keeps the buffer valid for the whole
+        // vclExecutableCreate call and the network reader only reads the weights blob.
+        weightsBlob = InferenceEngine::make_shared_blob<uint8_t>(tensorDesc, const_cast<uint8_t*>(weights),
+                                                                 weightsSize);
     }
 
-    InferenceEngine::Core ieCore;
     StopWatch stopWatch;
     if (enableProfiling)
         stopWatch.start();
-    InferenceEngine::CNNNetwork cnnNet = ieCore.ReadNetwork(model, weightsBlob);
+    InferenceEngine::CNNNetwork cnnNet;
+    {
+        std::lock_guard<std::mutex> lock(_mlock);
+        cnnNet = _ieCore.ReadNetwork(model, weightsBlob);
+    }
     if (enableProfiling) {
         stopWatch.stop();
         std::cout << "ReadNetwork time: " << stopWatch.delta_ms() << "ms" << std::endl;
@@ -47,6 +47,9 @@ public:
     vcl_result_t run(const std::string& options);
 
     bool check() const;
+    bool checkModelIR() const {
+        return modelIR == modelIRRef;
+    }
     size_t getOutputSize() const {
         return outputs.size();
     }
@@ -59,6 +62,8 @@ public:
     }
 private:
     std::vector<uint8_t> modelIR;
+    // The compiler reads the weights in place, the caller's buffer must be left intact
+    std::vector<uint8_t> modelIRRef;
     size_t modelIRSize;
     int numCompilationThreads;
     int numGetBlobThreads;
@@ -146,6 +151,7 @@ vcl_result_t CompilerTestThread2::init(const char* netName, const char* weightNa
             return VCL_RESULT_ERROR_IO;
         }
     }
+    modelIRRef = modelIR;
     return VCL_RESULT_SUCCESS;
 }
 
@@ -214,14 +220,16 @@ vcl_result_t CompilerTestThread2::run(const std::string& options) {
     }
     std::vector<std::thread> getBlobThreads;
     std::vector<std::pair<uint8_t*, uint64_t>> blobs;
+    // The threads keep pointers to the sizes, they must not move
+    blobs.reserve(numGetBlobThreads);
     for (int i = 0; i < numGetBlobThreads; i++) {
         int idx = i % numCompilationThreads;
 
         vcl_executable_handle_t exe = *(exeHandles[idx].first);
         uint64_t blobSize = exeHandles[idx].second;
         uint8_t* blob = (uint8_t*)malloc(blobSize);
-        std::thread thread(vclExecutableGetSerializableBlob, exe, blob, &blobSize);
         blobs.push_back(std::make_pair(blob, blobSize));
+        std::thread thread(vclExecutableGetSerializableBlob, exe, blob, &blobs.back().second);
 
         getBlobThreads.push_back(move(thread));
     }
@@ -359,6 +367,7 @@ TEST_P(CompilerTestThread2, threadTest2) {
                                        << std::dec << std::endl;
     EXPECT_EQ(test.getOutputSize(), 18) << "Not get all outputs successfully!" << std::endl;
     EXPECT_EQ(test.check(), true);
+    EXPECT_EQ(test.checkModelIR(), true) << "The model IR was modified by the compilation!" << std::endl;
 }
 
 // You need to export POR_PATH manually. E.g. export POR_PATH=/path/to/om-vpu-models-por-ww46
@@ -107,19 +107,29 @@ ie::Blob::Ptr EmulatorExecutor::repackTensor(const ie::Blob::Ptr& tensor, const
 
     auto tensorBlob = ie::as<ie::MemoryBlob>(tensor);
 
-    if (actualPrecision != devicePrecision) {
+    const auto precisionChange = actualPrecision != devicePrecision;
+    const auto layoutChange = needsLayoutChange(actualLayout, deviceLayout);
+
+    if (precisionChange) {
         _logger.warning("Blob is inconsistent with network input/output. "
                         "Need to do convert precision from {0} to {1}.",
                         actualPrecision, devicePrecision);
-        tensorBlob = toPrecision(tensorBlob, devicePrecision, vpux::None);
     }
 
-    if (needsLayoutChange(actualLayout, deviceLayout)) {
+    if (layoutChange) {
         _logger.warning("Blob is inconsistent with network input/output. "
                         "Need to do convert layout from {0} to {1}.",
                         actualLayout, deviceLayout);
 
         tensorBlob = adjustDims(tensorBlob, targetDesc);
+    }
+
+    if (precisionChange && layoutChange) {
+        // Single pass over memory instead of the intermediate blob with the converted precision
+        tensorBlob = toPrecisionAndLayout(tensorBlob, devicePrecision, deviceLayout, vpux::None);
+    } else if (precisionChange) {
+        tensorBlob = toPrecision(tensorBlob, devicePrecision, vpux::None);
+    } else if (layoutChange) {
         tensorBlob = toLayout(tensorBlob, deviceLayout);
     }
 
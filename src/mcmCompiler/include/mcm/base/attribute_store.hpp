@@ -0,0 +1,125 @@
+//
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache 2.0
+//
+#ifndef MV_ATTRIBUTE_STORE_HPP_
+#define MV_ATTRIBUTE_STORE_HPP_
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+#include "include/mcm/base/attribute.hpp"
+
+namespace mv
+{
+
+    /**
+     * @brief Identifier of an attribute name, interned in a global table. The keys of the same name are equal,
+     * so the lookups compare integers instead of strings. The hot paths should keep the key in a static
+     * variable, e.g. static const AttrKey key("populated"), to intern the name only once.
+     */
+    class AttrKey
+    {
+
+        static constexpr uint32_t invalidId_ = UINT32_MAX;
+
+        uint32_t id_;
+
+    public:
+
+        /**
+         * @brief Invalid key, does not match any attribute.
+         */
+        AttrKey() : id_(invalidId_) {}
+
+        /**
+         * @brief Interns the name, thread safe.
+         */
+        explicit AttrKey(const std::string& name);
+        explicit AttrKey(const char* name);
+
+        /**
+         * @brief Returns the key of an already interned name, or an invalid key. Unlike the constructor
+         * it does not grow the table, so it is used for the lookups of arbitrary names.
+         */
+        static AttrKey find(const std::string& name);
+
+        uint32_t id() const { return id_; }
+        bool valid() const { return id_ != invalidId_; }
+        const std::string& name() const;
+
+        bool operator==(AttrKey other) const { return id_ == other.id_; }
+        bool operator!=(AttrKey other) const { return id_ != other.id_; }
+
+    };
+
+    /**
+     * @brief Flat attribute dictionary of an Element. Elements carry a few attributes, so a linear scan of
+     * the interned keys is faster than a tree of strings. The values are allocated separately to keep the
+     * references returned by find() valid when the attributes are added.
+     */
+    class AttributeStore
+    {
+
+        std::vector<AttrKey> keys_;
+        std::vector<std::unique_ptr<Attribute>> values_;
+
+        std::size_t indexOf_(AttrKey key) const;
+
+    public:
+
+        using SortedEntries = std::vector<std::pair<const std::string*, const Attribute*>>;
+
+        AttributeStore() = default;
+        AttributeStore(const AttributeStore& other);
+        AttributeStore(AttributeStore&& other) = default;
+        AttributeStore& operator=(const AttributeStore& other);
+        AttributeStore& operator=(AttributeStore&& other) = default;
+
+        Attribute* find(AttrKey key);
+        const Attribute* find(AttrKey key) const;
+
+        /**
+         * @brief Adds the attribute if the key is not present. Returns the attribute under the key and
+         * whether it was added, an existing attribute is not modified.
+         */
+        std::pair<Attribute*, bool> emplace(AttrKey key, Attribute attr);
+        bool erase(AttrKey key);
+        void clear();
+        std::size_t size() const { return keys_.size(); }
+
+        /**
+         * @brief Returns the entries sorted by name, the iteration order of the former std::map based store
+         * that the dumps and JSON outputs rely on.
+         */
+        SortedEntries sorted() const;
+        std::map<std::string, Attribute> toMap() const;
+
+    };
+
+    inline std::size_t AttributeStore::indexOf_(AttrKey key) const
+    {
+        for (std::size_t i = 0; i < keys_.size(); ++i)
+            if (keys_[i] == key)
+                return i;
+        return keys_.size();
+    }
+
+    inline Attribute* AttributeStore::find(AttrKey key)
+    {
+        const auto idx = indexOf_(key);
+        return idx < keys_.size() ? values_[idx].get() : nullptr;
+    }
+
+    inline const Attribute* AttributeStore::find(AttrKey key) const
+    {
+        const auto idx = indexOf_(key);
+        return idx < keys_.size() ? values_[idx].get() : nullptr;
+    }
+
+}
+
+#endif // MV_ATTRIBUTE_STORE_HPP_
@@ -9,6 +9,7 @@
 #include <string>
 #include <map>
 #include "include/mcm/base/attribute.hpp"
+#include "include/mcm/base/attribute_store.hpp"
 #include "include/mcm/base/attribute_registry.hpp"
 #include "include/mcm/base/exception/argument_error.hpp"
 #include "include/mcm/base/exception/runtime_error.hpp"
@@ -23,14 +24,14 @@ namespace mv
     class Element : public Printable, public Jsonable, public LogSender
     {
 
-        std::map<std::string, Attribute> attrs_;
+        AttributeStore attrs_;
 
     protected:
 
         std::string name_;
         virtual std::string attrsToString_() const;
         void forceErase_(const std::string& name);
-        const std::map<std::string, Attribute>& getAttrs_() const;
+        std::map<std::string, Attribute> getAttrs_() const;
 
     public:
 
@@ -57,6 +58,7 @@ namespace mv
         void setName(const std::string& name);
 
         bool hasAttr(const std::string &name) const;
+        bool hasAttr(AttrKey key) const;
         std::size_t attrsCount() const;
         std::vector<std::string> attrsKeys() const;
         void clear();
@@ -67,8 +69,11 @@ namespace mv
         virtual std::string getLogID() const override;
 
         Attribute& get(const std::string& name);
+        Attribute& get(AttrKey key);
         void set(const std::string& name, const Attribute& attr);
+        void set(AttrKey key, const Attribute& attr);
         void erase(const std::string& name);
+        void erase(AttrKey key);
 
 /*template <class AttrType>
         void set(const std::string& name, AttrType&& value)
@@ -88,52 +93,77 @@ namespace mv
         }*/
 
         template <class AttrType>
-        void set(const std::string& name, const AttrType& value, std::initializer_list<std::string> traits = {})
+        void set(AttrKey key, const AttrType& value, std::initializer_list<std::string> traits = {})
         {
             if (!attr::AttributeRegistry::checkType<AttrType>())
                 throw ArgumentError(*this, "type", typeid(AttrType).name(), "Unregistered"
-                    " type used for Attribute " + name + "initialization");
+                    " type used for Attribute " + key.name() + "initialization");
 
             Attribute newAttr = value;
             std::string errMsg;
             if (!attr::AttributeRegistry::checkValue<AttrType>(newAttr, errMsg))
                 throw ArgumentError(*this, "attribute value", attr::AttributeRegistry::getToStringFunc(typeid(AttrType))(value),
-                    "Invalid value used for initialization of Attribute " + name + " - " + errMsg);
+                    "Invalid value used for initialization of Attribute " + key.name() + " - " + errMsg);
 
-            if (!hasAttr(name))
+            auto attr = attrs_.find(key);
+            if (attr == nullptr)
             {
-                auto it = attrs_.emplace(std::piecewise_construct, std::forward_as_tuple(name), std::forward_as_tuple(value, traits));
-                if (!it.second)
-                    throw RuntimeError(*this, "Unable to emplace a new element in attributes dictionary");
+                attr = attrs_.emplace(key, Attribute(value, traits)).first;
 
-                log(Logger::MessageType::Debug, "Attribute '" + name + "' (" + it.first->second.getTypeName() +
-                    ") set to " + it.first->second.toString());
+                log(Logger::MessageType::Debug, "Attribute '" + key.name() + "' (" + attr->getTypeName() +
+                    ") set to " + attr->toString());
             }
             else
             {
-                if (attrs_[name].hasTrait("const"))
-                    throw AttributeError(*this, "Attempt of modification of a const attribute " + name);
-                attrs_[name] = value;
+                if (attr->hasTrait("const"))
+                    throw AttributeError(*this, "Attempt of modification of a const attribute " + key.name());
+                *attr = std::move(newAttr);
 
-                log(Logger::MessageType::Debug, "Attribute '" + name + "' (" + attrs_[name].getTypeName() +
-                    ") modified to " + attrs_[name].toString());
+                log(Logger::MessageType::Debug, "Attribute '" + key.name() + "' (" + attr->getTypeName() +
+                    ") modified to " + attr->toString());
             }
         }
 
+        template <class AttrType>
+        void set(const std::string& name, const AttrType& value, std::initializer_list<std::string> traits = {})
+        {
+            set<AttrType>(AttrKey(name), value, traits);
+        }
+
+        template <class AttrType>
+        const AttrType& get(AttrKey key) const
+        {
+            auto attr = attrs_.find(key);
+            if (attr == nullptr)
+                throw ArgumentError(*this, "attribute identifer", key.name(),  "Undefined identifier");
+            return attr->get<AttrType>();
+        }
+
+        template <class AttrType>
+        AttrType& get(AttrKey key)
+        {
+            auto attr = attrs_.find(key);
+            if (attr == nullptr)
+                throw ArgumentError(*this, "attribute identifer", key.name(),  "Undefined identifier");
+            return attr->get<AttrType>();
+        }
+
         template <class AttrType>
         const AttrType& get(const std::string &name) const
         {
-            if (!hasAttr(name))
+            auto attr = attrs_.find(AttrKey::find(name));
+            if (attr == nullptr)
                 throw ArgumentError(*this, "attribute identifer", name,  "Undefined identifier");
-            return attrs_.at(name).get<AttrType>();
+            return attr->get<AttrType>();
         }
 
         template <class AttrType>
         AttrType& get(const std::string &name)
         {
-            if (!hasAttr(name))
+            auto attr = attrs_.find(AttrKey::find(name));
+            if (attr == nullptr)
                 throw ArgumentError(*this, "attribute identifer", name,  "Undefined identifier");
-            return attrs_.at(name).get<AttrType>();
+            return attr->get<AttrType>();
         }
 
     };
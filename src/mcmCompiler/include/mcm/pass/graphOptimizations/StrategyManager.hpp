@@ -7,12 +7,14 @@
 
 #include "include/mcm/op_model.hpp"
 #include "include/mcm/base/exception/argument_error.hpp"
+#include "include/mcm/pass/graphOptimizations/strategy_encoding.hpp"
 #include "math.h"
 #include <unordered_set>
 #include "tuple"
 #include "limits"
 #include <atomic>
 #include <functional>
+#include <mutex>
 
 namespace mv {
 namespace graphOptimizer  {
@@ -134,6 +136,8 @@ public:
     {
     }
 
+    //the transition costs between the new level and the last one are evaluated in parallel, so the cost
+    //function has to be thread safe. Every worker passes it its own copies of the strategy sets
     void addNewLevel(Op& op,shared_ptr<vector<StrategySet>> newLevel,function<double(Op&,Op&,StrategySet&,StrategySet&)> cost);
     void solve();
     void fuseMeta(shared_ptr<MetaGraph> childGraph);
@@ -167,6 +171,25 @@ public:
     using RemovedFlow = tuple<Data::OpListIterator, std::size_t, Data::OpListIterator, std::size_t>;
     std::vector<RemovedFlow> removedFlows_;
 
+    //transition costs of the (op signature, strategy pair) already evaluated, shared by the isomorphic
+    //sections of the graph. The signatures are interned by op name.
+    struct TransitionKey
+    {
+        unsigned parentOp;
+        unsigned childOp;
+        StrategyEncoding parent;
+        StrategyEncoding child;
+        bool operator==(const TransitionKey& other) const;
+    };
+    struct TransitionKeyHash { size_t operator()(const TransitionKey& key) const; };
+
+    static constexpr unsigned noSignature_ = numeric_limits<unsigned>::max();
+
+    std::mutex transitionCacheMutex_;
+    unordered_map<string, unsigned> opSignatureIds_;
+    unordered_map<string, unsigned> signatureIds_;
+    unordered_map<TransitionKey, double, TransitionKeyHash> transitionCostCache_;
+
     string dotFileLocation;
     bool createStrategyDots=false;
     string jsonOutFileName;
@@ -220,10 +243,18 @@ public:
     std::shared_ptr<MetaGraph> recursiveGraphSolver(mv::Data::OpListIterator opBegin, mv::Data::OpListIterator opEnd,std::vector<mv::Data::OpListIterator> childIdx);
     void graphParameterOptimizations();
 
+    //memoized transitionCost, thread safe as long as transitionCost is
+    double cachedTransitionCost(Op& parentOp,Op& childOp,StrategySet& parent,StrategySet& child);
+    unsigned getOpSignatureId(Op& op);
+
     //template methods to be overwritten
     virtual bool isPipeliningPossible(mv::Op& op, StrategySet& strategy, bool parentSpilling);
     virtual void generateStrategySetForLayer(mv::Op& op,std::vector<StrategySet>& strategyVec);
+    //called concurrently for the different strategy pairs, it must not modify the model or the manager
     virtual double transitionCost(Op& parentOp,Op& childOp,StrategySet& parent,StrategySet& child);
+    //identifies the op properties the transition cost depends on, the ops of equal signatures share the
+    //memoized costs. An empty signature disables the memoization for the op
+    virtual string transitionSignature(Op& op);
     virtual ~StrategyManager() {};
 };
 
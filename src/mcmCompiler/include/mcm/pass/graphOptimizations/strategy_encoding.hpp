@@ -0,0 +1,89 @@
+//
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache 2.0
+//
+#ifndef STRATEGY_ENCODING_HPP
+#define STRATEGY_ENCODING_HPP
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include "include/mcm/base/attribute.hpp"
+
+namespace mv {
+namespace graphOptimizer {
+
+/**
+ * @brief Compact form of a layer strategy. Holds the fields of a StrategySet that define the strategy
+ * ("clustering", "spilling", "streaming", the sparsity flags and "eltwiseParentSpilling") and leaves out
+ * the ones that only identify it ("name", "id"), so the equal strategies of different layers compare
+ * and hash equal. encode() and decode() adapt it to the string map form the strategy managers work on.
+ */
+struct StrategyEncoding
+{
+    using StrategySet = std::unordered_map<std::string, Attribute>;
+
+    enum class Clustering : uint8_t
+    {
+        Clustering,
+        SplitOverH,
+        SplitOverHOverlapped,
+        SplitOverK,
+        HKSwitch
+    };
+
+    enum Flags : uint8_t
+    {
+        Spilling                 = 1 << 0,
+        InputSparsity            = 1 << 1,
+        OutputSparsity           = 1 << 2,
+        WeightsSparsity          = 1 << 3,
+        HasEltwiseParentSpilling = 1 << 4,
+        EltwiseParentSpilling    = 1 << 5
+    };
+
+    // Streaming splits over W, H, C, K, B
+    static constexpr std::size_t streamingDims = 5;
+
+    std::array<uint32_t, streamingDims> streaming;
+    Clustering clustering;
+    uint8_t flags;
+    bool valid;
+
+    StrategyEncoding() :
+        streaming(),
+        clustering(Clustering::Clustering),
+        flags(0),
+        valid(false)
+    {
+    }
+
+    /**
+     * @brief Encodes the strategy. The result is invalid if the map misses a field, or has a field or a value
+     * the encoding does not represent, so two strategies never compare equal because of a dropped field.
+     */
+    static StrategyEncoding encode(const StrategySet& strategy);
+
+    /**
+     * @brief Writes the encoded fields to the strategy map, the identifying fields are left as they are.
+     */
+    void decode(StrategySet& strategy) const;
+
+    bool hasFlag(Flags flag) const { return (flags & flag) != 0; }
+
+    bool operator==(const StrategyEncoding& other) const;
+    bool operator!=(const StrategyEncoding& other) const { return !(*this == other); }
+
+    static const std::string& clusteringName(Clustering clustering);
+};
+
+struct StrategyEncodingHash
+{
+    std::size_t operator()(const StrategyEncoding& encoding) const;
+};
+
+}
+}
+
+#endif // STRATEGY_ENCODING_HPP
@@ -20,6 +20,8 @@
 #include "include/mcm/utils/compression/hde.hpp"
 #include "include/mcm/pass/pass_utils.hpp"
 
+#include <unordered_set>
+
 
 namespace mv
 {
@@ -49,6 +51,7 @@ namespace mv
             static std::vector<unsigned> reduceQuantVector_(std::vector<unsigned> inVec);
 
             static bool targetEmulator_(mv::Element& compilationDescriptor);
+            static std::unique_ptr<MVCNN::BinaryDataT> buildBinaryDataT_(Compressor& codec, mv::Tensor& t, bool huffmanCompression, bool csramCacheable);
 
         public:
             static constexpr size_t default_weight_alignment = 256;
@@ -84,6 +87,8 @@ namespace mv
             static std::unique_ptr<MVCNN::VersionT> buildVersionT();
             static std::unique_ptr<MVCNN::ResourcesT> buildResourcesT(ComputationModel&, const mv::TargetDescriptor& td, Element& compilationDescriptor);
             std::unique_ptr<MVCNN::BinaryDataT> buildBinaryDataT(ComputationModel&, Element&, mv::Tensor& t, bool huffmanCompression, bool csramCacheable);
+            // Builds the binary data of the tensors concurrently, the result is in the order of the tensors
+            std::vector<std::unique_ptr<MVCNN::BinaryDataT>> buildBinaryDataT(ComputationModel&, Element&, const std::vector<mv::Tensor*>& tensors, bool huffmanCompression, const std::unordered_set<mv::Tensor*>& csramCacheable);
             static std::vector<std::unique_ptr<MVCNN::TaskListT>> buildTaskListT(ComputationModel& cm, Element& compilationDescriptor);
             static std::vector<std::unique_ptr<MVCNN::BarrierT>> buildBarrierTable(ComputationModel& cm, Element& compilationDescriptor);
             static std::unique_ptr<MVCNN::BarrierReferenceT> buildBarrierReferenceT(ComputationModel& cm, Element& compilationDescription, BarrierDependencies dep);
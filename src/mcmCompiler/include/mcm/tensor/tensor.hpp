@@ -14,6 +14,7 @@
 #include "include/mcm/tensor/shape.hpp"
 #include "include/mcm/tensor/order/order.hpp"
 #include "include/mcm/tensor/data_element.hpp"
+#include "include/mcm/tensor/tensor_storage.hpp"
 #include "include/mcm/tensor/dtype/dtype.hpp"
 #include "include/mcm/base/exception/argument_error.hpp"
 #include "include/mcm/base/exception/value_error.hpp"
@@ -96,10 +97,8 @@ namespace mv
         Shape shape_;
         Order internalOrder_;
 
-        std::vector<std::shared_ptr<std::vector<DataElement>>>  data_;
-
-        std::size_t blockSize_;
-        std::vector<std::vector<DataElement>::iterator> blocks_;
+        // Shared between the copies and the bound (slave) tensors
+        std::shared_ptr<TensorStorage> data_;
 
         std::shared_ptr<Tensor> sparsityMap_;
         std::shared_ptr<Tensor> storageElement_;
@@ -114,6 +113,8 @@ namespace mv
 
         std::vector<std::size_t> indToSub_(const Shape& s, size_t index) const;
         unsigned subToInd_(const Shape& s, const std::vector<std::size_t>& sub) const;
+        std::size_t storageIndex_(std::size_t idx) const;
+        void allocateStorage_(bool isDouble);
         void populateSparsityMapTensor_();
         void setSubtensorsOrder_(Order order);
 
@@ -197,14 +198,38 @@ namespace mv
         void divide(double val);
         void sqrt();
 
-        DataElement& at(const std::vector<std::size_t>& sub);
-        const DataElement& at(const std::vector<std::size_t>& sub) const;
-        DataElement& at(std::size_t idx);
-        const DataElement& at(std::size_t idx) const;
-        DataElement& operator()(std::size_t idx);
-        const DataElement& operator()(std::size_t idx) const;
-        DataElement& operator()(const std::vector<std::size_t>& sub);
-        const DataElement& operator()(const std::vector<std::size_t>& sub) const;
+        // DataElement based accessors are kept for compatibility, the values are converted
+        // from / to the compact storage on each access
+        DataElementRef at(const std::vector<std::size_t>& sub);
+        DataElement at(const std::vector<std::size_t>& sub) const;
+        DataElementRef at(std::size_t idx);
+        DataElement at(std::size_t idx) const;
+        DataElementRef operator()(std::size_t idx);
+        DataElement operator()(std::size_t idx) const;
+        DataElementRef operator()(const std::vector<std::size_t>& sub);
+        DataElement operator()(const std::vector<std::size_t>& sub) const;
+
+        /**
+         * @brief Populated data in the internal order of the tensor (see getInternalOrder()), without copying.
+         * The elements are stored in the narrowest type able to hold the values of the tensor DType.
+         */
+        TensorStorage& getStorage();
+        const TensorStorage& getStorage() const;
+
+        /**
+         * @brief Typed view of the populated data in the internal order, T must match the storage element type.
+         */
+        template <typename T>
+        TensorStorage::Span<const T> getDataSpan() const
+        {
+            return getStorage().getSpan<T>();
+        }
+
+        template <typename T>
+        TensorStorage::Span<T> getDataSpan()
+        {
+            return getStorage().getSpan<T>();
+        }
 
         // TODO: We shouldn't need this. A const ref accessor to `subTensors_` should be good enough.
         inline bool hasSubTensors() const
@@ -218,29 +243,37 @@ namespace mv
             return subTensors_.size();
         }
 
+        // The accessors below are called for every tensor in most passes, so they look the attributes up
+        // by the interned keys instead of the names
+
         inline bool isQuantized() const
         {
-            return hasAttr("quantParams");
+            static const AttrKey quantParamsKey("quantParams");
+            return hasAttr(quantParamsKey);
         }
 
         mv::QuantizationParams getQuantParams() const {
-            return get<mv::QuantizationParams>("quantParams");
+            static const AttrKey quantParamsKey("quantParams");
+            return get<mv::QuantizationParams>(quantParamsKey);
         }
 
         inline bool isPopulated() const
         {
-            return get<bool>("populated");
+            static const AttrKey populatedKey("populated");
+            return get<bool>(populatedKey);
         }
 
         inline bool isSparse() const
         {
-            return hasAttr("sparse") && get<bool>("sparse");
+            static const AttrKey sparseKey("sparse");
+            return hasAttr(sparseKey) && get<bool>(sparseKey);
         }
 
         inline bool isBroadcasted() const
         {
-            if (hasAttr("broadcasted"))
-                return get<bool>("broadcasted");
+            static const AttrKey broadcastedKey("broadcasted");
+            if (hasAttr(broadcastedKey))
+                return get<bool>(broadcastedKey);
             return true; //by default is true
         }
 
@@ -248,20 +281,27 @@ namespace mv
         {
             // SOK non-sparse weights are also serialised individually
             // so that they can be compressed by the HDE
-            return hasAttr("splitStrategy") &&
-                get<std::string>("splitStrategy") == "SplitOverK" &&
+            static const AttrKey splitStrategyKey("splitStrategy");
+            return hasAttr(splitStrategyKey) &&
+                get<std::string>(splitStrategyKey) == "SplitOverK" &&
                 isPopulatedTensor();
         }
 
         inline bool isPopulatedTensor()  const
         {
-            return !hasAttr("weightTable") &&
-                !hasAttr("sparsityMap") &&
-                !hasAttr("solvedSparsity") &&
-                !hasAttr("dilatedSubConvSM") &&
-                !hasAttr("dilatedSubConvSE") &&
-                !hasAttr("interpNNSM") &&
-                !hasAttr("interpNNSE");
+            static const AttrKey keys[] = {
+                AttrKey("weightTable"),
+                AttrKey("sparsityMap"),
+                AttrKey("solvedSparsity"),
+                AttrKey("dilatedSubConvSM"),
+                AttrKey("dilatedSubConvSE"),
+                AttrKey("interpNNSM"),
+                AttrKey("interpNNSE")
+            };
+            for (const auto& key : keys)
+                if (hasAttr(key))
+                    return false;
+            return true;
         }
 
         inline size_t size() const
@@ -285,7 +325,8 @@ namespace mv
         }
         inline std::size_t getAddress() const
         {
-            return get<std::size_t>("address");
+            static const AttrKey addressKey("address");
+            return get<std::size_t>(addressKey);
         }
 
         std::shared_ptr<Tensor> getSparsityMap() const;
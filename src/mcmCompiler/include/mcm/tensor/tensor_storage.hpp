@@ -0,0 +1,182 @@
+//
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache 2.0
+//
+#ifndef MV_TENSOR_STORAGE_HPP_
+#define MV_TENSOR_STORAGE_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "include/mcm/tensor/data_element.hpp"
+#include "include/mcm/tensor/dtype/dtype.hpp"
+#include "include/mcm/logger/log_sender.hpp"
+
+namespace mv
+{
+
+    /**
+     * @brief Populated data of a tensor, kept as raw bytes of the narrowest element type that can hold it.
+     * Like DataElement, the storage is either of double or of integer kind, the kind is fixed on creation
+     * and the written values are converted to it. The element type is chosen from the tensor DType
+     * (e.g. 1 byte for UInt8 weights instead of 16 bytes per DataElement). If a written value does not fit
+     * the current element type, the storage is widened to Int64 / Float64, so no value is ever lost.
+     */
+    class TensorStorage : public LogSender
+    {
+
+    public:
+
+        enum class ElementType
+        {
+            Int8,
+            UInt8,
+            Int16,
+            UInt16,
+            Int32,
+            Int64,
+            Float32,
+            Float64
+        };
+
+        /**
+         * @brief Contiguous typed view of the storage elements, in the internal order of the tensor.
+         */
+        template <typename T>
+        class Span
+        {
+            T* begin_;
+            T* end_;
+
+        public:
+            Span(T* begin, T* end) : begin_(begin), end_(end) {}
+
+            T* begin() const { return begin_; }
+            T* end() const { return end_; }
+            std::size_t size() const { return static_cast<std::size_t>(end_ - begin_); }
+            bool empty() const { return begin_ == end_; }
+            T& operator[](std::size_t idx) const { return begin_[idx]; }
+        };
+
+        /**
+         * @brief Returns the narrowest element type for the values of the given DType.
+         * FP16 and BF16 values stored as integers are their bit patterns.
+         */
+        static ElementType compactElementType(const DType& dType, bool isDouble);
+        static std::size_t elementSize(ElementType type);
+        static std::string toString(ElementType type);
+
+        TensorStorage(std::size_t size, bool isDouble, ElementType type);
+
+        std::size_t size() const { return size_; }
+        bool isDouble() const { return isDouble_; }
+        ElementType getElementType() const { return type_; }
+        std::size_t getSizeInBytes() const { return bytes_.size(); }
+
+        int64_t getInt(std::size_t idx) const;
+        double getDouble(std::size_t idx) const;
+        DataElement get(std::size_t idx) const;
+
+        void set(std::size_t idx, int64_t val);
+        void set(std::size_t idx, double val);
+        void set(std::size_t idx, const DataElement& val);
+
+        /**
+         * @brief Resizes the storage, the new elements are zero initialized.
+         */
+        void resize(std::size_t size);
+
+        /**
+         * @brief Converts the elements to the given type, that must be able to hold all of them.
+         */
+        void convert(ElementType type);
+
+        /**
+         * @brief Converts the elements to the given narrower type if all of them fit it, otherwise does nothing.
+         * Returns true if the storage was converted.
+         */
+        bool shrink(ElementType type);
+
+        template <typename T>
+        Span<T> getSpan();
+
+        template <typename T>
+        Span<const T> getSpan() const;
+
+        const uint8_t* data() const { return bytes_.data(); }
+        uint8_t* data() { return bytes_.data(); }
+
+        std::string getLogID() const override;
+
+    private:
+
+        template <typename T>
+        static ElementType elementTypeOf_();
+
+        void checkSpanType_(ElementType type) const;
+
+        bool isDouble_;
+        ElementType type_;
+        std::size_t size_;
+        std::vector<uint8_t> bytes_;
+
+    };
+
+    template <> inline TensorStorage::ElementType TensorStorage::elementTypeOf_<int8_t>() { return ElementType::Int8; }
+    template <> inline TensorStorage::ElementType TensorStorage::elementTypeOf_<uint8_t>() { return ElementType::UInt8; }
+    template <> inline TensorStorage::ElementType TensorStorage::elementTypeOf_<int16_t>() { return ElementType::Int16; }
+    template <> inline TensorStorage::ElementType TensorStorage::elementTypeOf_<uint16_t>() { return ElementType::UInt16; }
+    template <> inline TensorStorage::ElementType TensorStorage::elementTypeOf_<int32_t>() { return ElementType::Int32; }
+    template <> inline TensorStorage::ElementType TensorStorage::elementTypeOf_<int64_t>() { return ElementType::Int64; }
+    template <> inline TensorStorage::ElementType TensorStorage::elementTypeOf_<float>() { return ElementType::Float32; }
+    template <> inline TensorStorage::ElementType TensorStorage::elementTypeOf_<double>() { return ElementType::Float64; }
+
+    template <typename T>
+    TensorStorage::Span<T> TensorStorage::getSpan()
+    {
+        checkSpanType_(elementTypeOf_<T>());
+        auto begin = reinterpret_cast<T*>(bytes_.data());
+        return Span<T>(begin, begin + size_);
+    }
+
+    template <typename T>
+    TensorStorage::Span<const T> TensorStorage::getSpan() const
+    {
+        checkSpanType_(elementTypeOf_<T>());
+        auto begin = reinterpret_cast<const T*>(bytes_.data());
+        return Span<const T>(begin, begin + size_);
+    }
+
+    /**
+     * @brief Compatibility view of a single storage element for the code written against DataElement references.
+     * Holds a copy of the element value, the assignments are written through to the storage.
+     */
+    class DataElementRef : public DataElement
+    {
+        TensorStorage* storage_;
+        std::size_t idx_;
+
+        DataElementRef& store_();
+
+    public:
+        DataElementRef(TensorStorage& storage, std::size_t idx);
+        DataElementRef(const DataElementRef& other) = default;
+
+        DataElementRef& operator=(const DataElementRef& other);
+        DataElementRef& operator=(const DataElement& val);
+        DataElementRef& operator=(int64_t val);
+        DataElementRef& operator=(double val);
+        DataElementRef& operator+=(int64_t val);
+        DataElementRef& operator+=(double val);
+        DataElementRef& operator-=(int64_t val);
+        DataElementRef& operator-=(double val);
+        DataElementRef& operator*=(int64_t val);
+        DataElementRef& operator*=(double val);
+        DataElementRef& operator/=(int64_t val);
+        DataElementRef& operator/=(double val);
+    };
+
+}
+
+#endif // MV_TENSOR_STORAGE_HPP_
@@ -21,6 +21,9 @@ class Compressor
         virtual std::pair<std::vector<int64_t>, uint32_t> compress(std::vector<int64_t>& data, mv::Data::TensorIterator& t) = 0;
         virtual std::vector<uint8_t> decompress(std::vector<uint8_t>& compressedData) = 0;
 
+        // Codecs keep per call state, concurrent compressions need separate instances
+        virtual std::unique_ptr<Compressor> clone() const = 0;
+
         virtual ~Compressor() = default;
 };
 }
@@ -24,6 +24,15 @@ class Hde : public Compressor
         std::pair<std::vector<int64_t>, uint32_t> compress(std::vector<int64_t>& data, mv::Tensor& t);
         std::pair<std::vector<int64_t>, uint32_t> compress(std::vector<int64_t>& data, mv::Data::TensorIterator& t);
         std::vector<uint8_t> decompress(std::vector<uint8_t>& compressedData);
+        std::unique_ptr<Compressor> clone() const override;
+
+    private:
+        uint32_t bitPerSymbol_;
+        uint32_t maxNumberEncodedSymbols_;
+        uint32_t verbosity_;
+        uint32_t blockSize_;
+        bool pStatsOnly_;
+        uint32_t bypassMode_;
 };
 } 
 #endif 
\ No newline at end of file
@@ -0,0 +1,162 @@
+//
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache 2.0
+//
+#include "include/mcm/base/attribute_store.hpp"
+
+#include <algorithm>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+
+namespace {
+
+struct AttrKeyTable
+{
+    std::mutex mutex;
+    std::unordered_map<std::string, uint32_t> ids;
+    // std::deque keeps the references to the names valid on growth
+    std::deque<std::string> names;
+};
+
+AttrKeyTable& getAttrKeyTable()
+{
+    static AttrKeyTable table;
+    return table;
+}
+
+}  // namespace
+
+mv::AttrKey::AttrKey(const std::string& name)
+{
+    auto& table = getAttrKeyTable();
+    std::lock_guard<std::mutex> lock(table.mutex);
+
+    auto it = table.ids.find(name);
+    if (it == table.ids.end())
+    {
+        it = table.ids.emplace(name, static_cast<uint32_t>(table.names.size())).first;
+        table.names.push_back(name);
+    }
+    id_ = it->second;
+}
+
+mv::AttrKey::AttrKey(const char* name) :
+AttrKey(std::string(name))
+{
+}
+
+mv::AttrKey mv::AttrKey::find(const std::string& name)
+{
+    // The ids are never removed or reassigned, so every thread caches the names it has already found and
+    // the shared table is locked only on the first lookup of a name. Missing names are not cached,
+    // they might be interned later.
+    thread_local std::unordered_map<std::string, uint32_t> foundIds;
+
+    AttrKey key;
+    auto cached = foundIds.find(name);
+    if (cached != foundIds.end())
+    {
+        key.id_ = cached->second;
+        return key;
+    }
+
+    auto& table = getAttrKeyTable();
+    std::lock_guard<std::mutex> lock(table.mutex);
+
+    auto it = table.ids.find(name);
+    if (it != table.ids.end())
+    {
+        key.id_ = it->second;
+        foundIds.emplace(name, key.id_);
+    }
+    return key;
+}
+
+const std::string& mv::AttrKey::name() const
+{
+    static const std::string invalidName = "<invalid>";
+    if (!valid())
+        return invalidName;
+
+    // The names are kept in a std::deque and never move, so their addresses are cached per thread
+    thread_local std::vector<const std::string*> knownNames;
+    if (id_ < knownNames.size() && knownNames[id_] != nullptr)
+        return *knownNames[id_];
+
+    auto& table = getAttrKeyTable();
+    std::lock_guard<std::mutex> lock(table.mutex);
+
+    if (knownNames.size() <= id_)
+        knownNames.resize(id_ + 1, nullptr);
+    knownNames[id_] = &table.names[id_];
+    return *knownNames[id_];
+}
+
+mv::AttributeStore::AttributeStore(const AttributeStore& other) :
+keys_(other.keys_)
+{
+    values_.reserve(other.values_.size());
+    for (const auto& value : other.values_)
+        values_.emplace_back(new Attribute(*value));
+}
+
+mv::AttributeStore& mv::AttributeStore::operator=(const AttributeStore& other)
+{
+    if (this != &other)
+    {
+        AttributeStore copy(other);
+        *this = std::move(copy);
+    }
+    return *this;
+}
+
+std::pair<mv::Attribute*, bool> mv::AttributeStore::emplace(AttrKey key, Attribute attr)
+{
+    if (auto existing = find(key))
+        return {existing, false};
+
+    keys_.push_back(key);
+    values_.emplace_back(new Attribute(std::move(attr)));
+    return {values_.back().get(), true};
+}
+
+bool mv::AttributeStore::erase(AttrKey key)
+{
+    const auto idx = indexOf_(key);
+    if (idx == keys_.size())
+        return false;
+
+    keys_.erase(keys_.begin() + idx);
+    values_.erase(values_.begin() + idx);
+    return true;
+}
+
+void mv::AttributeStore::clear()
+{
+    keys_.clear();
+    values_.clear();
+}
+
+mv::AttributeStore::SortedEntries mv::AttributeStore::sorted() const
+{
+    SortedEntries entries;
+    entries.reserve(keys_.size());
+    for (std::size_t i = 0; i < keys_.size(); ++i)
+        entries.emplace_back(&keys_[i].name(), values_[i].get());
+
+    std::sort(entries.begin(), entries.end(),
+        [](const SortedEntries::value_type& lhs, const SortedEntries::value_type& rhs)
+        {
+            return *lhs.first < *rhs.first;
+        });
+    return entries;
+}
+
+std::map<std::string, mv::Attribute> mv::AttributeStore::toMap() const
+{
+    std::map<std::string, Attribute> result;
+    for (std::size_t i = 0; i < keys_.size(); ++i)
+        result.emplace(keys_[i].name(), *values_[i]);
+    return result;
+}
@@ -57,12 +57,12 @@ mv::Element::Element(const json::Value& content, bool simplifiedTyping, std::str
         auto keys = content["attrs"].getKeys();
         for (auto const &key : keys)
         {
-            auto it = attrs_.emplace(key, content[key]);
+            auto it = attrs_.emplace(AttrKey(key), Attribute(content[key]));
             if (!it.second)
                 throw RuntimeError(*this, "Unable to emplace a new element in attributes dictionary");
 
-            log(Logger::MessageType::Debug, "Attribute '" + key + "' (" + it.first->second.getTypeName() +
-                        ") set to " + it.first->second.toString());
+            log(Logger::MessageType::Debug, "Attribute '" + key + "' (" + it.first->getTypeName() +
+                        ") set to " + it.first->toString());
 
         }
     }
@@ -157,12 +157,12 @@ mv::Element::Element(const json::Value& content, bool simplifiedTyping, std::str
 
                 }
 
-                auto it = attrs_.emplace(key, val);
+                auto it = attrs_.emplace(AttrKey(key), std::move(val));
                 if (!it.second)
                     throw RuntimeError(*this, "Unable to emplace a new element in attributes dictionary");
 
-                log(Logger::MessageType::Debug, "Attribute '" + key + "' (" + it.first->second.getTypeName() +
-                            ") set to " + it.first->second.toString());
+                log(Logger::MessageType::Debug, "Attribute '" + key + "' (" + it.first->getTypeName() +
+                            ") set to " + it.first->toString());
             }
 
         }
@@ -210,7 +210,12 @@ void mv::Element::setName(const std::string& name)
 
 bool mv::Element::hasAttr(const std::string &name) const
 {
-    return attrs_.find(name) != attrs_.end();
+    return attrs_.find(AttrKey::find(name)) != nullptr;
+}
+
+bool mv::Element::hasAttr(AttrKey key) const
+{
+    return attrs_.find(key) != nullptr;
 }
 
 std::size_t mv::Element::attrsCount() const
@@ -221,8 +226,8 @@ std::size_t mv::Element::attrsCount() const
 std::vector<std::string> mv::Element::attrsKeys() const
 {
     std::vector<std::string> output;
-    for (auto &attr : attrs_)
-        output.push_back(attr.first);
+    for (auto &entry : attrs_.sorted())
+        output.push_back(*entry.first);
     return output;
 }
 
@@ -235,25 +240,25 @@ std::string mv::Element::attrsToString_() const
 {
 
     std::string result;
-    for (auto it = attrs_.cbegin(); it != attrs_.cend(); ++it)
-        result += "\n\"" +  it->first + "\" (" + it->second.getTypeName() + "): " + it->second.toString();
+    for (auto &entry : attrs_.sorted())
+        result += "\n\"" +  *entry.first + "\" (" + entry.second->getTypeName() + "): " + entry.second->toString();
     return result;
 
 }
 
 void mv::Element::forceErase_(const std::string& name)
 {
-    attrs_.erase(name);
+    attrs_.erase(AttrKey::find(name));
 }
 
-const std::map<std::string, mv::Attribute>& mv::Element::getAttrs_() const
+std::map<std::string, mv::Attribute> mv::Element::getAttrs_() const
 {
-    return attrs_;
+    return attrs_.toMap();
 }
 
 std::map<std::string, mv::Attribute> mv::Element::getAttrs(const std::vector<std::string>& forbiddenKeys) const
 {
-    std::map<std::string, Attribute> toReturn(attrs_);
+    auto toReturn = attrs_.toMap();
     for(auto& s: forbiddenKeys)
         if(toReturn.find(s) != toReturn.end())
             toReturn.erase(s);
@@ -262,33 +267,57 @@ std::map<std::string, mv::Attribute> mv::Element::getAttrs(const std::vector<std
 
 void mv::Element::setAttrs(const std::map<std::string, Attribute>& attrs)
 {
-    attrs_.insert(attrs.begin(), attrs.end());
+    for (const auto& attr : attrs)
+        attrs_.emplace(AttrKey(attr.first), attr.second);
 }
 
 mv::Attribute& mv::Element::get(const std::string& name)
 {
-    if (attrs_.find(name) == attrs_.end())
+    auto attr = attrs_.find(AttrKey::find(name));
+    if (attr == nullptr)
         throw ArgumentError(*this, "name", name, "Undefined attribute");
-    return attrs_[name];
+    return *attr;
+}
+
+mv::Attribute& mv::Element::get(AttrKey key)
+{
+    auto attr = attrs_.find(key);
+    if (attr == nullptr)
+        throw ArgumentError(*this, "name", key.name(), "Undefined attribute");
+    return *attr;
 }
 
 void mv::Element::set(const std::string& name, const Attribute& attr)
+{
+    set(AttrKey(name), attr);
+}
+
+void mv::Element::set(AttrKey key, const Attribute& attr)
 {
     MV_PROFILED_FUNCTION(MV_PROFILE_BASE)
-    auto it = attrs_.emplace(name, attr);
+    auto it = attrs_.emplace(key, attr);
     if (!it.second)
         throw RuntimeError(*this, "Unable to emplace a new element in attributes dictionary");
-    log(Logger::MessageType::Debug, "Attribute '" + name + "' (" + it.first->second.getTypeName() +
-        ") set to " + it.first->second.toString());
+    log(Logger::MessageType::Debug, "Attribute '" + key.name() + "' (" + it.first->getTypeName() +
+        ") set to " + it.first->toString());
 }
 
 void mv::Element::erase(const std::string& name)
 {
-    if (!hasAttr(name))
+    auto key = AttrKey::find(name);
+    if (!key.valid())
         throw ArgumentError(*this, "attribute identifer", name,  "Undefined identifier");
-    if (attrs_[name].hasTrait("const"))
-        throw AttributeError(*this, "Attempt of deletion of a const attribute " + name);
-    attrs_.erase(name);
+    erase(key);
+}
+
+void mv::Element::erase(AttrKey key)
+{
+    auto attr = attrs_.find(key);
+    if (attr == nullptr)
+        throw ArgumentError(*this, "attribute identifer", key.name(),  "Undefined identifier");
+    if (attr->hasTrait("const"))
+        throw AttributeError(*this, "Attempt of deletion of a const attribute " + key.name());
+    attrs_.erase(key);
 }
 
 std::string mv::Element::toString() const
@@ -310,33 +339,35 @@ mv::json::Value mv::Element::toJSON(bool simplifiedTyping) const
     if (!simplifiedTyping)
     {
         result.emplace("attrs", json::Object());
-        for (auto it = attrs_.cbegin(); it != attrs_.cend(); ++it)
-            result["attrs"].emplace({it->first, it->second.toJSON()});
+        for (auto &entry : attrs_.sorted())
+            result["attrs"].emplace({*entry.first, entry.second->toJSON()});
         return result;
     }
 
-    for (auto it = attrs_.cbegin(); it != attrs_.cend(); ++it)
+    for (auto &entry : attrs_.sorted())
     {
-        auto attrTypeID = it->second.getTypeID();
+        const auto& name = *entry.first;
+        const auto& value = *entry.second;
+        auto attrTypeID = value.getTypeID();
         if (attrTypeID == attr::AttributeRegistry::getTypeID("Element"))
         {
-            result.emplace(it->first, it->second.get<Element>().toJSON(true));
+            result.emplace(name, value.get<Element>().toJSON(true));
             continue;
         }
         else if (attrTypeID == attr::AttributeRegistry::getTypeID("std::vector<mv::Element>"))
         {
-            auto jsonVal = attr::AttributeRegistry::getToSimplifiedJSONFunc(attrTypeID)(it->second);
-            result.emplace(it->first, jsonVal);
+            auto jsonVal = attr::AttributeRegistry::getToSimplifiedJSONFunc(attrTypeID)(value);
+            result.emplace(name, jsonVal);
             continue;
         }
 
         // if (!attr::AttributeRegistry::hasTypeTrait(attrTypeID, "standardJSON"))
         // {
-        //     throw ArgumentError(*this, it->first + ":type", attr::AttributeRegistry::getTypeName(attrTypeID),
+        //     throw ArgumentError(*this, name + ":type", attr::AttributeRegistry::getTypeName(attrTypeID),
         //         "Impossible simplified to-JSON conversion, because type is not a JSON type");
         // }
-        auto jsonVal = attr::AttributeRegistry::getToJSONFunc(attrTypeID)(it->second);
-        result.emplace(it->first, jsonVal);
+        auto jsonVal = attr::AttributeRegistry::getToJSONFunc(attrTypeID)(value);
+        result.emplace(name, jsonVal);
 
     }
 
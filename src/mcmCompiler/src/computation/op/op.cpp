@@ -94,15 +94,17 @@ ModelElement(model, name)
     for (auto it = inputs.begin(); it != inputs.end(); ++it)
         inputs_.push_back(*it);
 
+    // The attributes are the same for both registry calls, copy them out of the store once
+    const auto attrs = getAttrs_();
     std::string errMsg;
-    auto checkRes = op::OpRegistry::checkInputs(opType, inputs_, getAttrs_(), errMsg);
+    auto checkRes = op::OpRegistry::checkInputs(opType, inputs_, attrs, errMsg);
 
     if (!checkRes.first)
         throw OpError(*this, "Invalid input " + op::OpRegistry::getInputLabel(opType, checkRes.second) + " (" +
             std::to_string(checkRes.second) + ") - " + errMsg);
 
     std::vector<Tensor> outputsDef;
-    op::OpRegistry::getOutputsDef(opType, inputs_, getAttrs_(), outputsDef);
+    op::OpRegistry::getOutputsDef(opType, inputs_, attrs, outputsDef);
 
     DataModel dm(getModel_());
     for (std::size_t i = 0; i < outputsDef.size(); ++i)
@@ -127,7 +129,8 @@ mv::Op::~Op()
 
 std::string mv::Op::getOpType() const
 {
-    return get<std::string>("opType");
+    static const AttrKey opTypeKey("opType");
+    return get<std::string>(opTypeKey);
 }
 
 bool mv::Op::hasTypeTrait(const std::string& typeTrait) const
@@ -139,17 +142,24 @@ bool mv::Op::hasTypeTrait(const std::string& typeTrait) const
 
 void mv::Op::redefineOutputTensors()
 {
+    const auto opType = getOpType();
+
+    // The attributes are the same for both registry calls, copy them out of the store once
+    auto attrs = getAttrs_();
     std::string errMsg;
-    auto checkRes = op::OpRegistry::checkInputs(getOpType(), inputs_, getAttrs_(), errMsg);
+    auto checkRes = op::OpRegistry::checkInputs(opType, inputs_, attrs, errMsg);
     if (!checkRes.first)
-        throw OpError(*this, "Invalid input " + op::OpRegistry::getInputLabel(getOpType(), checkRes.second) + " (" +
+        throw OpError(*this, "Invalid input " + op::OpRegistry::getInputLabel(opType, checkRes.second) + " (" +
             std::to_string(checkRes.second) + ") - " + errMsg);
 
     if(hasAttr("invalid") && get<bool>("invalid"))
+    {
         erase("invalid");
+        attrs.erase("invalid");
+    }
 
     std::vector<Tensor> outputsDef;
-    op::OpRegistry::getOutputsDef(getOpType(), inputs_, getAttrs_(), outputsDef);
+    op::OpRegistry::getOutputsDef(opType, inputs_, attrs, outputsDef);
     for (std::size_t i = 0; i < outputsDef.size(); ++i)
     {
         outputs_[i]->setDType(outputsDef[i].getDType());
@@ -179,17 +189,22 @@ void mv::Op::setInputTensor(Data::TensorIterator tensor, std::size_t idx, bool c
         // Whenever we update and propagate a tensor change we influence a single
         // input tensor at a time so the input check will go always off.
         // Assume unsafe behavior!
+        const auto opType = getOpType();
+        auto attrs = getAttrs_();
         std::string errMsg;
-        auto checkRes = op::OpRegistry::checkInputs(getOpType(), inputs_, getAttrs_(), errMsg);
+        auto checkRes = op::OpRegistry::checkInputs(opType, inputs_, attrs, errMsg);
         if (!checkRes.first)
-            throw OpError(*this, "Invalid input " + op::OpRegistry::getInputLabel(getOpType(), checkRes.second) + " (" +
+            throw OpError(*this, "Invalid input " + op::OpRegistry::getInputLabel(opType, checkRes.second) + " (" +
                 std::to_string(checkRes.second) + ") - " + errMsg);
 
         if(hasAttr("invalid") && get<bool>("invalid"))
+        {
             erase("invalid");
+            attrs.erase("invalid");
+        }
 
         std::vector<Tensor> outputsDef;
-        op::OpRegistry::getOutputsDef(getOpType(), inputs_, getAttrs_(), outputsDef);
+        op::OpRegistry::getOutputsDef(opType, inputs_, attrs, outputsDef);
         for (std::size_t i = 0; i < outputsDef.size(); ++i)
         {
             //IDEA: If output tensor definition is updated (keeping the reference)
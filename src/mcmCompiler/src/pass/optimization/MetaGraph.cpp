@@ -5,11 +5,87 @@
 #include "include/mcm/pass/graphOptimizations/StrategyManager.hpp"
 #include "include/mcm/algorithms/dijkstra.hpp"
 
+#include <exception>
+#include <mutex>
+#include <thread>
+
 namespace mv {
 namespace graphOptimizer  {
 
 using namespace std;
 
+namespace {
+
+//below this number of strategy pairs per worker, starting the threads costs more than the evaluations
+constexpr size_t MIN_TRANSITIONS_PER_WORKER = 256;
+
+using StrategySet = unordered_map<string,Attribute>;
+using TransitionCostFunc = function<double(Op&,Op&,StrategySet&,StrategySet&)>;
+
+//evaluates the cost of every (parent, child) strategy pair, the result is stored row by row, a row per parent
+vector<double> evaluateTransitionCosts(Op& parentOp, Op& childOp,
+                                        const vector<StrategySet*>& parents,
+                                        const vector<StrategySet*>& children,
+                                        const TransitionCostFunc& cost)
+{
+    vector<double> costs(parents.size() * children.size());
+
+    const size_t numWorkers = min<size_t>(max(1u, thread::hardware_concurrency()),
+                                            max<size_t>(1, costs.size() / MIN_TRANSITIONS_PER_WORKER));
+    if (numWorkers == 1)
+    {
+        for (size_t row = 0; row < parents.size(); ++row)
+            for (size_t col = 0; col < children.size(); ++col)
+                costs[row * children.size() + col] = cost(parentOp, childOp, *parents[row], *children[col]);
+        return costs;
+    }
+
+    //the cost functions take the strategy sets by non-const reference and look the fields up with operator[],
+    //so every worker evaluates its own copies instead of sharing the maps of the levels
+    atomic<size_t> nextRow(0);
+    mutex errorMutex;
+    exception_ptr error;
+
+    auto worker = [&]()
+    {
+        try
+        {
+            vector<StrategySet> childCopies;
+            childCopies.reserve(children.size());
+            for (const auto child : children)
+                childCopies.push_back(*child);
+
+            for (auto row = nextRow++; row < parents.size(); row = nextRow++)
+            {
+                auto parentCopy = *parents[row];
+                for (size_t col = 0; col < childCopies.size(); ++col)
+                    costs[row * children.size() + col] = cost(parentOp, childOp, parentCopy, childCopies[col]);
+            }
+        }
+        catch (...)
+        {
+            lock_guard<mutex> lock(errorMutex);
+            if (!error)
+                error = current_exception();
+            nextRow = parents.size();
+        }
+    };
+
+    vector<thread> threads;
+    for (size_t i = 1; i < numWorkers; ++i)
+        threads.emplace_back(worker);
+    worker();
+    for (auto& workerThread : threads)
+        workerThread.join();
+
+    if (error)
+        rethrow_exception(error);
+
+    return costs;
+}
+
+}
+
 bool MetaEdge::operator==(const MetaEdge& other)
 {
     return id == other.id ;
@@ -167,10 +243,20 @@ void MetaGraph::addNewLevel(Op& op,
             latestLevel.level.push_back(internalGraph_.node_insert(newSet[strategyCtr]));
         }
 
+        vector<StrategySet*> parents, children;
+        for(const auto& oldNode : lastLevel.level)
+            parents.push_back(&(*oldNode));
+        for(const auto& newNode : latestLevel.level)
+            children.push_back(&(*newNode));
+
+        //the edges are inserted serially in the original order, so their ids do not depend on the scheduling
+        const auto costs = evaluateTransitionCosts(*lastLevel.op, *latestLevel.op, parents, children, cost);
+        auto edgeCostIt = costs.begin();
+
         for(const auto& oldNode : lastLevel.level){
             for(const auto& newNode : latestLevel.level)
             {
-                double edgeCost = cost(*lastLevel.op,*latestLevel.op, *oldNode, *newNode);
+                double edgeCost = *(edgeCostIt++);
                 if (edgeCost == numeric_limits<double>::infinity())
                     continue;
 
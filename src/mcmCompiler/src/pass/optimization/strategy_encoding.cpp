@@ -0,0 +1,155 @@
+//
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache 2.0
+//
+#include "include/mcm/pass/graphOptimizations/strategy_encoding.hpp"
+#include "include/mcm/tensor/shape.hpp"
+
+#include <limits>
+
+namespace mv {
+namespace graphOptimizer {
+
+namespace {
+
+const std::array<std::string, 5> clusteringNames = {
+    "Clustering",
+    "SplitOverH",
+    "SplitOverHOverlapped",
+    "SplitOverK",
+    "HKSwitch"
+};
+
+const std::array<std::pair<const char*, StrategyEncoding::Flags>, 4> boolFields = {{
+    {"spilling", StrategyEncoding::Spilling},
+    {"inputSparsity", StrategyEncoding::InputSparsity},
+    {"outputSparsity", StrategyEncoding::OutputSparsity},
+    {"weightsSparsity", StrategyEncoding::WeightsSparsity}
+}};
+
+bool encodeBool(const Attribute& attr, StrategyEncoding::Flags flag, uint8_t& flags)
+{
+    if (!attr.is<bool>())
+        return false;
+    if (attr.get<bool>())
+        flags |= flag;
+    return true;
+}
+
+bool encodeClustering(const Attribute& attr, StrategyEncoding::Clustering& clustering)
+{
+    if (!attr.is<std::string>())
+        return false;
+
+    const auto& name = attr.get<std::string>();
+    for (std::size_t i = 0; i < clusteringNames.size(); ++i)
+    {
+        if (clusteringNames[i] == name)
+        {
+            clustering = static_cast<StrategyEncoding::Clustering>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool encodeStreaming(const Attribute& attr, std::array<uint32_t, StrategyEncoding::streamingDims>& streaming)
+{
+    if (!attr.is<Shape>())
+        return false;
+
+    const auto& shape = attr.get<Shape>();
+    if (shape.ndims() != StrategyEncoding::streamingDims)
+        return false;
+
+    for (std::size_t i = 0; i < StrategyEncoding::streamingDims; ++i)
+    {
+        if (shape[i] > std::numeric_limits<uint32_t>::max())
+            return false;
+        streaming[i] = static_cast<uint32_t>(shape[i]);
+    }
+    return true;
+}
+
+}
+
+StrategyEncoding StrategyEncoding::encode(const StrategySet& strategy)
+{
+    StrategyEncoding encoding;
+
+    for (const auto& field : strategy)
+    {
+        const auto& key = field.first;
+        const auto& attr = field.second;
+
+        bool encoded = false;
+        if (key == "name" || key == "id")
+            encoded = true;
+        else if (key == "clustering")
+            encoded = encodeClustering(attr, encoding.clustering);
+        else if (key == "streaming")
+            encoded = encodeStreaming(attr, encoding.streaming);
+        else if (key == "eltwiseParentSpilling")
+        {
+            encoded = encodeBool(attr, EltwiseParentSpilling, encoding.flags);
+            encoding.flags |= HasEltwiseParentSpilling;
+        }
+        else
+        {
+            for (const auto& boolField : boolFields)
+            {
+                if (key == boolField.first)
+                {
+                    encoded = encodeBool(attr, boolField.second, encoding.flags);
+                    break;
+                }
+            }
+        }
+
+        if (!encoded)
+            return StrategyEncoding();
+    }
+
+    // A missing field is not the same as a false one, the decoded map must have all the fields of the original
+    encoding.valid = strategy.count("clustering") && strategy.count("streaming");
+    for (const auto& boolField : boolFields)
+        encoding.valid = encoding.valid && strategy.count(boolField.first);
+    return encoding;
+}
+
+void StrategyEncoding::decode(StrategySet& strategy) const
+{
+    strategy["clustering"] = clusteringName(clustering);
+    for (const auto& boolField : boolFields)
+        strategy[boolField.first] = hasFlag(boolField.second);
+    strategy["streaming"] = Shape({streaming[0], streaming[1], streaming[2], streaming[3], streaming[4]});
+
+    if (hasFlag(HasEltwiseParentSpilling))
+        strategy["eltwiseParentSpilling"] = hasFlag(EltwiseParentSpilling);
+    else
+        strategy.erase("eltwiseParentSpilling");
+}
+
+bool StrategyEncoding::operator==(const StrategyEncoding& other) const
+{
+    return valid == other.valid && clustering == other.clustering && flags == other.flags &&
+        streaming == other.streaming;
+}
+
+const std::string& StrategyEncoding::clusteringName(Clustering clustering)
+{
+    return clusteringNames[static_cast<std::size_t>(clustering)];
+}
+
+std::size_t StrategyEncodingHash::operator()(const StrategyEncoding& encoding) const
+{
+    std::size_t hash = static_cast<std::size_t>(encoding.clustering) |
+        (static_cast<std::size_t>(encoding.flags) << 8) |
+        (static_cast<std::size_t>(encoding.valid) << 16);
+    for (auto split : encoding.streaming)
+        hash = hash * 31 + split;
+    return hash;
+}
+
+}
+}
@@ -1147,7 +1147,7 @@ std::shared_ptr<MetaGraph> StrategyManager::linearGraphSolver(mv::Data::OpDFSIte
     auto modelEnd = model_.opEnd();
 
     auto cost = [this](Op& parentOp,Op& childOp,StrategySet& a,StrategySet& b) ->double
-            {return this->transitionCost(parentOp,childOp,a,b); };
+            {return this->cachedTransitionCost(parentOp,childOp,a,b); };
 
     //do first pivot out of the loop
     {
@@ -1261,6 +1261,97 @@ void StrategyManager::graphParameterOptimizations()
     }
 }
 
+bool StrategyManager::TransitionKey::operator==(const TransitionKey& other) const
+{
+    return parentOp == other.parentOp && childOp == other.childOp && parent == other.parent && child == other.child;
+}
+
+size_t StrategyManager::TransitionKeyHash::operator()(const TransitionKey& key) const
+{
+    StrategyEncodingHash encodingHash;
+    size_t hash = key.parentOp;
+    hash = hash * 31 + key.childOp;
+    hash = hash * 31 + encodingHash(key.parent);
+    hash = hash * 31 + encodingHash(key.child);
+    return hash;
+}
+
+unsigned StrategyManager::getOpSignatureId(Op& op)
+{
+    {
+        lock_guard<mutex> lock(transitionCacheMutex_);
+        auto opIt = opSignatureIds_.find(op.getName());
+        if (opIt != opSignatureIds_.end())
+            return opIt->second;
+    }
+
+    //the signature serializes all the attributes, so it is built outside of the lock;
+    //if another worker interned the op meanwhile, its id is kept
+    auto signature = transitionSignature(op);
+
+    lock_guard<mutex> lock(transitionCacheMutex_);
+    auto id = noSignature_;
+    if (!signature.empty())
+        id = signatureIds_.emplace(move(signature), signatureIds_.size()).first->second;
+
+    return opSignatureIds_.emplace(op.getName(), id).first->second;
+}
+
+double StrategyManager::cachedTransitionCost(Op& parentOp,Op& childOp,StrategySet& parent,StrategySet& child)
+{
+    TransitionKey key;
+    key.parentOp = getOpSignatureId(parentOp);
+    key.childOp = getOpSignatureId(childOp);
+    key.parent = StrategyEncoding::encode(parent);
+    key.child = StrategyEncoding::encode(child);
+
+    if (key.parentOp == noSignature_ || key.childOp == noSignature_ || !key.parent.valid || !key.child.valid)
+        return transitionCost(parentOp, childOp, parent, child);
+
+    {
+        lock_guard<mutex> lock(transitionCacheMutex_);
+        auto it = transitionCostCache_.find(key);
+        if (it != transitionCostCache_.end())
+            return it->second;
+    }
+
+    //the workers may evaluate the same key concurrently, the costs are equal, so the first one stays
+    auto cost = transitionCost(parentOp, childOp, parent, child);
+
+    lock_guard<mutex> lock(transitionCacheMutex_);
+    transitionCostCache_.emplace(key, cost);
+    return cost;
+}
+
+string StrategyManager::transitionSignature(Op& op)
+{
+    //the layers configured by name may have the strategies, their isomorphic peers do not have
+    if (layerStrategies_.find(op.getName()) != layerStrategies_.end())
+        return string();
+
+    string signature = op.getOpType();
+    auto appendAttrs = [&signature](const map<string, Attribute>& attrs)
+    {
+        for (const auto& attr : attrs)
+            signature += "|" + attr.first + "=" + attr.second.toLongString();
+    };
+
+    //the op attributes, without the ones naming the op or the strategies generated for it
+    appendAttrs(op.getAttrs({"opId", "StrategySet"}));
+    for (const auto& input : op.getInputTensor())
+    {
+        signature += "|input";
+        appendAttrs(input->getAttrs({"flows", "sourceOp"}));
+    }
+    for (const auto& output : op.getOutputTensor())
+    {
+        signature += "|output";
+        appendAttrs(output->getAttrs({"flows", "sourceOp"}));
+    }
+
+    return signature;
+}
+
 bool StrategyManager::isPipeliningPossible(mv::Op& op, StrategySet& /*strategy*/, bool /*parentSpilling*/)
 {
     throw mv::ArgumentError("StrategyManager", "isPipeliningPossible", op.toString(), "Unable to determine pipelining");
@@ -16,6 +16,9 @@
 #include <iomanip>
 #include <unordered_set>
 #include <memory>
+#include <atomic>
+#include <mutex>
+#include <thread>
 
 #include <version.hpp>
 
@@ -1325,29 +1328,38 @@ std::unique_ptr<MVCNN::ResourcesT> mv::RuntimeModel::buildResourcesT(Computation
 template <typename T>
 std::vector<uint64_t> packToInt64(const std::vector<T>& origData, mv::DType dtype)
 {
-    unsigned dataSize = origData.size();
-    unsigned origDataSize = dtype.getSizeInBits();
+    const std::size_t dataSize = origData.size();
+    const unsigned origDataSize = dtype.getSizeInBits();
 
-    unsigned nElementToPack = 64 / origDataSize;
-    unsigned finalLength = mv::ceil_division(dataSize , nElementToPack);
+    const std::size_t nElementToPack = 64 / origDataSize;
+    const std::size_t finalLength = (dataSize + nElementToPack - 1) / nElementToPack;
 
-    std::vector<uint64_t> toReturn(finalLength, 0);
+    // When the elements packed in the less significant part ot he long unsingned int value
+    // are negative, the sign extension gets copied over the more significant parts.
+    // That's why the mask is needed.
+    const uint64_t mask = origDataSize < 64 ? (1ULL << origDataSize) - 1 : ~0ULL;
 
-    for(unsigned i = 0; i < finalLength; ++i)
-        for(unsigned j = 0; j < nElementToPack; ++j)
-            if ((i*nElementToPack + j) < dataSize) {
-                // When the elements packed in the less significant part ot he long unsingned int value
-                // are negative, the sign extension gets copied over the more significant parts. As a result,
-                // when the next element gets packed it wil have its bits flipped due to XOR.
-                // That's why the mask is needed.
-                const uint64_t mask = (1ULL << origDataSize) - 1;
-                toReturn[i] ^= (origData[i*nElementToPack + j] & mask) << (j * origDataSize);
-            }
+    std::vector<uint64_t> toReturn(finalLength);
+    for (std::size_t i = 0; i < finalLength; ++i)
+    {
+        const std::size_t begin = i * nElementToPack;
+        const std::size_t end = std::min(begin + nElementToPack, dataSize);
+
+        uint64_t packed = 0;
+        for (std::size_t j = begin; j < end; ++j)
+            packed |= (static_cast<uint64_t>(origData[j]) & mask) << ((j - begin) * origDataSize);
+        toReturn[i] = packed;
+    }
 
     return toReturn;
 }
 
 std::unique_ptr<MVCNN::BinaryDataT> mv::RuntimeModel::buildBinaryDataT(ComputationModel&, mv::Element&, mv::Tensor& t, bool compression, bool csramCacheable)
+{
+    return buildBinaryDataT_(*codec_, t, compression, csramCacheable);
+}
+
+std::unique_ptr<MVCNN::BinaryDataT> mv::RuntimeModel::buildBinaryDataT_(Compressor& codec, mv::Tensor& t, bool compression, bool csramCacheable)
 {
     std::unique_ptr<MVCNN::BinaryDataT> toBuild = std::unique_ptr<MVCNN::BinaryDataT>(new MVCNN::BinaryDataT());
 
@@ -1363,7 +1375,7 @@ std::unique_ptr<MVCNN::BinaryDataT> mv::RuntimeModel::buildBinaryDataT(Computati
         //Minimum size that can be compressed is 4kB
         if(weightSizeKb > 4) {
             auto dataPacked = t.getDataPacked();
-            auto compressedData = codec_->compress(dataPacked, t);
+            auto compressedData = codec.compress(dataPacked, t);
             toBuild->data = packToInt64(compressedData.first, t.getDType());
 
             //sometimes even if the tensor is > 4KB it might not be compressable
@@ -1411,6 +1423,59 @@ std::unique_ptr<MVCNN::BinaryDataT> mv::RuntimeModel::buildBinaryDataT(Computati
     return toBuild;
 }
 
+std::vector<std::unique_ptr<MVCNN::BinaryDataT>> mv::RuntimeModel::buildBinaryDataT(ComputationModel&, mv::Element&,
+    const std::vector<mv::Tensor*>& tensors, bool compression, const std::unordered_set<mv::Tensor*>& csramCacheable)
+{
+    MV_PROFILED_FUNCTION(MV_PROFILE_BULD)
+    std::vector<std::unique_ptr<MVCNN::BinaryDataT>> toBuild(tensors.size());
+
+    // Every worker packs and compresses whole tensors with its own codec, taking the next tensor from the
+    // shared counter. The tensors are distinct, so the attributes they get ("CompressedSize", "Compression")
+    // are set without synchronization. The results are stored by index, so the order does not depend on
+    // the scheduling.
+    const std::size_t numWorkers = std::min<std::size_t>(std::max(1u, std::thread::hardware_concurrency()),
+        tensors.size());
+
+    std::atomic<std::size_t> nextTensor(0);
+    std::mutex errorMutex;
+    std::exception_ptr error;
+
+    const auto worker = [&](Compressor& codec)
+    {
+        try
+        {
+            for (auto idx = nextTensor++; idx < tensors.size(); idx = nextTensor++)
+            {
+                auto& t = *tensors[idx];
+                toBuild[idx] = buildBinaryDataT_(codec, t, compression, csramCacheable.count(&t) != 0);
+            }
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lock(errorMutex);
+            if (!error)
+                error = std::current_exception();
+            nextTensor = tensors.size();
+        }
+    };
+
+    std::vector<std::unique_ptr<Compressor>> codecs;
+    std::vector<std::thread> threads;
+    for (std::size_t i = 1; i < numWorkers; ++i)
+    {
+        codecs.push_back(codec_->clone());
+        threads.emplace_back(worker, std::ref(*codecs.back()));
+    }
+    worker(*codec_);
+    for (auto& thread : threads)
+        thread.join();
+
+    if (error)
+        std::rethrow_exception(error);
+
+    return toBuild;
+}
+
 // We have three taskslist for POC:
 // Tasklist 0: Contains all the tasks
 // We need to topologically sort the control model graph to get the tasks in the correct order.
@@ -5049,10 +5114,7 @@ void mv::RuntimeModel::buildGraphFile(ComputationModel& cm, const mv::TargetDesc
     }
 
     std::sort(toSort.begin(), toSort.end(), [](mv::Tensor * t1, mv::Tensor * t2){return (t1->get<unsigned>("graphFileIndex") < t2->get<unsigned>("graphFileIndex"));});
-    for(auto& tIt : toSort)
-    {
-        graphFile_.binary_data.push_back(buildBinaryDataT(cm, compilationDescriptor, *tIt, compression, csramCacheable.count(tIt) != 0));
-    }
+    graphFile_.binary_data = buildBinaryDataT(cm, compilationDescriptor, toSort, compression, csramCacheable);
     // TASKS
     graphFile_.task_lists = buildTaskListT(cm, compilationDescriptor);
 
@@ -5063,7 +5125,16 @@ void mv::RuntimeModel::buildGraphFile(ComputationModel& cm, const mv::TargetDesc
 
 void mv::RuntimeModel::serialize(size_t weight_alignment)
 {
-    flatbuffers::FlatBufferBuilder fbb;
+    // The builder doubles its buffer on growth, which keeps both buffers alive while copying. Reserving
+    // the size of the binary data (the bulk of the blob) upfront avoids the copies of the weights and
+    // the peak memory of the reallocations. The initial size does not affect the content of the blob.
+    constexpr size_t tasksReserve = 1024 * 1024;
+    constexpr size_t binaryDataTableReserve = 64;
+    size_t reserve = tasksReserve;
+    for (const auto& binary_data : graphFile_.binary_data)
+        reserve += binary_data->data.size() * sizeof(binary_data->data[0]) + weight_alignment + binaryDataTableReserve;
+
+    flatbuffers::FlatBufferBuilder fbb(reserve);
 
     // N.B. In order to build the embedded weight vectors with the correct
     // alignment (which slightly reduces first-run latency, as the runtime
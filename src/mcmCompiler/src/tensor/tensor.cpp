@@ -25,6 +25,48 @@ std::map<std::string, mv::Tensor::MemoryLocation::Location> createNamingMap() {
 
 std::map<std::string, mv::Tensor::MemoryLocation::Location> namingMap = createNamingMap();
 
+// Writes the data given in the `order` to the storage kept in the `internalOrder`
+template <typename T>
+void fillStorage(mv::TensorStorage& storage, const std::vector<T>& data, const mv::Shape& shape,
+    const mv::Order& order, const mv::Order& internalOrder)
+{
+    if (order != internalOrder)
+    {
+        for (std::size_t j = 0; j < data.size(); ++j)
+        {
+            const auto sub = order.indToSub(shape, j);
+            storage.set(internalOrder.subToInd(shape, sub), data[j]);
+        }
+    }
+    else
+    {
+        for (std::size_t m = 0; m < data.size(); ++m)
+            storage.set(m, data[m]);
+    }
+}
+
+// Reads the storage kept in the `internalOrder` to the data in the `order`
+template <typename T, typename GetFunc>
+std::vector<T> readStorage(const mv::Shape& shape, const mv::Order& order, const mv::Order& internalOrder,
+    GetFunc getFunc)
+{
+    std::vector<T> orderedData(shape.totalSize());
+    if (order != internalOrder)
+    {
+        for (std::size_t i = 0; i < orderedData.size(); ++i)
+        {
+            const auto sub = internalOrder.indToSub(shape, i);
+            orderedData[order.subToInd(shape, sub)] = getFunc(i);
+        }
+    }
+    else
+    {
+        for (std::size_t i = 0; i < orderedData.size(); ++i)
+            orderedData[i] = getFunc(i);
+    }
+    return orderedData;
+}
+
 }  // namespace
 
 mv::Tensor::MemoryLocation::MemoryLocation(const std::string& location)
@@ -63,8 +105,7 @@ std::string mv::Tensor::MemoryLocation::toString() const
 mv::Tensor::Tensor(const std::string &name, const Shape &shape, DType dType, Order order):
 Element(name),
 shape_(shape),
-internalOrder_(Order(order.toString())),
-blockSize_(shape[shape.ndims() - 1])
+internalOrder_(Order(order.toString()))
 {
     MV_PROFILED_FUNCTION(MV_PROFILE_BASE)
 
@@ -130,7 +171,6 @@ mv::Tensor::Tensor(const Tensor &other) :
 Element(other),
 shape_(other.shape_),
 internalOrder_(other.internalOrder_),
-blockSize_(other.blockSize_),
 sparsityMap_(),
 storageElement_(),
 subTensors_(),
@@ -150,10 +190,7 @@ noneZeroElements_(other.noneZeroElements_)
 
 
     if (other.isPopulated())
-    {
         data_ = other.data_;
-        blocks_ = other.blocks_;
-    }
 
     if (other.isSparse()) {
         set<bool>("sparse", false);
@@ -173,7 +210,6 @@ noneZeroElements_(other.noneZeroElements_)
 
 mv::Tensor::~Tensor()
 {
-    data_.clear();
 }
 
 std::vector<std::size_t> mv::Tensor::indToSub_(const Shape& s, size_t index) const
@@ -213,6 +249,28 @@ unsigned mv::Tensor::subToInd_(const Shape& s, const std::vector<std::size_t>& s
 
 }
 
+std::size_t mv::Tensor::storageIndex_(std::size_t idx) const
+{
+    if (hasAttr("master"))
+        return subToInd(indToSub(idx));
+
+    if (getOrder() == internalOrder_)
+        return idx;
+
+    auto sub = getOrder().indToSub(shape_, idx);
+    return internalOrder_.subToInd(shape_, sub);
+}
+
+void mv::Tensor::allocateStorage_(bool isDouble)
+{
+    // Existing storage is reused, as it may be shared with the copies of this tensor
+    if (data_ != nullptr && data_->size() == shape_.totalSize())
+        return;
+
+    data_ = std::make_shared<TensorStorage>(shape_.totalSize(), isDouble,
+        TensorStorage::compactElementType(getDType(), isDouble));
+}
+
 void mv::Tensor::populate(const std::vector<double>& data)
 {
     MV_PROFILED_FUNCTION(MV_PROFILE_BULD)
@@ -240,27 +298,8 @@ void mv::Tensor::populate(const std::vector<double>& data)
         throw ArgumentError(*this, "data vector", std::to_string(data.size()), "Unable to populate, data vector size"
             "does not match total size the tensor (" + std::to_string(shape_.totalSize()) + ")");
 
-    auto dataSize = shape_.totalSize()/blockSize_;
-    for(std::size_t t=data_.size(); t<dataSize; t++){
-        data_.push_back(std::make_shared<std::vector<DataElement>>(blockSize_, DataElement(true)));
-    }
-
-    if (getOrder() != internalOrder_){
-        for(std::size_t j = 0; j < data.size();++j){
-            std::vector<std::size_t> sub = getOrder().indToSub(shape_, j);
-            auto idx = internalOrder_.subToInd(shape_, sub);
-            auto b = idx / blockSize_;
-            auto i = idx % blockSize_;
-            data_[b]->at(i) =  data[j];
-        }
-    }
-    else{
-        for(std::size_t m = 0; m < data.size();++m){
-            auto d = m / blockSize_;
-            auto e = m % blockSize_;
-            data_[d]->at(e) = data[m];
-        }
-    }
+    allocateStorage_(true);
+    fillStorage(*data_, data, shape_, getOrder(), internalOrder_);
 
     set("populated", true);
 
@@ -276,27 +315,9 @@ void mv::Tensor::populate(const std::vector<mv::DataElement>& data)
         throw ArgumentError(*this, "data vector", std::to_string(data.size()), "Unable to populate, data vector size"
             "does not match total size the tensor (" + std::to_string(shape_.totalSize()) + ")");
 
-    auto dataSize = shape_.totalSize()/blockSize_;
-    for(std::size_t t=data_.size(); t<dataSize; t++){
-        data_.push_back(std::make_shared<std::vector<DataElement>>(blockSize_, data[0].isDouble()));
-    }
+    allocateStorage_(data[0].isDouble());
+    fillStorage(*data_, data, shape_, getOrder(), internalOrder_);
 
-    if (getOrder() != internalOrder_){
-        for(std::size_t j = 0; j < data.size();++j){
-            std::vector<std::size_t> sub = getOrder().indToSub(shape_, j);
-            auto idx = internalOrder_.subToInd(shape_, sub);
-            auto b = idx / blockSize_;
-            auto i = idx % blockSize_;
-            data_[b]->at(i) =  data[j];
-        }
-    }
-    else{
-        for(std::size_t m = 0; m < data.size();++m){
-            auto d = m / blockSize_;
-            auto e = m % blockSize_;
-            data_[d]->at(e) = data[m];
-        }
-    }
     set("populated", true);
 
     //if sparse then call sparsify
@@ -318,26 +339,8 @@ void mv::Tensor::populate(const std::vector<int64_t>& data)
             "does not match total size the tensor (" + std::to_string(shape_.totalSize()) + ")");
     }
 
-    auto dataSize = shape_.totalSize()/blockSize_;
-    for(std::size_t t=data_.size(); t<dataSize; t++)
-        data_.push_back(std::make_shared<std::vector<DataElement>>(blockSize_, false));
-
-    if (getOrder() != internalOrder_){
-        for(std::size_t j = 0; j < data.size();++j){
-            std::vector<std::size_t> sub = getOrder().indToSub(shape_, j);
-            auto idx = internalOrder_.subToInd(shape_, sub);
-            auto b = idx / blockSize_;
-            auto i = idx % blockSize_;
-            data_[b]->at(i) =  data[j];
-        }
-    }
-    else{
-        for(std::size_t m = 0; m < data.size();++m){
-            auto d = m / blockSize_;
-            auto e = m % blockSize_;
-            data_[d]->at(e) = data[m];
-        }
-    }
+    allocateStorage_(false);
+    fillStorage(*data_, data, shape_, getOrder(), internalOrder_);
 
     set("populated", true);
 
@@ -385,8 +388,7 @@ void mv::Tensor::unpopulate()
     if (!isPopulated())
         return;
 
-    for(unsigned i=0; i<data_.size();++i)
-        data_[i].reset();
+    data_.reset();
 
     set<bool>("populated", false);
 
@@ -476,9 +478,7 @@ void mv::Tensor::populateSparsityMapTensor_()
             for (std::size_t i = 0; i < outputChannelSize; i++)
             {
                 const auto idx = k*outputChannelSize + i;
-                const auto b = idx/blockSize_;
-                const auto d = idx%blockSize_;
-                if (static_cast<int64_t>(data_[b]->at(d)) != zeroPoint[k])
+                if (data_->getInt(idx) != zeroPoint[k])
                     map ^= (1 << shift);
                 if (++shift == 8)
                     writeMapEntry(sparsityMapData, sparsityMapIdx, map, shift);
@@ -490,9 +490,7 @@ void mv::Tensor::populateSparsityMapTensor_()
             {
                 sub = getOrder().indToSub(shape, k*outputChannelSize + i);
                 const auto idx = internalOrder_.subToInd(shape, sub);
-                const auto b = idx/blockSize_;
-                const auto d = idx%blockSize_;
-                if (static_cast<int64_t>(data_[b]->at(d)) != zeroPoint[k])
+                if (data_->getInt(idx) != zeroPoint[k])
                     map ^= (1 << shift);
                 if (++shift == 8)
                     writeMapEntry(sparsityMapData, sparsityMapIdx, map, shift);
@@ -693,6 +691,8 @@ void mv::Tensor::setDType(DType dtype)
 {
 
     set<DType>("dType", dtype);
+    if (isPopulated() && data_ != nullptr)
+        data_->shrink(TensorStorage::compactElementType(dtype, data_->isDouble()));
     for (size_t tIdx = 0; tIdx < subTensors_.size(); tIdx++)
         subTensors_[tIdx]->setDType(dtype);
     return;
@@ -738,15 +738,8 @@ void mv::Tensor::broadcast(const Shape& shape)
         else if (s2.ndims() > s1.ndims())
             s1 = Shape::augment(s1, s2.ndims());
 
-        if (sO.totalSize() != s1.totalSize()){
-           if (sO.totalSize()/blockSize_ > data_.size())
-           {
-                 auto newNumBlocks = ceil(sO.totalSize()/blockSize_);
-                 data_[data_.size() - 1]->resize(blockSize_, isDoubleType());
-                 for ( auto i = data_.size(); i <  newNumBlocks; i++)
-                        data_.push_back(std::make_shared<std::vector<DataElement>>(blockSize_, DataElement(true)));
-           }
-        }
+        if (sO.totalSize() > data_->size())
+            data_->resize(sO.totalSize());
 
         for (unsigned i = 0; i < dataBuf.size(); ++i)
         {
@@ -763,11 +756,8 @@ void mv::Tensor::broadcast(const Shape& shape)
 
         set<Shape>("shape", sO);
         shape_ = sO;
-        for (unsigned i = 0; i < dataBuf.size(); ++i){
-            auto id = i/blockSize_;
-            auto id_b = i%blockSize_;
-            data_[id]->at(id_b) = dataBuf[i];
-        }
+        for (unsigned i = 0; i < dataBuf.size(); ++i)
+            data_->set(i, dataBuf[i]);
     }
 
 }
@@ -792,30 +782,10 @@ std::vector<double> mv::Tensor::getDoubleData()
     if (!isDoubleType())
         throw ValueError(*this, "Attempt of reading double data from an int type tensor");
 
-    std::vector<double> orderedData(shape_.totalSize());
-
-    auto temp_dataTotal = data_.size() * blockSize_;
-    if (getOrder() != internalOrder_)
-    {
-        for (std::size_t i = 0; i < temp_dataTotal; ++i)
-        {
-            const auto t = i/blockSize_;
-            const auto u = i%blockSize_;
-            const auto sub = internalOrder_.indToSub(shape_, i);
-            const auto idx = getOrder().subToInd(shape_, sub);
-            orderedData[idx] = data_[t]->at(u);
-        }
-    }
-    else
-    {
-        for (std::size_t i = 0; i < temp_dataTotal; ++i)
-        {
-            const auto t = i/blockSize_;
-            const auto u = i%blockSize_;
-            orderedData[i] = data_[t]->at(u);
-        }
-    }
-    return orderedData;
+    const auto& storage = *data_;
+    return readStorage<double>(shape_, getOrder(), internalOrder_, [&storage](std::size_t i) {
+        return storage.getDouble(i);
+    });
 }
 
 std::vector<mv::DataElement> mv::Tensor::getData()
@@ -826,26 +796,19 @@ std::vector<mv::DataElement> mv::Tensor::getData()
 
     std::vector<DataElement> orderedData(shape_.totalSize(), DataElement(isDoubleType()));
 
-    const auto temp_dataTotal = shape_.totalSize();
     if (getOrder() != internalOrder_)
     {
-        for (std::size_t i = 0; i < temp_dataTotal; ++i)
+        for (std::size_t i = 0; i < shape_.totalSize(); ++i)
         {
-            const auto t = i/blockSize_;
-            const auto u = i%blockSize_;
             const auto sub = internalOrder_.indToSub(shape_, i);
             const auto idx = getOrder().subToInd(shape_, sub);
-            orderedData[idx] = data_[t]->at(u);
+            orderedData[idx] = data_->get(i);
         }
     }
     else
     {
-        for (std::size_t i = 0; i < temp_dataTotal; ++i)
-        {
-            const auto t = i/blockSize_;
-            const auto u = i%blockSize_;
-            orderedData[i] = data_[t]->at(u);
-        }
+        for (std::size_t i = 0; i < shape_.totalSize(); ++i)
+            orderedData[i] = data_->get(i);
     }
 
     return orderedData;
@@ -903,10 +866,7 @@ const std::vector<int64_t> mv::Tensor::getDataPacked()
             {
                 for (std::size_t i = 0; i < outputChannelSize; i++)
                 {
-                    const auto idx = k*outputChannelSize + i;
-                    const auto b = idx/blockSize_;
-                    const auto d = idx%blockSize_;
-                    const auto datai = static_cast<int64_t>(data_[b]->at(d));
+                    const auto datai = data_->getInt(k*outputChannelSize + i);
                     if (datai != zeroPoint[k])
                         orderedDataPacked.push_back(datai);
                 }
@@ -918,10 +878,7 @@ const std::vector<int64_t> mv::Tensor::getDataPacked()
             {
                 for (std::size_t i = 0; i < outputChannelSize; i++)
                 {
-                    const auto idx = k*outputChannelSize + i;
-                    const auto b = idx/blockSize_;
-                    const auto d = idx%blockSize_;
-                    orderedDataPacked.push_back(static_cast<int64_t>(data_[b]->at(d)));
+                    orderedDataPacked.push_back(data_->getInt(k*outputChannelSize + i));
                 }
             }
         }
@@ -932,10 +889,7 @@ const std::vector<int64_t> mv::Tensor::getDataPacked()
                 for (std::size_t i = 0; i < outputChannelSize; i++)
                 {
                     sub = getOrder().indToSub(shape, k*outputChannelSize + i);
-                    const auto idx = internalOrder_.subToInd(shape, sub);
-                    const auto b = idx/blockSize_;
-                    const auto d = idx%blockSize_;
-                    const auto datai = static_cast<int64_t>(data_[b]->at(d));
+                    const auto datai = data_->getInt(internalOrder_.subToInd(shape, sub));
                     if (datai != zeroPoint[sub[mv::KERNEL_OUTPUT_CHANNELS]])
                         orderedDataPacked.push_back(datai);
                 }
@@ -948,10 +902,7 @@ const std::vector<int64_t> mv::Tensor::getDataPacked()
                 for (std::size_t i = 0; i < outputChannelSize; i++)
                 {
                     sub = getOrder().indToSub(shape, k*outputChannelSize + i);
-                    const auto idx = internalOrder_.subToInd(shape, sub);
-                    const auto b = idx/blockSize_;
-                    const auto d = idx%blockSize_;
-                    orderedDataPacked.push_back(static_cast<int64_t>(data_[b]->at(d)));
+                    orderedDataPacked.push_back(data_->getInt(internalOrder_.subToInd(shape, sub)));
                 }
             }
         }
@@ -981,10 +932,7 @@ int mv::Tensor::getZeroValuesCount()
         for (std::size_t i = 0; i < outputChannelSize; i++)
         {
             std::vector<std::size_t> sub = getOrder().indToSub(shape, k*outputChannelSize + i);
-            auto idx = internalOrder_.subToInd(shape, sub);
-            auto b = idx/blockSize_;
-            auto d = idx%blockSize_;
-            datai = static_cast<int64_t>(data_[b]->at(d));
+            datai = data_->getInt(internalOrder_.subToInd(shape, sub));
             if ( datai == zeroPoint[sub[mv::KERNEL_OUTPUT_CHANNELS]] )
                 numZeroPoints++;
         }
@@ -1002,40 +950,22 @@ std::vector<int64_t> mv::Tensor::getIntData()
     if (isDoubleType())
         throw ValueError(*this, "Attempt of reading int data from an double type tensor");
 
-    std::vector<int64_t> orderedData(shape_.totalSize());
-
-    const auto temp_dataTotal = data_.size() * blockSize_;
-    if (getOrder() != internalOrder_)
-    {
-        for (std::size_t i = 0; i < temp_dataTotal; ++i)
-        {
-            const auto t = i / blockSize_;
-            const auto u = i % blockSize_;
-            const auto sub = internalOrder_.indToSub(shape_, i);
-            const auto temp = getOrder().subToInd(shape_, sub);
-            orderedData[temp] = data_[t]->at(u);
-        }
-    }
-    else
-    {
-        for (std::size_t i = 0; i < temp_dataTotal; ++i)
-        {
-            const auto t = i / blockSize_;
-            const auto u = i % blockSize_;
-            orderedData[i] = data_[t]->at(u);
-        }
-    }
-    return orderedData;
+    const auto& storage = *data_;
+    return readStorage<int64_t>(shape_, getOrder(), internalOrder_, [&storage](std::size_t i) {
+        return storage.getInt(i);
+    });
 }
 
 mv::DType mv::Tensor::getDType() const
 {
-    return get<DType>("dType");
+    static const AttrKey dTypeKey("dType");
+    return get<DType>(dTypeKey);
 }
 
 mv::Order mv::Tensor::getOrder() const
 {
-    return get<Order>("order");
+    static const AttrKey orderKey("order");
+    return get<Order>(orderKey);
 }
 
 std::string mv::Tensor::toString() const
@@ -1086,30 +1016,22 @@ bool mv::Tensor::elementWiseChecks_(const Tensor& other)
 
 void mv::Tensor::elementWiseInt_(const Tensor& other, const std::function<int64_t(int64_t, int64_t)>& opFunc)
 {
-    std::size_t firstIdx = 0;
-    while (firstIdx < data_.size())
-    {   //currently this function is not called anywhere, TODO: Transform function to align with data_ instead of blocks_
-        for (std::size_t secondIdx = 0; secondIdx < other.data_.size(); ++secondIdx)
-        {
-            std::transform(blocks_.at(firstIdx), blocks_.at(firstIdx) + blockSize_, other.blocks_.at(secondIdx), blocks_.at(firstIdx), opFunc);
-            ++firstIdx;
-        }
-    }
+    elementWiseChecks_(other);
 
+    // The other tensor is broadcasted over the leading dimensions of this one
+    const auto otherSize = other.data_->size();
+    for (std::size_t i = 0; i < data_->size(); ++i)
+        data_->set(i, opFunc(data_->getInt(i), other.data_->getInt(i % otherSize)));
 }
+
 void mv::Tensor::elementWiseDouble_(const Tensor& other, const std::function<double(double, double)>& opFunc)
 {
-    std::size_t firstIdx = 0;
-    while (firstIdx < data_.size())
-    {
-        //currently this function is not called anywhere, TODO: Transform function to align with data_ instead of blocks_
-        for (std::size_t secondIdx = 0; secondIdx < other.blocks_.size(); ++secondIdx)
-        {
-            std::transform(blocks_.at(firstIdx), blocks_.at(firstIdx) + blockSize_, other.blocks_.at(secondIdx), blocks_.at(firstIdx), opFunc);
-            ++firstIdx;
-        }
-    }
+    elementWiseChecks_(other);
 
+    // The other tensor is broadcasted over the leading dimensions of this one
+    const auto otherSize = other.data_->size();
+    for (std::size_t i = 0; i < data_->size(); ++i)
+        data_->set(i, opFunc(data_->getDouble(i), other.data_->getDouble(i % otherSize)));
 }
 
 void mv::Tensor::add(const Tensor& other)
@@ -1126,10 +1048,8 @@ void mv::Tensor::add(double val)
     MV_PROFILED_FUNCTION(MV_PROFILE_MATH)
     if (!isPopulated())
         throw ValueError(*this, "Unable to perfom scalar addition operation for an unpopulated tensor");
-    for(unsigned j = 0; j < data_.size(); ++j){
-        for (unsigned i = 0; i < blockSize_; ++i)
-            data_[j]->at(i) += val;
-    }
+    for (std::size_t i = 0; i < data_->size(); ++i)
+        DataElementRef(*data_, i) += val;
 }
 
 void mv::Tensor::subtract(const Tensor& other)
@@ -1148,10 +1068,8 @@ void mv::Tensor::subtract(double val)
     if (!isPopulated())
         throw ValueError(*this, "Unable to perfom scalar subtraction operation for an unpopulated tensor");
 
-    for (unsigned j = 0; j < data_.size(); ++j){
-        for (unsigned i = 0; i < blockSize_; ++i)
-            data_[j]->at(i) -= val;
-    }
+    for (std::size_t i = 0; i < data_->size(); ++i)
+        DataElementRef(*data_, i) -= val;
 }
 
 void mv::Tensor::multiply(const Tensor& other)
@@ -1169,10 +1087,8 @@ void mv::Tensor::multiply(double val)
     MV_PROFILED_FUNCTION(MV_PROFILE_MATH)
     if (!isPopulated())
         throw ValueError(*this, "Unable to perfom scalar multiplication operation for an unpopulated tensor");
-    for (unsigned j = 0; j < data_.size(); ++j){
-        for(unsigned i = 0; i < blockSize_; ++i)
-            data_[j]->at(i) *= val;
-    }
+    for (std::size_t i = 0; i < data_->size(); ++i)
+        DataElementRef(*data_, i) *= val;
 }
 
 void mv::Tensor::divide(double val)
@@ -1181,10 +1097,8 @@ void mv::Tensor::divide(double val)
     if (!isPopulated())
         throw ValueError(*this, "Unable to perfom scalar division operation for an unpopulated tensor");
 
-    for (unsigned j = 0; j < data_.size(); ++j){
-        for(unsigned i=0; i < blockSize_; ++i)
-            data_[j]->at(i) /= val;
-    }
+    for (std::size_t i = 0; i < data_->size(); ++i)
+        DataElementRef(*data_, i) /= val;
 
 }
 
@@ -1203,98 +1117,84 @@ void mv::Tensor::sqrt()
     MV_PROFILED_FUNCTION(MV_PROFILE_MATH)
     if (!isPopulated())
         throw ValueError(*this, "Unable to perfom scalar square root operation for an unpopulated tensor");
-    for (unsigned j = 0; j < data_.size(); ++j){
-        for(unsigned i=0; i<blockSize_; ++i){
-            if (isDoubleType())
-                data_[j]->at(i) = std::sqrt(static_cast<double>(data_[j]->at(i)));
-            else
-                data_[j]->at(i) = std::sqrt(static_cast<int64_t>(data_[j]->at(i)));
-        }
+    for (std::size_t i = 0; i < data_->size(); ++i)
+    {
+        if (isDoubleType())
+            data_->set(i, std::sqrt(data_->getDouble(i)));
+        else
+            data_->set(i, std::sqrt(data_->getInt(i)));
     }
 }
 
-mv::DataElement& mv::Tensor::at(const std::vector<std::size_t>& sub)
+mv::DataElementRef mv::Tensor::at(const std::vector<std::size_t>& sub)
 {
     if (!isPopulated())
         throw ValueError(*this, "Unable to access the data value for an unpopulated tensor");
 
-    auto idx = subToInd(sub);
-    auto b = idx/blockSize_;
-    auto d = idx%blockSize_;
-    return data_[b]->at(d);
+    return DataElementRef(*data_, subToInd(sub));
 }
 
-const mv::DataElement& mv::Tensor::at(const std::vector<std::size_t>& sub) const
+mv::DataElement mv::Tensor::at(const std::vector<std::size_t>& sub) const
 {
     if (!isPopulated())
         throw ValueError(*this, "Unable to access the data value for an unpopulated tensor");
 
-    auto idx = subToInd(sub);
-    auto b = idx/blockSize_;
-    auto d = idx%blockSize_;
-    return data_[b]->at(d);
+    return data_->get(subToInd(sub));
 }
 
-mv::DataElement& mv::Tensor::at(std::size_t idx)
+mv::DataElementRef mv::Tensor::at(std::size_t idx)
 {
-    return const_cast<DataElement&>(static_cast<const Tensor*>(this)->at(idx));
+    if (!isPopulated())
+        throw ValueError(*this, "Unable to access the data value for an unpopulated tensor");
+    if (idx >= data_->size())
+        throw IndexError(*this, idx, "Exceeds the total lenght of data vector");
+
+    return DataElementRef(*data_, storageIndex_(idx));
 }
 
-const mv::DataElement& mv::Tensor::at(std::size_t idx) const
+mv::DataElement mv::Tensor::at(std::size_t idx) const
 {
-
     if (!isPopulated())
         throw ValueError(*this, "Unable to access the data value for an unpopulated tensor");
-    auto temp_dataTotal = data_.size() * blockSize_;
-    if (idx > temp_dataTotal)
+    if (idx >= data_->size())
         throw IndexError(*this, idx, "Exceeds the total lenght of data vector");
 
-    if (hasAttr("master"))
-    {
-        std::vector<std::size_t> sub = indToSub(idx);
-        auto temp = subToInd(sub);
-        auto b = temp/blockSize_;
-        auto d = temp%blockSize_;
-        return data_[b]->at(d);
-    }
-
-    if (getOrder() == internalOrder_)
-    {
-        auto b = idx/blockSize_;
-        auto d = idx%blockSize_;
-
-        return data_[b]->at(d);
-    }
-    auto sub = getOrder().indToSub(shape_, idx);
-    auto temp = internalOrder_.subToInd(shape_, sub);
-    auto b = temp/blockSize_;
-    auto d = temp%blockSize_;
-    return data_[b]->at(d);
-
+    return data_->get(storageIndex_(idx));
 }
 
-mv::DataElement& mv::Tensor::operator()(std::size_t idx)
+mv::DataElementRef mv::Tensor::operator()(std::size_t idx)
 {
     return at(idx);
 }
 
-const mv::DataElement& mv::Tensor::operator()(std::size_t idx) const
+mv::DataElement mv::Tensor::operator()(std::size_t idx) const
 {
     return at(idx);
 }
 
-mv::DataElement& mv::Tensor::operator()(const std::vector<std::size_t>& sub)
+mv::DataElementRef mv::Tensor::operator()(const std::vector<std::size_t>& sub)
 {
     return at(sub);
 }
 
+mv::TensorStorage& mv::Tensor::getStorage()
+{
+    return const_cast<TensorStorage&>(static_cast<const Tensor*>(this)->getStorage());
+}
+
+const mv::TensorStorage& mv::Tensor::getStorage() const
+{
+    if (!isPopulated() || data_ == nullptr)
+        throw ValueError(*this, "Attempt of accessing storage of an unpopulated tensor");
+    return *data_;
+}
+
 mv::Tensor& mv::Tensor::operator=(const Tensor& other)
 {
     MV_PROFILED_FUNCTION(MV_PROFILE_BASE)
     Element::operator=(other);
     shape_ = other.shape_;
     internalOrder_ = other.internalOrder_;
-    blockSize_ = other.blockSize_;
     subTensors_ = other.subTensors_;
     kernelDataOffsets_ = other.kernelDataOffsets_;
 
@@ -1309,10 +1209,7 @@ mv::Tensor& mv::Tensor::operator=(const Tensor& other)
     }
 
     if (other.isPopulated())
-    {
         data_ = other.data_;
-        blocks_ = other.blocks_;
-    }
 
     if (other.isSparse()) {
         set<bool>("sparse", false);
@@ -1333,7 +1230,7 @@ mv::Tensor& mv::Tensor::operator=(const Tensor& other)
 
 }
 
-const mv::DataElement& mv::Tensor::operator()(const std::vector<std::size_t>& sub) const
+mv::DataElement mv::Tensor::operator()(const std::vector<std::size_t>& sub) const
 {
     return at(sub);
 }
@@ -0,0 +1,392 @@
+//
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache 2.0
+//
+#include "include/mcm/tensor/tensor_storage.hpp"
+#include "include/mcm/base/exception/argument_error.hpp"
+#include "include/mcm/base/exception/value_error.hpp"
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace {
+
+using ElementType = mv::TensorStorage::ElementType;
+
+template <typename T>
+T load(const uint8_t* bytes, std::size_t idx)
+{
+    T val;
+    std::memcpy(&val, bytes + idx * sizeof(T), sizeof(T));
+    return val;
+}
+
+template <typename T>
+void store(uint8_t* bytes, std::size_t idx, T val)
+{
+    std::memcpy(bytes + idx * sizeof(T), &val, sizeof(T));
+}
+
+template <typename T>
+bool fitsInt(int64_t val)
+{
+    return val >= static_cast<int64_t>(std::numeric_limits<T>::lowest()) &&
+        val <= static_cast<int64_t>(std::numeric_limits<T>::max());
+}
+
+bool fits(ElementType type, int64_t val)
+{
+    switch (type)
+    {
+        case ElementType::Int8:
+            return fitsInt<int8_t>(val);
+        case ElementType::UInt8:
+            return fitsInt<uint8_t>(val);
+        case ElementType::Int16:
+            return fitsInt<int16_t>(val);
+        case ElementType::UInt16:
+            return fitsInt<uint16_t>(val);
+        case ElementType::Int32:
+            return fitsInt<int32_t>(val);
+        default:
+            return true;
+    }
+}
+
+bool fits(ElementType type, double val)
+{
+    if (type == ElementType::Float32)
+        return std::isnan(val) || static_cast<double>(static_cast<float>(val)) == val;
+    return true;
+}
+
+}  // namespace
+
+mv::TensorStorage::ElementType mv::TensorStorage::compactElementType(const DType& dType, bool isDouble)
+{
+    const auto name = dType.toString();
+
+    if (isDouble)
+    {
+        // Float16 / BFloat16 data held as doubles is the not yet converted FP32 data
+        if (name == "Float32" || name == "Float16" || name == "BFloat16")
+            return ElementType::Float32;
+        return ElementType::Float64;
+    }
+
+    if (name == "UInt8")
+        return ElementType::UInt8;
+    if (name == "Int8" || name == "Int4" || name == "Int2")
+        return ElementType::Int8;
+    if (name == "UInt16" || name == "Float16" || name == "BFloat16")
+        return ElementType::UInt16;
+    if (name == "Int16")
+        return ElementType::Int16;
+    if (name == "Int32")
+        return ElementType::Int32;
+    return ElementType::Int64;
+}
+
+std::size_t mv::TensorStorage::elementSize(ElementType type)
+{
+    switch (type)
+    {
+        case ElementType::Int8:
+        case ElementType::UInt8:
+            return 1;
+        case ElementType::Int16:
+        case ElementType::UInt16:
+            return 2;
+        case ElementType::Int32:
+        case ElementType::Float32:
+            return 4;
+        default:
+            return 8;
+    }
+}
+
+std::string mv::TensorStorage::toString(ElementType type)
+{
+    switch (type)
+    {
+        case ElementType::Int8:
+            return "Int8";
+        case ElementType::UInt8:
+            return "UInt8";
+        case ElementType::Int16:
+            return "Int16";
+        case ElementType::UInt16:
+            return "UInt16";
+        case ElementType::Int32:
+            return "Int32";
+        case ElementType::Int64:
+            return "Int64";
+        case ElementType::Float32:
+            return "Float32";
+        default:
+            return "Float64";
+    }
+}
+
+mv::TensorStorage::TensorStorage(std::size_t size, bool isDouble, ElementType type) :
+isDouble_(isDouble),
+type_(type),
+size_(size),
+bytes_(size * elementSize(type), 0)
+{
+    const bool isDoubleType = type == ElementType::Float32 || type == ElementType::Float64;
+    if (isDoubleType != isDouble)
+        throw ArgumentError(*this, "elementType", toString(type), "Element type does not match the storage kind");
+}
+
+int64_t mv::TensorStorage::getInt(std::size_t idx) const
+{
+    switch (type_)
+    {
+        case ElementType::Int8:
+            return load<int8_t>(bytes_.data(), idx);
+        case ElementType::UInt8:
+            return load<uint8_t>(bytes_.data(), idx);
+        case ElementType::Int16:
+            return load<int16_t>(bytes_.data(), idx);
+        case ElementType::UInt16:
+            return load<uint16_t>(bytes_.data(), idx);
+        case ElementType::Int32:
+            return load<int32_t>(bytes_.data(), idx);
+        case ElementType::Int64:
+            return load<int64_t>(bytes_.data(), idx);
+        case ElementType::Float32:
+            return static_cast<int64_t>(load<float>(bytes_.data(), idx));
+        default:
+            return static_cast<int64_t>(load<double>(bytes_.data(), idx));
+    }
+}
+
+double mv::TensorStorage::getDouble(std::size_t idx) const
+{
+    switch (type_)
+    {
+        case ElementType::Float32:
+            return load<float>(bytes_.data(), idx);
+        case ElementType::Float64:
+            return load<double>(bytes_.data(), idx);
+        default:
+            return static_cast<double>(getInt(idx));
+    }
+}
+
+mv::DataElement mv::TensorStorage::get(std::size_t idx) const
+{
+    if (isDouble_)
+        return DataElement(true, getDouble(idx));
+    return DataElement(false, getInt(idx));
+}
+
+void mv::TensorStorage::set(std::size_t idx, int64_t val)
+{
+    if (isDouble_)
+    {
+        set(idx, static_cast<double>(val));
+        return;
+    }
+
+    if (!fits(type_, val))
+        convert(ElementType::Int64);
+
+    switch (type_)
+    {
+        case ElementType::Int8:
+            store(bytes_.data(), idx, static_cast<int8_t>(val));
+            break;
+        case ElementType::UInt8:
+            store(bytes_.data(), idx, static_cast<uint8_t>(val));
+            break;
+        case ElementType::Int16:
+            store(bytes_.data(), idx, static_cast<int16_t>(val));
+            break;
+        case ElementType::UInt16:
+            store(bytes_.data(), idx, static_cast<uint16_t>(val));
+            break;
+        case ElementType::Int32:
+            store(bytes_.data(), idx, static_cast<int32_t>(val));
+            break;
+        default:
+            store(bytes_.data(), idx, val);
+            break;
+    }
+}
+
+void mv::TensorStorage::set(std::size_t idx, double val)
+{
+    if (!isDouble_)
+    {
+        // Same truncation as DataElement of integer kind
+        set(idx, static_cast<int64_t>(val));
+        return;
+    }
+
+    if (!fits(type_, val))
+        convert(ElementType::Float64);
+
+    if (type_ == ElementType::Float32)
+        store(bytes_.data(), idx, static_cast<float>(val));
+    else
+        store(bytes_.data(), idx, val);
+}
+
+void mv::TensorStorage::set(std::size_t idx, const DataElement& val)
+{
+    if (val.isDouble())
+        set(idx, static_cast<double>(val));
+    else
+        set(idx, static_cast<int64_t>(val));
+}
+
+void mv::TensorStorage::resize(std::size_t size)
+{
+    size_ = size;
+    bytes_.resize(size * elementSize(type_), 0);
+}
+
+void mv::TensorStorage::convert(ElementType type)
+{
+    if (type == type_)
+        return;
+
+    TensorStorage converted(size_, isDouble_, type);
+    for (std::size_t i = 0; i < size_; ++i)
+    {
+        if (isDouble_)
+        {
+            const auto val = getDouble(i);
+            if (!fits(type, val))
+                throw ValueError(*this, "Unable to convert storage to " + toString(type) + ", value " +
+                    std::to_string(val) + " does not fit");
+            converted.set(i, val);
+        }
+        else
+        {
+            const auto val = getInt(i);
+            if (!fits(type, val))
+                throw ValueError(*this, "Unable to convert storage to " + toString(type) + ", value " +
+                    std::to_string(val) + " does not fit");
+            converted.set(i, val);
+        }
+    }
+
+    type_ = type;
+    bytes_.swap(converted.bytes_);
+}
+
+bool mv::TensorStorage::shrink(ElementType type)
+{
+    if (type == type_ || elementSize(type) >= elementSize(type_))
+        return false;
+
+    for (std::size_t i = 0; i < size_; ++i)
+    {
+        const auto fitsType = isDouble_ ? fits(type, getDouble(i)) : fits(type, getInt(i));
+        if (!fitsType)
+            return false;
+    }
+
+    convert(type);
+    return true;
+}
+
+void mv::TensorStorage::checkSpanType_(ElementType type) const
+{
+    if (type != type_)
+        throw ArgumentError(*this, "spanType", toString(type), "Storage element type is " + toString(type_));
+}
+
+std::string mv::TensorStorage::getLogID() const
+{
+    return "TensorStorage";
+}
+
+mv::DataElementRef::DataElementRef(TensorStorage& storage, std::size_t idx) :
+DataElement(storage.get(idx)),
+storage_(&storage),
+idx_(idx)
+{
+}
+
+mv::DataElementRef& mv::DataElementRef::store_()
+{
+    storage_->set(idx_, static_cast<const DataElement&>(*this));
+    return *this;
+}
+
+mv::DataElementRef& mv::DataElementRef::operator=(const DataElementRef& other)
+{
+    DataElement::operator=(static_cast<const DataElement&>(other));
+    return store_();
+}
+
+mv::DataElementRef& mv::DataElementRef::operator=(const DataElement& val)
+{
+    DataElement::operator=(val);
+    return store_();
+}
+
+mv::DataElementRef& mv::DataElementRef::operator=(int64_t val)
+{
+    DataElement::operator=(val);
+    return store_();
+}
+
+mv::DataElementRef& mv::DataElementRef::operator=(double val)
+{
+    DataElement::operator=(val);
+    return store_();
+}
+
+mv::DataElementRef& mv::DataElementRef::operator+=(int64_t val)
+{
+    DataElement::operator+=(val);
+    return store_();
+}
+
+mv::DataElementRef& mv::DataElementRef::operator+=(double val)
+{
+    DataElement::operator+=(val);
+    return store_();
+}
+
+mv::DataElementRef& mv::DataElementRef::operator-=(int64_t val)
+{
+    DataElement::operator-=(val);
+    return store_();
+}
+
+mv::DataElementRef& mv::DataElementRef::operator-=(double val)
+{
+    DataElement::operator-=(val);
+    return store_();
+}
+
+mv::DataElementRef& mv::DataElementRef::operator*=(int64_t val)
+{
+    DataElement::operator*=(val);
+    return store_();
+}
+
+mv::DataElementRef& mv::DataElementRef::operator*=(double val)
+{
+    DataElement::operator*=(val);
+    return store_();
+}
+
+mv::DataElementRef& mv::DataElementRef::operator/=(int64_t val)
+{
+    DataElement::operator/=(val);
+    return store_();
+}
+
+mv::DataElementRef& mv::DataElementRef::operator/=(double val)
+{
+    DataElement::operator/=(val);
+    return store_();
+}
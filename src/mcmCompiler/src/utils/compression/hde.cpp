@@ -7,7 +7,13 @@
 
 namespace mv
 {
-Hde::Hde(uint32_t bitPerSymbol, uint32_t maxNumberEncodedSymbols, uint32_t verbosity, uint32_t blockSize, bool pStatsOnly, uint32_t bypassMode)
+Hde::Hde(uint32_t bitPerSymbol, uint32_t maxNumberEncodedSymbols, uint32_t verbosity, uint32_t blockSize, bool pStatsOnly, uint32_t bypassMode) :
+bitPerSymbol_(bitPerSymbol),
+maxNumberEncodedSymbols_(maxNumberEncodedSymbols),
+verbosity_(verbosity),
+blockSize_(blockSize),
+pStatsOnly_(pStatsOnly),
+bypassMode_(bypassMode)
 {
     codec_.reset(new huffmanCodec(bitPerSymbol, maxNumberEncodedSymbols, verbosity, blockSize, pStatsOnly, bypassMode));
 }
@@ -86,4 +92,10 @@ std::vector<uint8_t> Hde::decompress(std::vector<uint8_t>& compressedData)
 
     return deCompressedDataBuffer;
 }
+
+std::unique_ptr<Compressor> Hde::clone() const
+{
+    return std::unique_ptr<Compressor>(new Hde(bitPerSymbol_, maxNumberEncodedSymbols_, verbosity_, blockSize_,
+        pStatsOnly_, bypassMode_));
+}
 }
@@ -0,0 +1,203 @@
+//
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache 2.0
+//
+#include "gtest/gtest.h"
+#include "include/mcm/base/element.hpp"
+#include "include/mcm/base/attribute_store.hpp"
+
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST(attribute_store, interning)
+{
+    mv::AttrKey first("attrStoreTestKey");
+    mv::AttrKey second(std::string("attrStoreTestKey"));
+    mv::AttrKey other("attrStoreTestOtherKey");
+
+    ASSERT_TRUE(first.valid());
+    ASSERT_EQ(first, second);
+    ASSERT_NE(first, other);
+    ASSERT_EQ(first.name(), "attrStoreTestKey");
+
+    ASSERT_EQ(mv::AttrKey::find("attrStoreTestKey"), first);
+    ASSERT_FALSE(mv::AttrKey::find("attrStoreTestNeverInterned").valid());
+    ASSERT_FALSE(mv::AttrKey().valid());
+}
+
+TEST(attribute_store, key_and_name_access)
+{
+    mv::Element e("e");
+    static const mv::AttrKey key("aInt");
+
+    e.set<int>(key, 1);
+    ASSERT_TRUE(e.hasAttr("aInt"));
+    ASSERT_EQ(e.get<int>("aInt"), 1);
+
+    e.set<int>("aInt", 2);
+    ASSERT_TRUE(e.hasAttr(key));
+    ASSERT_EQ(e.get<int>(key), 2);
+    ASSERT_EQ(e.attrsCount(), 1u);
+
+    e.erase(key);
+    ASSERT_FALSE(e.hasAttr("aInt"));
+    ASSERT_ANY_THROW(e.get<int>(key));
+    ASSERT_ANY_THROW(e.erase("attrStoreTestNeverInterned"));
+}
+
+TEST(attribute_store, sorted_order)
+{
+    mv::Element e("e");
+    e.set<int>("c", 3);
+    e.set<int>("a", 1);
+    e.set<int>("b", 2);
+
+    std::vector<std::string> expected = {"a", "b", "c"};
+    ASSERT_EQ(e.attrsKeys(), expected);
+
+    auto attrs = e.getAttrs({"b"});
+    ASSERT_EQ(attrs.size(), 2u);
+    ASSERT_EQ(attrs.begin()->first, "a");
+}
+
+TEST(attribute_store, copy_is_deep)
+{
+    mv::Element e("e");
+    e.set<int>("aInt", 1);
+
+    mv::Element copy(e);
+    copy.set<int>("aInt", 2);
+    copy.set<bool>("aBool", true);
+
+    ASSERT_EQ(e.get<int>("aInt"), 1);
+    ASSERT_FALSE(e.hasAttr("aBool"));
+
+    e = copy;
+    ASSERT_EQ(e.get<int>("aInt"), 2);
+    ASSERT_TRUE(e.hasAttr("aBool"));
+}
+
+TEST(attribute_store, reference_stability)
+{
+    mv::Element e("e");
+    e.set<int>("aInt", 1);
+    int& value = e.get<int>("aInt");
+
+    for (int i = 0; i < 64; ++i)
+        e.set<int>("attr" + std::to_string(i), i);
+
+    value = 5;
+    ASSERT_EQ(e.get<int>("aInt"), 5);
+}
+
+TEST(attribute_store, find_after_interning)
+{
+    // A failed lookup must not hide the name interned afterwards
+    ASSERT_FALSE(mv::AttrKey::find("attrStoreTestLateKey").valid());
+
+    mv::AttrKey key("attrStoreTestLateKey");
+    ASSERT_EQ(mv::AttrKey::find("attrStoreTestLateKey"), key);
+    ASSERT_EQ(mv::AttrKey::find("attrStoreTestLateKey").name(), "attrStoreTestLateKey");
+}
+
+TEST(attribute_store, concurrent_interning)
+{
+    constexpr int numThreads = 4;
+    constexpr int numNames = 256;
+
+    std::vector<std::vector<mv::AttrKey>> keys(numThreads);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < numThreads; ++t)
+        threads.emplace_back([t, &keys]()
+        {
+            for (int i = 0; i < numNames; ++i)
+            {
+                const auto name = "attrStoreTestConcurrent" + std::to_string(i);
+                mv::AttrKey key(name);
+                if (mv::AttrKey::find(name) != key || key.name() != name)
+                    return;
+                keys[t].push_back(key);
+            }
+        });
+    for (auto& thread : threads)
+        thread.join();
+
+    for (int t = 0; t < numThreads; ++t)
+        ASSERT_EQ(keys[t], keys[0]) << "thread " << t;
+    ASSERT_EQ(keys[0].size(), static_cast<std::size_t>(numNames));
+}
+
+// A compile-like workload over a model sized element population: the lookups by name and by key the passes do,
+// the element copies done on op and tensor cloning and the sorted attribute maps built for op construction and dumps.
+// TODO create separate target for performance tests
+TEST(attribute_store_perf, DISABLED_model_workload)
+{
+    constexpr int numElements = 4000;
+    constexpr int numPasses = 200;
+
+    const std::vector<std::string> names = {"dType", "order", "populated", "quantParams", "splitStrategy",
+        "sparse", "broadcasted", "address", "Location", "allocators", "opType", "strategy", "splitted",
+        "flows", "workloads", "schedulingNumber", "layerNumber", "taskOp", "hasWeights", "inputs", "outputs",
+        "lifetime", "soh", "streaming"};
+
+    std::vector<mv::Element> elements;
+    elements.reserve(numElements);
+    for (int i = 0; i < numElements; ++i)
+    {
+        elements.emplace_back("e" + std::to_string(i));
+        for (std::size_t a = 0; a < names.size(); ++a)
+            elements.back().set<int>(names[a], static_cast<int>(a) + i);
+    }
+
+    const auto measureMs = [](const std::function<int64_t()>& func)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        const auto checksum = func();
+        const auto end = std::chrono::steady_clock::now();
+        EXPECT_GT(checksum, 0);
+        return std::chrono::duration<double, std::milli>(end - start).count();
+    };
+
+    const auto byNameMs = measureMs([&]()
+    {
+        int64_t sum = 0;
+        for (int pass = 0; pass < numPasses; ++pass)
+            for (const auto& e : elements)
+                sum += e.hasAttr("populated") ? e.get<int>("populated") : 0;
+        return sum;
+    });
+    const auto byKeyMs = measureMs([&]()
+    {
+        static const mv::AttrKey key("populated");
+        int64_t sum = 0;
+        for (int pass = 0; pass < numPasses; ++pass)
+            for (const auto& e : elements)
+                sum += e.hasAttr(key) ? e.get<int>(key) : 0;
+        return sum;
+    });
+    const auto copyMs = measureMs([&]()
+    {
+        int64_t sum = 0;
+        for (const auto& e : elements)
+        {
+            mv::Element copy(e);
+            sum += copy.attrsCount();
+        }
+        return sum;
+    });
+    const auto sortedMapMs = measureMs([&]()
+    {
+        int64_t sum = 0;
+        for (const auto& e : elements)
+            sum += e.getAttrs().size();
+        return sum;
+    });
+
+    std::cout << "Attribute store, " << numElements << " elements with " << names.size() << " attributes: "
+              << numPasses << " lookup passes by name " << byNameMs << " ms, by key " << byKeyMs << " ms; "
+              << "copy " << copyMs << " ms; sorted maps " << sortedMapMs << " ms" << std::endl;
+}
@@ -0,0 +1,80 @@
+//
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache 2.0
+//
+#include "gtest/gtest.h"
+#include "include/mcm/pass/graphOptimizations/strategy_encoding.hpp"
+#include "include/mcm/tensor/shape.hpp"
+
+using mv::graphOptimizer::StrategyEncoding;
+using mv::graphOptimizer::StrategyEncodingHash;
+
+namespace
+{
+
+StrategyEncoding::StrategySet makeStrategy(const std::string& name, int id, const std::string& clustering,
+    bool spilling, const mv::Shape& streaming)
+{
+    StrategyEncoding::StrategySet s;
+    s["name"] = name;
+    s["id"] = id;
+    s["inputSparsity"] = false;
+    s["outputSparsity"] = true;
+    s["weightsSparsity"] = false;
+    s["spilling"] = spilling;
+    s["clustering"] = clustering;
+    s["streaming"] = streaming;
+    return s;
+}
+
+}
+
+TEST(strategy_encoding, identifying_fields_ignored)
+{
+    auto first = StrategyEncoding::encode(makeStrategy("conv0", 1, "SplitOverK", false, {1, 1, 1, 4, 1}));
+    auto second = StrategyEncoding::encode(makeStrategy("conv1", 2, "SplitOverK", false, {1, 1, 1, 4, 1}));
+    auto other = StrategyEncoding::encode(makeStrategy("conv1", 3, "SplitOverK", true, {1, 1, 1, 4, 1}));
+
+    ASSERT_TRUE(first.valid);
+    ASSERT_EQ(first, second);
+    ASSERT_EQ(StrategyEncodingHash()(first), StrategyEncodingHash()(second));
+    ASSERT_NE(first, other);
+}
+
+TEST(strategy_encoding, round_trip)
+{
+    auto strategy = makeStrategy("eltwise0", 7, "HKSwitch", true, {1, 2, 1, 3, 1});
+    strategy["eltwiseParentSpilling"] = false;
+
+    auto encoding = StrategyEncoding::encode(strategy);
+    ASSERT_TRUE(encoding.valid);
+    ASSERT_EQ(encoding.clustering, StrategyEncoding::Clustering::HKSwitch);
+    ASSERT_TRUE(encoding.hasFlag(StrategyEncoding::HasEltwiseParentSpilling));
+    ASSERT_FALSE(encoding.hasFlag(StrategyEncoding::EltwiseParentSpilling));
+
+    StrategyEncoding::StrategySet decoded;
+    decoded["name"] = std::string("eltwise0");
+    decoded["id"] = 7;
+    encoding.decode(decoded);
+
+    ASSERT_EQ(decoded.size(), strategy.size());
+    for (const auto& field : strategy)
+        ASSERT_EQ(decoded.at(field.first).toString(), field.second.toString()) << field.first;
+}
+
+TEST(strategy_encoding, unrepresented_strategy_is_invalid)
+{
+    auto unknownField = makeStrategy("conv0", 1, "SplitOverH", false, {1, 1, 1, 1, 1});
+    unknownField["pipelining"] = true;
+    ASSERT_FALSE(StrategyEncoding::encode(unknownField).valid);
+
+    auto unknownClustering = makeStrategy("conv0", 1, "SplitOverW", false, {1, 1, 1, 1, 1});
+    ASSERT_FALSE(StrategyEncoding::encode(unknownClustering).valid);
+
+    auto missingField = makeStrategy("conv0", 1, "Clustering", false, {1, 1, 1, 1, 1});
+    missingField.erase("weightsSparsity");
+    ASSERT_FALSE(StrategyEncoding::encode(missingField).valid);
+
+    auto wrongStreaming = makeStrategy("conv0", 1, "Clustering", false, {1, 1, 1, 1});
+    ASSERT_FALSE(StrategyEncoding::encode(wrongStreaming).valid);
+}
@@ -0,0 +1,113 @@
+//
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache 2.0
+//
+#include "gtest/gtest.h"
+#include "include/mcm/tensor/tensor.hpp"
+#include "include/mcm/tensor/tensor_storage.hpp"
+
+#include <numeric>
+
+TEST(tensor_storage, compact_element_type)
+{
+    using ElementType = mv::TensorStorage::ElementType;
+
+    ASSERT_EQ(mv::TensorStorage::compactElementType(mv::DType("UInt8"), false), ElementType::UInt8);
+    ASSERT_EQ(mv::TensorStorage::compactElementType(mv::DType("Int8"), false), ElementType::Int8);
+    ASSERT_EQ(mv::TensorStorage::compactElementType(mv::DType("Float16"), false), ElementType::UInt16);
+    ASSERT_EQ(mv::TensorStorage::compactElementType(mv::DType("Int32"), false), ElementType::Int32);
+    ASSERT_EQ(mv::TensorStorage::compactElementType(mv::DType("Int64"), false), ElementType::Int64);
+    ASSERT_EQ(mv::TensorStorage::compactElementType(mv::DType("Float32"), true), ElementType::Float32);
+    ASSERT_EQ(mv::TensorStorage::compactElementType(mv::DType("Float64"), true), ElementType::Float64);
+}
+
+TEST(tensor_storage, widen_on_overflow)
+{
+    mv::TensorStorage storage(4, false, mv::TensorStorage::ElementType::UInt8);
+    storage.set(0, int64_t(255));
+    ASSERT_EQ(storage.getElementType(), mv::TensorStorage::ElementType::UInt8);
+
+    storage.set(1, int64_t(-1));
+    ASSERT_EQ(storage.getElementType(), mv::TensorStorage::ElementType::Int64);
+    ASSERT_EQ(storage.getInt(0), 255);
+    ASSERT_EQ(storage.getInt(1), -1);
+
+    mv::TensorStorage doubleStorage(2, true, mv::TensorStorage::ElementType::Float32);
+    doubleStorage.set(0, 0.5);
+    ASSERT_EQ(doubleStorage.getElementType(), mv::TensorStorage::ElementType::Float32);
+    doubleStorage.set(1, 0.1);
+    ASSERT_EQ(doubleStorage.getElementType(), mv::TensorStorage::ElementType::Float64);
+    ASSERT_EQ(doubleStorage.getDouble(0), 0.5);
+    ASSERT_EQ(doubleStorage.getDouble(1), 0.1);
+}
+
+TEST(tensor_storage, shrink)
+{
+    mv::TensorStorage storage(3, false, mv::TensorStorage::ElementType::Int64);
+    storage.set(0, int64_t(1));
+    storage.set(1, int64_t(200));
+    ASSERT_FALSE(storage.shrink(mv::TensorStorage::ElementType::Int8));
+    ASSERT_TRUE(storage.shrink(mv::TensorStorage::ElementType::UInt8));
+    ASSERT_EQ(storage.getSizeInBytes(), 3u);
+    ASSERT_EQ(storage.getInt(1), 200);
+}
+
+TEST(tensor_storage, u8_tensor_is_compact)
+{
+    mv::Shape shape({3, 3, 16, 32});
+    std::vector<int64_t> data(shape.totalSize());
+    for (std::size_t i = 0; i < data.size(); ++i)
+        data[i] = i % 256;
+
+    mv::Tensor t("t", shape, mv::DType("UInt8"), mv::Order("NCHW"), data);
+
+    const auto& storage = t.getStorage();
+    ASSERT_EQ(storage.getSizeInBytes(), shape.totalSize());
+
+    auto span = t.getDataSpan<uint8_t>();
+    ASSERT_EQ(span.size(), shape.totalSize());
+    ASSERT_TRUE(std::equal(span.begin(), span.end(), data.begin()));
+    ASSERT_EQ(t.getIntData(), data);
+}
+
+TEST(tensor_storage, data_element_view)
+{
+    mv::Shape shape({4, 4});
+    std::vector<int64_t> data(shape.totalSize());
+    std::iota(data.begin(), data.end(), 0);
+
+    mv::Tensor t("t", shape, mv::DType("UInt8"), mv::Order("HW"), data);
+    mv::Tensor copy(t);
+
+    t.at(5) = int64_t(100);
+    t.at(6) += int64_t(300);
+    t(7) = t.at(5);
+
+    ASSERT_EQ(static_cast<int64_t>(t.at(5)), 100);
+    ASSERT_EQ(static_cast<int64_t>(t.at(6)), 306);
+    ASSERT_EQ(static_cast<int64_t>(t.at(7)), 100);
+
+    // The copies share the populated data
+    ASSERT_EQ(static_cast<int64_t>(copy.at(6)), 306);
+
+    const mv::Tensor& constRef = t;
+    const mv::DataElement& val = constRef.at(6);
+    ASSERT_FALSE(val.isDouble());
+    ASSERT_EQ(static_cast<int64_t>(val), 306);
+}
+
+TEST(tensor_storage, double_tensor_reorder)
+{
+    mv::Shape shape({2, 3, 4, 1});
+    std::vector<double> data(shape.totalSize());
+    for (std::size_t i = 0; i < data.size(); ++i)
+        data[i] = i * 0.25;
+
+    mv::Tensor t("t", shape, mv::DType("Float32"), mv::Order("NCHW"), data);
+    ASSERT_EQ(t.getStorage().getElementType(), mv::TensorStorage::ElementType::Float32);
+    ASSERT_EQ(t.getDoubleData(), data);
+
+    t.multiply(2.0);
+    for (std::size_t i = 0; i < data.size(); ++i)
+        ASSERT_EQ(static_cast<double>(t.at(i)), data[i] * 2.0);
+}
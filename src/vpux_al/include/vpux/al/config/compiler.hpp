@@ -164,4 +164,70 @@ struct CUSTOM_LAYERS final : OptionBase<CUSTOM_LAYERS, std::string> {
     }
 };
 
+//
+// COMPILATION_CACHE_DIR
+//
+
+struct COMPILATION_CACHE_DIR final : OptionBase<COMPILATION_CACHE_DIR, std::string> {
+    static StringRef key() {
+        return ov::intel_vpux::compilation_cache_dir.name();
+    }
+
+    static std::string defaultValue() {
+        return {};
+    }
+
+    static OptionMode mode() {
+        return OptionMode::CompileTime;
+    }
+
+    static bool isPublic() {
+        return false;
+    }
+};
+
+//
+// COMPILATION_CACHE_SIZE
+//
+
+struct COMPILATION_CACHE_SIZE final : OptionBase<COMPILATION_CACHE_SIZE, int64_t> {
+    static StringRef key() {
+        return ov::intel_vpux::compilation_cache_size.name();
+    }
+
+    static int64_t defaultValue() {
+        return 1LL << 30;
+    }
+
+    static OptionMode mode() {
+        return OptionMode::CompileTime;
+    }
+
+    static bool isPublic() {
+        return false;
+    }
+};
+
+//
+// CONST_FOLDING_CACHE_SIZE
+//
+
+struct CONST_FOLDING_CACHE_SIZE final : OptionBase<CONST_FOLDING_CACHE_SIZE, int64_t> {
+    static StringRef key() {
+        return ov::intel_vpux::const_folding_cache_size.name();
+    }
+
+    static int64_t defaultValue() {
+        return 0;
+    }
+
+    static OptionMode mode() {
+        return OptionMode::CompileTime;
+    }
+
+    static bool isPublic() {
+        return false;
+    }
+};
+
 }  // namespace vpux
@@ -403,6 +403,28 @@ struct PROFILING_OUTPUT_FILE final : OptionBase<PROFILING_OUTPUT_FILE, std::stri
     }
 };
 
+//
+// IMPORT_BLOB_MMAP
+//
+
+struct IMPORT_BLOB_MMAP final : OptionBase<IMPORT_BLOB_MMAP, bool> {
+    static StringRef key() {
+        return ov::intel_vpux::import_blob_mmap.name();
+    }
+
+    static bool defaultValue() {
+        return false;
+    }
+
+    static bool isPublic() {
+        return false;
+    }
+
+    static OptionMode mode() {
+        return OptionMode::RunTime;
+    }
+};
+
 //
 // MODEL_PRIORITY
 //
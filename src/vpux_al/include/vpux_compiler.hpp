@@ -19,6 +19,8 @@
 #include "vpux/utils/core/preprocessing.hpp"
 #include "vpux/utils/core/quant_params.hpp"
 
+#include "vpux_mapped_blob.hpp"
+
 namespace vpux {
 
 class ICompiler;
@@ -282,6 +284,19 @@ public:
     virtual std::shared_ptr<vpux::INetworkDescription> parse(std::istream& stream, const Config& config,
                                                              const std::string& netName);
 
+    /**
+     * @brief Parses already compiled network, which is memory-mapped from a file
+     * @param blob read-only mapping of the compiled network
+     * @param config a reference to VPUXConfig containing plugin config options
+     * @param netName a reference to the string describing network name
+     *        to be used for creating network description
+     * @return a shared pointer on an object implementing INetworkDescription interface
+     * @note The default implementation copies the blob, compilers able to work
+     *       with the mapping directly should keep the pointer instead
+     */
+    virtual std::shared_ptr<vpux::INetworkDescription> parse(const MappedBlob::Ptr& blob, const Config& config,
+                                                             const std::string& netName);
+
 protected:
     ~ICompiler() = default;
 };
@@ -333,6 +348,11 @@ public:
         return std::make_shared<NetworkDescription>(_impl->parse(stream, config, graphName), _impl);
     }
 
+    std::shared_ptr<vpux::NetworkDescription> parse(const MappedBlob::Ptr& blob, const Config& config,
+                                                    const std::string& graphName) {
+        return std::make_shared<NetworkDescription>(_impl->parse(blob, config, graphName), _impl);
+    }
+
 private:
     std::shared_ptr<ICompiler> _impl;
 
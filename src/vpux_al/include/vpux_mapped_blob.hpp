@@ -0,0 +1,82 @@
+//
+// Copyright (C) 2022 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace vpux {
+
+/**
+ * @brief Read-only memory mapping of a compiled network file
+ * The export header written by the plugin (magic and network name) is skipped,
+ * so data() points directly to the compiled blob.
+ * Mappings are shared by all users of the same file (same path, size and modification time),
+ * which allows several networks imported from one model to reference the same pages.
+ * @note The file must not be modified while it is mapped.
+ */
+class MappedBlob final {
+public:
+    using Ptr = std::shared_ptr<const MappedBlob>;
+
+    /**
+     * @brief Maps the file or returns the mapping that already exists for it
+     * @param filename path to the compiled network file
+     * @return a shared pointer on the read-only mapping, throws on failure
+     */
+    static Ptr open(const std::string& filename);
+
+    ~MappedBlob();
+
+    MappedBlob(const MappedBlob&) = delete;
+    MappedBlob& operator=(const MappedBlob&) = delete;
+
+    const char* data() const {
+        return static_cast<const char*>(_mapping) + _offset;
+    }
+    std::size_t size() const {
+        return _mappingSize - _offset;
+    }
+
+    const std::string& getFileName() const {
+        return _fileName;
+    }
+
+private:
+    struct FileInfo final {
+        std::size_t size = 0;
+        int64_t modificationTime = 0;
+
+        bool operator==(const FileInfo& other) const {
+            return size == other.size && modificationTime == other.modificationTime;
+        }
+    };
+
+    static FileInfo getFileInfo(const std::string& filename);
+
+    MappedBlob(const std::string& filename, const FileInfo& info);
+
+    void unmap();
+
+private:
+    std::string _fileName;
+    FileInfo _fileInfo;
+
+    void* _mapping = nullptr;
+    std::size_t _mappingSize = 0;
+    std::size_t _offset = 0;
+
+#ifdef _WIN32
+    void* _fileHandle = nullptr;
+    void* _mappingHandle = nullptr;
+#endif
+};
+
+}  // namespace vpux
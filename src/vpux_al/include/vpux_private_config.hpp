@@ -196,5 +196,34 @@ DECLARE_VPUX_CONFIG_VALUE(JSON);
  */
 DECLARE_VPUX_CONFIG_KEY(PROFILING_OUTPUT_FILE);
 
+/**
+ * @brief [Only for VPUX Plugin]
+ * Type: "YES", "NO", default is "NO"
+ * Import network from file through a read-only memory mapping instead of reading it into memory.
+ * The file must not be modified while networks imported from it exist.
+ */
+DECLARE_VPUX_CONFIG_KEY(IMPORT_BLOB_MMAP);
+
+/**
+ * @brief [Only for VPUX compiler]
+ * Type: std::string, default is empty (the cache is disabled).
+ * Directory of the on-disk cache of the compiled blobs.
+ */
+DECLARE_VPUX_CONFIG_KEY(COMPILATION_CACHE_DIR);
+
+/**
+ * @brief [Only for VPUX compiler]
+ * Type: integer, default is 1073741824 (1 GiB).
+ * Size limit of the compilation cache directory in bytes, 0 means no limit.
+ */
+DECLARE_VPUX_CONFIG_KEY(COMPILATION_CACHE_SIZE);
+
+/**
+ * @brief [Only for VPUX compiler]
+ * Type: integer, default is 0 (the cache is disabled).
+ * Size limit in bytes of the in-memory cache of folded constants, shared by the compilations of one compiler instance.
+ */
+DECLARE_VPUX_CONFIG_KEY(CONST_FOLDING_CACHE_SIZE);
+
 }  // namespace VPUXConfigParams
 }  // namespace InferenceEngine
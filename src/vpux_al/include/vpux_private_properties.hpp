@@ -350,5 +350,38 @@ static constexpr ov::Property<InferenceEngine::VPUXConfigParams::ProfilingOutput
  */
 static constexpr ov::Property<std::string> profiling_output_file{"VPUX_PROFILING_OUTPUT_FILE"};
 
+/**
+ * @brief [Only for VPUX Plugin]
+ * Type: "YES", "NO", default is "NO"
+ * Import network from file through a read-only memory mapping instead of reading it into memory.
+ * Networks imported from the same file share the mapped pages.
+ * The file must not be modified while networks imported from it exist.
+ */
+static constexpr ov::Property<bool> import_blob_mmap{"VPUX_IMPORT_BLOB_MMAP"};
+
+/**
+ * @brief [Only for VPUX compiler]
+ * Type: std::string, default is empty (the cache is disabled).
+ * Directory of the on-disk cache of the compiled blobs. A blob is reused when the model, the compilation
+ * options and the compiler version all match. The directory can be shared by several processes.
+ */
+static constexpr ov::Property<std::string> compilation_cache_dir{"VPUX_COMPILATION_CACHE_DIR"};
+
+/**
+ * @brief [Only for VPUX compiler]
+ * Type: integer, default is 1073741824 (1 GiB).
+ * Size limit of the compilation cache directory in bytes, 0 means no limit.
+ * The least recently used blobs are removed once the limit is exceeded.
+ */
+static constexpr ov::Property<int64_t> compilation_cache_size{"VPUX_COMPILATION_CACHE_SIZE"};
+
+/**
+ * @brief [Only for VPUX compiler]
+ * Type: integer, default is 0 (the cache is disabled).
+ * Size limit in bytes of the in-memory cache of folded constants. The cache is shared by the compilations
+ * performed by the same compiler instance and keeps only the contents requested more than once.
+ */
+static constexpr ov::Property<int64_t> const_folding_cache_size{"VPUX_CONST_FOLDING_CACHE_SIZE"};
+
 }  // namespace intel_vpux
 }  // namespace ov
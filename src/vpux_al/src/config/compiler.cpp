@@ -20,6 +20,9 @@ void vpux::registerCompilerOptions(OptionsDesc& desc) {
     desc.add<COMPILATION_MODE_PARAMS>();
     desc.add<DPU_GROUPS>();
     desc.add<CUSTOM_LAYERS>();
+    desc.add<COMPILATION_CACHE_DIR>();
+    desc.add<COMPILATION_CACHE_SIZE>();
+    desc.add<CONST_FOLDING_CACHE_SIZE>();
 }
 
 //
@@ -63,6 +63,15 @@ std::shared_ptr<vpux::INetworkDescription> vpux::ICompiler::parse(std::istream&
     return parse(blob, config, graphName);
 }
 
+std::shared_ptr<vpux::INetworkDescription> vpux::ICompiler::parse(const MappedBlob::Ptr& blob, const Config& config,
+                                                                  const std::string& graphName) {
+    if (blob == nullptr) {
+        IE_THROW() << "Blob is empty";
+    }
+    const std::vector<char> content(blob->data(), blob->data() + blob->size());
+    return parse(content, config, graphName);
+}
+
 vpux::Compiler::Ptr vpux::Compiler::create(const Config& config) {
     vpux::Logger logger("CompilerCreate", config.get<LOG_LEVEL>());
 
@@ -0,0 +1,179 @@
+//
+// Copyright (C) 2022 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+//
+
+#include "vpux_mapped_blob.hpp"
+
+#include <ie_common.h>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <mutex>
+#include <unordered_map>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace vpux {
+
+namespace {
+
+// Same layout as the header written by ExecutableNetwork export and skipped by `skipMagic`:
+// the magic is followed by the network name terminated with a new line.
+using ExportMagic = std::array<char, 4>;
+constexpr ExportMagic exportMagic = {{0x1, 0xE, 0xE, 0x1}};
+
+std::size_t getBlobOffset(const char* data, std::size_t size) {
+    if (size < exportMagic.size() || !std::equal(exportMagic.begin(), exportMagic.end(), data)) {
+        return 0;
+    }
+
+    const auto* nameEnd =
+            static_cast<const char*>(std::memchr(data + exportMagic.size(), '\n', size - exportMagic.size()));
+    return nameEnd == nullptr ? size : static_cast<std::size_t>(nameEnd - data) + 1;
+}
+
+}  // namespace
+
+MappedBlob::FileInfo MappedBlob::getFileInfo(const std::string& filename) {
+    FileInfo info;
+
+#ifdef _WIN32
+    WIN32_FILE_ATTRIBUTE_DATA attributes = {};
+    if (!GetFileAttributesExA(filename.c_str(), GetFileExInfoStandard, &attributes)) {
+        IE_THROW(NetworkNotRead) << "Could not open file: " << filename;
+    }
+    info.size = (static_cast<std::size_t>(attributes.nFileSizeHigh) << 32) | attributes.nFileSizeLow;
+    info.modificationTime = (static_cast<int64_t>(attributes.ftLastWriteTime.dwHighDateTime) << 32) |
+                            attributes.ftLastWriteTime.dwLowDateTime;
+#else
+    struct stat status = {};
+    if (stat(filename.c_str(), &status) != 0) {
+        IE_THROW(NetworkNotRead) << "Could not open file: " << filename;
+    }
+    info.size = static_cast<std::size_t>(status.st_size);
+    info.modificationTime = static_cast<int64_t>(status.st_mtim.tv_sec) * 1000000000 + status.st_mtim.tv_nsec;
+#endif
+
+    return info;
+}
+
+MappedBlob::Ptr MappedBlob::open(const std::string& filename) {
+    static std::mutex mutex;
+    static std::unordered_map<std::string, std::weak_ptr<const MappedBlob>> mappings;
+
+    const auto info = getFileInfo(filename);
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto& cached = mappings[filename];
+    if (auto mapping = cached.lock()) {
+        if (mapping->_fileInfo == info) {
+            return mapping;
+        }
+    }
+
+    // Drop expired entries, so the cache does not grow with every imported file
+    for (auto it = mappings.begin(); it != mappings.end();) {
+        if (it->second.expired() && it->first != filename) {
+            it = mappings.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    Ptr mapping(new MappedBlob(filename, info));
+    cached = mapping;
+    return mapping;
+}
+
+MappedBlob::MappedBlob(const std::string& filename, const FileInfo& info): _fileName(filename), _fileInfo(info) {
+    if (info.size == 0) {
+        IE_THROW() << "Blob is empty";
+    }
+
+#ifdef _WIN32
+    _fileHandle = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (_fileHandle == INVALID_HANDLE_VALUE) {
+        _fileHandle = nullptr;
+        IE_THROW(NetworkNotRead) << "Could not open file: " << filename;
+    }
+
+    _mappingHandle = CreateFileMappingA(_fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (_mappingHandle == nullptr) {
+        unmap();
+        IE_THROW() << "Could not create mapping for file: " << filename;
+    }
+
+    _mapping = MapViewOfFile(_mappingHandle, FILE_MAP_READ, 0, 0, 0);
+    if (_mapping == nullptr) {
+        unmap();
+        IE_THROW() << "Could not map file: " << filename;
+    }
+#else
+    const int fd = ::open(filename.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        IE_THROW(NetworkNotRead) << "Could not open file: " << filename;
+    }
+
+    _mapping = mmap(nullptr, info.size, PROT_READ, MAP_SHARED, fd, 0);
+    // The mapping keeps its own reference to the file
+    close(fd);
+
+    if (_mapping == MAP_FAILED) {
+        _mapping = nullptr;
+        IE_THROW() << "Could not map file: " << filename;
+    }
+#endif
+
+    _mappingSize = info.size;
+    _offset = getBlobOffset(static_cast<const char*>(_mapping), _mappingSize);
+
+    if (size() == 0) {
+        unmap();
+        IE_THROW() << "Blob is empty";
+    }
+}
+
+MappedBlob::~MappedBlob() {
+    unmap();
+}
+
+void MappedBlob::unmap() {
+#ifdef _WIN32
+    if (_mapping != nullptr) {
+        UnmapViewOfFile(_mapping);
+    }
+    if (_mappingHandle != nullptr) {
+        CloseHandle(_mappingHandle);
+        _mappingHandle = nullptr;
+    }
+    if (_fileHandle != nullptr) {
+        CloseHandle(_fileHandle);
+        _fileHandle = nullptr;
+    }
+#else
+    if (_mapping != nullptr) {
+        munmap(_mapping, _mappingSize);
+    }
+#endif
+    _mapping = nullptr;
+    _mappingSize = 0;
+    _offset = 0;
+}
+
+}  // namespace vpux
@@ -0,0 +1,57 @@
+//
+// Copyright (C) 2022 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+//
+
+//
+// On-disk cache of the compiled blobs, used when the compiler is called outside of the OpenVINO model cache
+// (for example, through the driver compiler). The blobs are content-addressed: the key is a hash of the
+// serialized model (topology and weights), its inputs and outputs information, the compilation options and
+// the compiler version. The cache directory can be shared by several processes: the blobs are written
+// atomically and the least recently used ones are evicted once the total size exceeds the limit.
+//
+
+#pragma once
+
+#include "vpux_mapped_blob.hpp"
+
+#include "vpux/utils/core/array_ref.hpp"
+#include "vpux/utils/core/logger.hpp"
+#include "vpux/utils/core/string_ref.hpp"
+
+#include <ie_input_info.hpp>
+#include <ngraph/function.hpp>
+
+#include <memory>
+#include <string>
+
+namespace vpux {
+
+class CompilationCache final {
+public:
+    CompilationCache(StringRef dirPath, int64_t maxSize, Logger log);
+
+    // `options` holds everything, except the model itself, the compiled blob depends on
+    static std::string getKey(const std::shared_ptr<ngraph::Function>& func,
+                              const InferenceEngine::InputsDataMap& inputsInfo,
+                              const InferenceEngine::OutputsDataMap& outputsInfo, StringRef options);
+
+    // Returns NULL if there is no blob for the key
+    MappedBlob::Ptr load(StringRef key) const;
+
+    // Failures are reported as warnings, the cache is never required for the compilation to succeed
+    void store(StringRef key, ArrayRef<char> blob) const;
+
+private:
+    std::string getBlobPath(StringRef key) const;
+    void evict(StringRef keepPath) const;
+
+private:
+    std::string _dirPath;
+    int64_t _maxSize = 0;
+    Logger _log;
+};
+
+}  // namespace vpux
@@ -9,8 +9,17 @@
 
 #include "vpux_compiler.hpp"
 
+#include <memory>
+#include <mutex>
+
 namespace vpux {
 
+namespace Const {
+
+class FoldedContentCache;
+
+}  // namespace Const
+
 class CompilerImpl final : public ICompiler {
 public:
     std::shared_ptr<INetworkDescription> compile(const std::shared_ptr<ngraph::Function>& func,
@@ -24,6 +33,17 @@ public:
 
     std::shared_ptr<INetworkDescription> parse(const std::vector<char>& network, const Config& config,
                                                const std::string& graphName) final;
+
+    std::shared_ptr<INetworkDescription> parse(const MappedBlob::Ptr& blob, const Config& config,
+                                               const std::string& graphName) final;
+
+private:
+    std::shared_ptr<Const::FoldedContentCache> getConstFoldingCache(const Config& config);
+
+private:
+    // Shared by the compilations of this instance, created only when enabled in the configuration
+    std::shared_ptr<Const::FoldedContentCache> _constFoldingCache;
+    std::mutex _constFoldingCacheMutex;
 };
 
 }  // namespace vpux
@@ -43,6 +43,11 @@ private:
     void buildDepsMap(mlir::FuncOp func);
     void addExecOp(mlir::async::ExecuteOp execOp);
 
+private:
+    bool isIndexedInTopologicalOrder() const;
+    void optimizeDepsMapDense();
+    void optimizeDepsMapSparse();
+
 private:
     Logger _log;
 
@@ -50,9 +55,13 @@ private:
 
     SmallVector<mlir::async::ExecuteOp> _allExecOps;
 
+    // Sorted list of operation indexes. The lists take O(E) memory, unlike the dense bit matrix,
+    // which takes O(N^2) for the large unrolled graphs.
+    using IndexList = SmallVector<uint32_t>;
+
     // indexOf(mlir::async::ExecuteOp) 'depends on' [ indexOf(mlir::async::ExecuteOp)... ].
-    SmallVector<llvm::BitVector> _depsMap;
-    SmallVector<llvm::BitVector> _consumerMap;
+    SmallVector<IndexList> _depsMap;
+    SmallVector<IndexList> _consumerMap;
 };
 
 }  // namespace vpux
@@ -0,0 +1,57 @@
+//
+// Copyright (C) 2022 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+//
+
+#pragma once
+
+#include "vpux/compiler/dialect/VPU/attributes.hpp"
+#include "vpux/compiler/dialect/VPUIP/dpu_tiler.hpp"
+#include "vpux/compiler/dialect/VPUIP/ops.hpp"
+
+#include "vpux/utils/core/logger.hpp"
+#include "vpux/utils/core/mem_size.hpp"
+
+#include <mlir/Dialect/Async/IR/Async.h>
+#include <mlir/IR/BuiltinOps.h>
+
+#include <unordered_map>
+
+namespace vpux {
+
+//
+// CycleCostInfo
+//
+
+// Estimates the duration of async.execute operations in cycles:
+//   * DPU tasks are costed by VPUNN from their workloads,
+//   * DMA tasks by the transfer size and the bandwidth of the source and destination memories,
+//   * software kernels, which have no cost model yet, by their output size.
+// Estimates are cached per operation, the instance is expected to be owned by a single pass run.
+class CycleCostInfo final {
+public:
+    explicit CycleCostInfo(mlir::ModuleOp module, Logger log = Logger::global());
+
+public:
+    size_t getCycleCost(mlir::async::ExecuteOp execOp);
+    size_t getDMACost(Byte size, VPU::MemoryKind srcMemKind, VPU::MemoryKind dstMemKind);
+
+private:
+    size_t getLayerCost(mlir::Operation* op, bool isDMA);
+    size_t getNCECost(VPUIP::NCEClusterTaskOp nceOp);
+    size_t getSWCost(mlir::Operation* op);
+    double getBandwidth(VPU::MemoryKind memKind);
+
+private:
+    Logger _log;
+    mlir::ModuleOp _module;
+    VPU::ArchKind _arch;
+    int64_t _numDPU;
+    VPUIP::WorkloadCostCache _workloadCostCache;
+    std::unordered_map<mlir::Operation*, size_t> _cycleCosts;
+    std::unordered_map<VPU::MemoryKind, double> _bandwidths;
+};
+
+}  // namespace vpux
@@ -6,6 +6,7 @@
 #pragma once
 
 #include "vpux/compiler/core/async_deps_info.hpp"
+#include "vpux/compiler/core/cycle_cost_info.hpp"
 #include "vpux/compiler/core/linear_scan_handler.hpp"
 #include "vpux/compiler/core/mem_live_range_info.hpp"
 #include "vpux/compiler/utils/partitioner.hpp"
@@ -150,9 +151,15 @@ public:
     // Struct used to output the scheduled op info
     struct ScheduledOpInfo {
         ScheduledOpInfo(operationIdxType op, EOpType type, size_t time, vpux::AddressType freeCmx, bool isDataOp)
-                : op_(op), opType_(type), time_(time), freeCmx_(freeCmx), isDataOp_(isDataOp) {
+                : op_(op),
+                  opType_(type),
+                  time_(time),
+                  cycleBegin_(time),
+                  cycleEnd_(time + 1),
+                  freeCmx_(freeCmx),
+                  isDataOp_(isDataOp) {
         }
-        ScheduledOpInfo(): op_(), opType_(), time_(), freeCmx_(), isDataOp_() {
+        ScheduledOpInfo(): op_(), opType_(), time_(), cycleBegin_(), cycleEnd_(), freeCmx_(), isDataOp_() {
         }
         bool operator==(const ScheduledOpInfo& other) const {
             return (other.op_ == op_) && (other.opType_ == opType_);
@@ -249,6 +256,9 @@ public:
         operationIdxType op_;
         EOpType opType_;
         size_t time_;
+        // estimated execution interval, equal to [time_, time_ + 1) unless cycle costs are used
+        size_t cycleBegin_;
+        size_t cycleEnd_;
         vpux::AddressType freeCmx_;
         bool isDataOp_;
         SmallVector<IntervalInfo> outputResourceInfo_;
@@ -297,10 +307,14 @@ public:
 
 public:
     FeasibleMemoryScheduler(VPU::MemoryKind memSpace, MemLiveRangeInfo& liveRangeInfo, AsyncDepsInfo& depsInfo,
-                            AliasesInfo& aliasInfo, Logger log, LinearScan<mlir::Value, LinearScanHandler>& scan);
+                            AliasesInfo& aliasInfo, Logger log, LinearScan<mlir::Value, LinearScanHandler>& scan,
+                            CycleCostInfo* cycleCostInfo = nullptr);
 
 public:
     SmallVector<ScheduledOpInfo> generateSchedule(prefetchMap prefetchEdges = {});
+    size_t getEstimatedCycles() const {
+        return _estimatedCycles;
+    }
 
 private:
     bool init();
@@ -315,7 +329,7 @@ private:
     mlir::DenseSet<operationIdxType> getNonEmptyOpDemandList(operationIdxType opIdx,
                                                              llvm::ArrayRef<mlir::Value> neededBuffers);
     void scheduleInputOpForComputeOp(operationIdxType inputIdx, size_t delay);
-    void scheduleSpilledOpBuffer(operationIdxType inputIdx, mlir::Value* buffer);
+    size_t scheduleSpilledOpBuffer(operationIdxType inputIdx, mlir::Value* buffer);
     size_t allocateBuffersAndInputOps(operationIdxType opIdx,
                                       Partitioner::Direction allocDir = Partitioner::Direction::Up);
     size_t scheduleComputeOp(operationIdxType opIdx);
@@ -335,6 +349,8 @@ private:
     SmallVector<HeapElement> popAllElementsAtThisTime(size_t time_step);
     void unscheduleAllCompletingOpsAtNextEarliestTime();
     void populateScheduledOps(HeapElement& scheduledOp);
+    size_t getOpDuration(const HeapElement& elem);
+    void finalizeScheduleTime();
     vpux::AddressType calculateOpSize(operationIdxType opIdx);
     void evictActiveOp(EvictionCandidate evictionCandidate);
     size_t evictionPriority(mlir::Value buffer);
@@ -355,6 +371,8 @@ private:
     AliasesInfo& _aliasInfo;
     // allocator class
     LinearScan<mlir::Value, LinearScanHandler>& _scan;
+    // optional cycle cost estimation, operations take a unit of time when not provided
+    CycleCostInfo* _cycleCostInfo;
     // heap with earliest operation start time
     SmallVector<HeapElement> _startTimeHeap;
     // heap with earliest operation completion time
@@ -388,6 +406,8 @@ private:
     llvm::DenseSet<operationIdxType> _outputOps;
     // schedule time
     size_t _currentTime;
+    // estimated duration of the generated schedule
+    size_t _estimatedCycles = 0;
 };
 
 }  // namespace vpux
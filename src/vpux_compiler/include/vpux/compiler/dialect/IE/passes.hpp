@@ -198,6 +198,8 @@ std::unique_ptr<mlir::Pass> createPrefetchTilingPass(Logger log = Logger::global
 
 std::unique_ptr<mlir::Pass> createManualTilingPass(Logger log = Logger::global());
 
+std::unique_ptr<mlir::Pass> createVerticalFusionTilingPass(Logger log = Logger::global());
+
 //
 // Generic Optimizations
 //
@@ -34,7 +34,8 @@ std::unique_ptr<mlir::Pass> createOptimizeParallelCopiesPass(Logger log = Logger
 std::unique_ptr<mlir::Pass> createCopyOpTilingPass(Logger log = Logger::global());
 std::unique_ptr<mlir::Pass> createSetInternalMemorySpacePass(MemKindCreateFunc memKindCb,
                                                              Logger log = Logger::global());
-std::unique_ptr<mlir::Pass> createStaticAllocationPass(MemKindCreateFunc memKindCb, Logger log = Logger::global());
+std::unique_ptr<mlir::Pass> createStaticAllocationPass(MemKindCreateFunc memKindCb, bool offlinePacking = false,
+                                                       Logger log = Logger::global());
 std::unique_ptr<mlir::Pass> createLinearizationPass(Logger log = Logger::global());
 std::unique_ptr<mlir::Pass> createFeasibleAllocationPass(MemKindCreateFunc memKindCb,
                                                          MemKindCreateFunc secondLvlMemKindCb = nullptr,
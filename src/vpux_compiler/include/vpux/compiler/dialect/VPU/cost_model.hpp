@@ -5,7 +5,12 @@
 
 #pragma once
 
+#include "vpux/compiler/core/attributes/shape.hpp"
 #include "vpux/compiler/dialect/VPU/attributes.hpp"
+#include "vpux/compiler/dialect/VPU/ops_interfaces.hpp"
+#include "vpux/compiler/dialect/VPUIP/dpu_tiler.hpp"
+
+#include <mlir/IR/Operation.h>
 
 #include <vpu_cost_model.h>
 
@@ -16,5 +21,16 @@ namespace VPU {
 
 std::shared_ptr<VPUNN::VPUCostModel> createCostModel(ArchKind arch);
 
+// The MPE mode the workloads of the NCE operation are executed with
+MPEMode getMPEMode(ArchKind arch, mlir::Type inElemType, mlir::Type outElemType, mlir::Operation* nceOp,
+                   ShapeRef outputShape);
+
+// The VPUNN parameters of the whole NCE operation, the callers estimating a part of it override the shapes and pads
+VPUIP::WorkloadCostParams getWorkloadCostParams(NCEOpInterface nceOp, ArchKind arch, int64_t numDPU);
+
+// The DPU cost of computing `params.outputShape`, with its rows split evenly over `params.numDPU` DPUs
+int64_t getDPUCost(NCEOpInterface nceOp, const VPUIP::WorkloadCostParams& params,
+                   VPUIP::WorkloadCostCache& costCache);
+
 }  // namespace VPU
 }  // namespace vpux
@@ -11,6 +11,7 @@ constexpr StringLiteral multiClusterStrategy = "multiClusterStrategy";
 constexpr StringLiteral tilingStrategy = "tilingStrategy";
 constexpr StringLiteral manualTilingStrategy = "manualTilingStrategy";
 constexpr StringLiteral manualTilingStrategyApplied = "manualTilingStrategyApplied";
+constexpr StringLiteral verticalFusionApplied = "verticalFusionApplied";
 constexpr StringLiteral defaultNoStrategy = "NONE";
 
 }  // namespace vpux
\ No newline at end of file
@@ -36,9 +36,13 @@ std::unique_ptr<mlir::Pass> createInitCompilerPass(ArchKind arch, CompilationMod
 
 std::unique_ptr<mlir::Pass> createCMXConcatPass(Logger log = Logger::global());
 std::unique_ptr<mlir::Pass> createSplitNCEOpsOntoWorkloadsPass(Logger log = Logger::global());
+std::unique_ptr<mlir::Pass> createEstimateWeightsSparsityPass();
+std::unique_ptr<mlir::Pass> createEstimateWeightsSparsityPass(double densityThreshold, Logger log = Logger::global());
 std::unique_ptr<mlir::Pass> createWrapVPUOpsInNCEClusterTilingPass(Logger log = Logger::global());
 std::unique_ptr<mlir::Pass> createAdjustMemorySpacePass(Logger log = Logger::global());
 std::unique_ptr<mlir::Pass> createMultiClusterStrategyAssignmentPass(Logger log = Logger::global());
+std::unique_ptr<mlir::Pass> createMultiClusterStrategyAssignmentPass(bool enableGraphOptimization, int timeBudget,
+                                                                     Logger log = Logger::global());
 std::unique_ptr<mlir::Pass> createManualStrategyUtilsPass();
 std::unique_ptr<mlir::Pass> createManualStrategyUtilsPass(bool writeStrategyToJSON,
                                                           StringRef writeStrategyFileLocation = "strategy_out.json",
@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <map>
 #include "vpux/compiler/dialect/IE/utils/resources.hpp"
 #include "vpux/compiler/dialect/VPU/attributes.hpp"
@@ -124,8 +125,13 @@ public:
 public:
     void assignMultiClusterStrategy();
 
+    // Assigns the strategies to the whole graph at once, taking into account the cost of the activation
+    // spill between the layers with incompatible distributions. The search is bounded by the time budget.
+    void optimizeMultiClusterStrategy(std::chrono::milliseconds timeBudget);
+
 private:
     void setLayerStrategy(VPU::MultiClusterStrategy strategy, VPU::NCEOpInterface nceOp);
+    SmallVector<VPU::MultiClusterStrategy> getFeasibleStrategies(VPU::NCEOpInterface nceOp) const;
 
     mlir::FuncOp _func;
     Logger _log;
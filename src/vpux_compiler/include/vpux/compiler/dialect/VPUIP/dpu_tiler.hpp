@@ -13,8 +13,10 @@
 
 #include <vpu_cost_model.h>
 
+#include <array>
 #include <set>
 #include <tuple>
+#include <unordered_map>
 
 namespace vpux {
 namespace VPUIP {
@@ -56,8 +58,54 @@ private:
     VPU::MPEMode _mpeMode;
 };
 
+//
+// WorkloadCostCache
+//
+
+// All fields of the VPUNN::DPUWorkload descriptor produced for a workload tile.
+struct DPUWorkloadKey final {
+    VPUNN::VPUDevice device;
+    VPUNN::Operation op;
+    VPUNN::DataType dataType;
+    std::array<unsigned int, 4> inputShape;
+    std::array<unsigned int, 4> outputShape;
+    std::array<unsigned int, 2> kernels;
+    std::array<unsigned int, 2> strides;
+    std::array<unsigned int, 4> pads;
+    VPUNN::ExecutionMode mpeMode;
+
+    bool operator==(const DPUWorkloadKey& other) const;
+};
+
+struct DPUWorkloadKeyHash final {
+    size_t operator()(const DPUWorkloadKey& key) const;
+};
+
+// Memoizes VPUNN DPU cost queries, so identical workloads are inferred only once.
+// Is not thread safe, the instance is expected to be owned by a single pass run.
+class WorkloadCostCache final {
+public:
+    explicit WorkloadCostCache(std::shared_ptr<VPUNN::VPUCostModel> costModel);
+
+public:
+    int64_t getDPUCost(const DPUWorkloadKey& key);
+
+    size_t size() const {
+        return _costs.size();
+    }
+
+private:
+    std::shared_ptr<VPUNN::VPUCostModel> _costModel;
+    std::unordered_map<DPUWorkloadKey, int64_t, DPUWorkloadKeyHash> _costs;
+};
+
 int64_t computeSplitCost(const WorkloadSplit& split, const WorkloadCostParams& params,
                          const std::shared_ptr<VPUNN::VPUCostModel>& costModel);
+int64_t computeSplitCost(const WorkloadSplit& split, const WorkloadCostParams& params, WorkloadCostCache& costCache);
+
+// Scores all candidate splits of one NCE operation, each unique workload is queried from the cost model once.
+SmallVector<int64_t> computeSplitCosts(ArrayRef<WorkloadSplit> splits, const WorkloadCostParams& params,
+                                       WorkloadCostCache& costCache);
 
 }  // namespace VPUIP
 }  // namespace vpux
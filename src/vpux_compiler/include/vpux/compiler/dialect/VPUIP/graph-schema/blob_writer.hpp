@@ -80,6 +80,11 @@ public:
     BlobWriter(Logger log, VPU::ArchKind architecture): _log(log), _architecture(architecture) {
     }
 
+    // Pre-sizes the underlying builder storage
+    BlobWriter(Logger log, VPU::ArchKind architecture, size_t initialSize)
+            : _log(log), _architecture(architecture), _impl(initialSize) {
+    }
+
 public:
     Task createTask(mlir::Operation* op);
     void setAliasForSerializedTensors(mlir::Operation* op);
@@ -125,6 +130,8 @@ public:
 
 public:
     BinaryData createBinaryData(ArrayRef<uint64_t> content, vpux::NDTypeInterface type, bool csram_cacheable = false);
+    BinaryData createBinaryData(Vector<uint64_t> serializedContent, vpux::NDTypeInterface type,
+                                bool csram_cacheable = false);
 
 public:
     Barrier createBarrier(mlir::Value val, Optional<int64_t> physicalID = None);
@@ -19,6 +19,7 @@
 namespace vpux {
 namespace VPUIP {
 
+// Pre-sizes the blob and folds the constants directly into their final location.
 flatbuffers::DetachedBuffer exportToBlob(mlir::ModuleOp module, mlir::TimingScope& rootTiming,
                                          const std::vector<PreProcessInfo>& preprocessInfo,
                                          const std::vector<std::shared_ptr<const ov::Node>>& parameters,
@@ -8,6 +8,11 @@
 #pragma once
 
 #include "vpux_compiler.hpp"
+#include "vpux_mapped_blob.hpp"
+
+#include <flatbuffers/flatbuffers.h>
+
+#include <mutex>
 
 namespace vpux {
 namespace VPUIP {
@@ -16,17 +21,22 @@ class NetworkDescription final : public INetworkDescription {
 public:
     explicit NetworkDescription(std::vector<char> blob);
 
+    // The blob is verified and used in place, the mapping is kept alive while the description exists.
+    explicit NetworkDescription(MappedBlob::Ptr blob);
+
+    // The blob is used in place, the builder storage is kept alive while the description exists.
+    explicit NetworkDescription(flatbuffers::DetachedBuffer blob);
+
 public:
-    const std::vector<char>& getCompiledNetwork() const final {
-        return _compiledNetwork;
-    }
+    // Copies the mapped or detached blob on the first call, use getNetworkModel() to avoid it.
+    const std::vector<char>& getCompiledNetwork() const final;
 
     const void* getNetworkModel() const final {
-        return _compiledNetwork.data();
+        return _networkModel;
     }
 
     std::size_t getNetworkModelSize() const final {
-        return _compiledNetwork.size();
+        return _networkModelSize;
     }
 
     const std::string& getName() const final {
@@ -67,7 +77,16 @@ public:
     }
 
 private:
-    std::vector<char> _compiledNetwork;
+    void parseNetworkModel();
+
+private:
+    mutable std::vector<char> _compiledNetwork;
+    mutable std::once_flag _compiledNetworkCopied;
+    MappedBlob::Ptr _mappedBlob;
+    flatbuffers::DetachedBuffer _detachedBlob;
+
+    const char* _networkModel = nullptr;
+    std::size_t _networkModelSize = 0;
 
     std::string _name;
 
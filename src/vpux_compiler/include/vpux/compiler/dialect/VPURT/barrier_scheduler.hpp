@@ -114,6 +114,7 @@ public:
     void clearTemporaryAttributes();
     bool generateScheduleWithBarriers(const size_t numberOfBarriers, const size_t maxProducersPerBarrier);
     bool performRuntimeSimulation();
+    void removeScheduledBarriers();
 
 private:
     void assignTaskUniqueIds();
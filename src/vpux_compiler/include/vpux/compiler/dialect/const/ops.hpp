@@ -9,6 +9,7 @@
 
 #include "vpux/compiler/core/ops_interfaces.hpp"
 #include "vpux/compiler/dialect/const/attributes/content.hpp"
+#include "vpux/compiler/dialect/const/utils/content_cache.hpp"
 
 #include "vpux/utils/core/logger.hpp"
 
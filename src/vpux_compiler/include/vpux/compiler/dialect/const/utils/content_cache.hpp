@@ -0,0 +1,96 @@
+//
+// Copyright (C) 2022 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+//
+
+#pragma once
+
+#include "vpux/compiler/dialect/const/attributes/content.hpp"
+
+#include "vpux/utils/core/hash.hpp"
+#include "vpux/utils/core/mem_size.hpp"
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace vpux {
+namespace Const {
+
+//
+// FoldedContentCache
+//
+
+// Cache of folded constant contents shared by the compilations performed by one compiler instance.
+// The entries are keyed by the SHA1 digest of the base content data together with the types and transformations,
+// so the same constant is found even if it comes from another MLIR context.
+// A folded content is stored only when it is requested for the second time, single-use contents are never kept.
+// The cache is bounded by the total byte size of the stored buffers and evicts least recently used entries.
+
+class FoldedContentCache final {
+public:
+    using Buffer = std::shared_ptr<const std::vector<char>>;
+
+    // The counters are owned by the caller, so they can be reported per compilation
+    struct Statistics final {
+        size_t hits = 0;
+        size_t misses = 0;
+        size_t evictions = 0;
+    };
+
+public:
+    explicit FoldedContentCache(Byte maxSize);
+
+public:
+    // Folds the content into a raw buffer of `attr.getType().getTotalAllocSize()` bytes without caching.
+    static Buffer fold(ContentAttr attr);
+
+    Buffer getOrFold(ContentAttr attr, Statistics& stats);
+
+    // Copies the cached content into `buf` or folds it there directly.
+    // Intended for the final consumers, which doesn't need to keep the folded data.
+    void copyTo(ContentAttr attr, MutableArrayRef<char> buf, Statistics& stats);
+
+public:
+    Byte getMaxSize() const;
+    Byte getUsedSize() const;
+
+    void clear();
+
+private:
+    using Key = std::tuple<std::string, size_t, std::string>;
+    using LRUList = std::list<std::pair<Key, Buffer>>;
+
+    static Key getKey(ContentAttr attr);
+
+    Buffer find(const Key& key, Statistics& stats);
+    bool admit(const Key& key);
+    void evict(Byte requiredSize, Statistics& stats);
+
+private:
+    mutable std::mutex _mutex;
+    Byte _maxSize;
+    Byte _usedSize = Byte(0);
+    LRUList _lru;
+    std::unordered_map<Key, LRUList::iterator> _entries;
+    std::unordered_set<Key> _candidates;
+};
+
+//
+// Folding through the context cache
+//
+
+// Use the cache attached to the Const dialect of the attribute context or fold the content directly without it.
+
+FoldedContentCache::Buffer foldContent(ContentAttr attr);
+void copyFoldedContent(ContentAttr attr, MutableArrayRef<char> buf);
+
+}  // namespace Const
+}  // namespace vpux
@@ -20,6 +20,16 @@ namespace details {
 vpux::Const::Content memPermuteTransformation(vpux::Const::Content& input, vpux::NDTypeInterface outType,
                                               mlir::AffineMap memPerm);
 
+//
+// applyTransformations
+//
+
+// Applies the transformations chain to the content. Consecutive element-wise (ConvertElemType, Rescale, Add,
+// Dequantize) and index remapping (SubView, Reorder, PadWithZero) transformations are fused and executed in one pass
+// over the data, the rest of the chain is applied step-by-step.
+vpux::Const::Content applyTransformations(vpux::Const::Content& input,
+                                          ArrayRef<vpux::Const::TransformAttrInterface> transformations);
+
 }  // namespace details
 }  // namespace Const
 }  // namespace vpux
@@ -42,6 +42,10 @@ struct ReferenceSWOptions : mlir::PassPipelineOptions<ReferenceSWOptions> {
     BoolOption enableOptimizeReorders{*this, "optimize-reorders", llvm::cl::desc("Enable optimize-reorders pass"),
                                       llvm::cl::init(false)};
 
+    BoolOption enableOfflinePacking{*this, "offline-packing",
+                                    llvm::cl::desc("Enable offline packing in the DDR static-allocation pass"),
+                                    llvm::cl::init(true)};
+
     bool enableCompressWeights = false;
     bool enableForceZMajorConcat = false;
     bool enableSwapTransposeWithFQ = false;
@@ -110,6 +114,10 @@ struct ReferenceHWOptions : mlir::PassPipelineOptions<ReferenceHWOptions> {
     BoolOption enableOptimizeReorders{*this, "optimize-reorders", llvm::cl::desc("Enable optimize-reorders pass"),
                                       llvm::cl::init(false)};
 
+    BoolOption enableOfflinePacking{*this, "offline-packing",
+                                    llvm::cl::desc("Enable offline packing in the DDR static-allocation pass"),
+                                    llvm::cl::init(true)};
+
     bool enableCompressWeights = false;
     bool enableForceZMajorConcat = false;
     bool enableSwapTransposeWithFQ = false;
@@ -190,9 +198,32 @@ struct DefaultHWOptions : mlir::PassPipelineOptions<DefaultHWOptions> {
     BoolOption enableGroupAsyncExecuteOps{*this, "group-async-execute-ops",
                                           llvm::cl::desc("Enable group-async-execute-ops pass"), llvm::cl::init(true)};
 
+    BoolOption enableOfflinePacking{*this, "offline-packing",
+                                    llvm::cl::desc("Enable offline packing in the DDR static-allocation pass"),
+                                    llvm::cl::init(true)};
+
     BoolOption enableCompressWeights{*this, "compress-weights", ::llvm::cl::desc("Enable compress-weights pass"),
                                      ::llvm::cl::init(false)};
 
+    BoolOption enableStrategyGraphOptimization{
+            *this, "strategy-graph-optimization",
+            llvm::cl::desc("Assign the multi-cluster strategies with the graph-level optimizer"), llvm::cl::init(false)};
+
+    IntOption strategySearchTimeBudget{*this, "strategy-search-time-budget",
+                                       llvm::cl::desc("Time budget of the multi-cluster strategy search in ms"),
+                                       llvm::cl::init(1000)};
+
+    BoolOption enableVerticalFusion{*this, "vertical-fusion", llvm::cl::desc("Enable vertical-fusion-tiling pass"),
+                                    llvm::cl::init(false)};
+
+    BoolOption enableEstimateWeightsSparsity{*this, "estimate-weights-sparsity",
+                                             llvm::cl::desc("Enable estimate-weights-sparsity pass"),
+                                             llvm::cl::init(false)};
+
+    DoubleOption weightsSparsityThreshold{*this, "weights-sparsity-threshold",
+                                          llvm::cl::desc("Minimal density of the zero point valued weights"),
+                                          llvm::cl::init(0.5)};
+
     BoolOption enableForceZMajorConcat{*this, "force-z-major-concat",
                                        llvm::cl::desc("Enable transpose-reorder-concat pass"), llvm::cl::init(true)};
 
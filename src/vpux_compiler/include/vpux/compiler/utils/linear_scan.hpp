@@ -132,7 +132,7 @@ public:
 
     template <class LiveRanges>
     bool canAlloc(const LiveRanges& newLiveRanges, Direction dir = Direction::Up) {
-        auto gapCountBefore = _par.gaps().size();
+        auto gapCountBefore = _par.numGaps();
         bool canAllocAll = true;
         SmallVector<std::pair<vpux::AddressType, vpux::AddressType>> tempAlloc;
         // temp allocation
@@ -158,7 +158,7 @@ public:
             vpux::AddressType size = curIt->second;
             _par.free(address, size);
         }
-        VPUX_THROW_UNLESS(gapCountBefore == _par.gaps().size(), "Error new gaps created");
+        VPUX_THROW_UNLESS(gapCountBefore == _par.numGaps(), "Error new gaps created");
         return canAllocAll;
     }
 
@@ -194,7 +194,7 @@ public:
         return _par.maxFreeSize();
     }
 
-    const auto& gaps() const {
+    auto gaps() const {
         return _par.gaps();
     }
 
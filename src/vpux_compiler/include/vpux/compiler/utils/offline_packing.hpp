@@ -0,0 +1,54 @@
+//
+// Copyright (C) 2022 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+//
+
+//
+// Offline packing assigns addresses to buffers whose live ranges are all known
+// in advance. Unlike the linear scan, which places every buffer at the moment
+// it becomes alive, it solves the whole time x address placement at once:
+// the buffers are placed in the order of decreasing size x lifetime (and then
+// of decreasing size, keeping the better result), each one into the best
+// fitting gap left by the already placed buffers it interferes with (the ones
+// alive at the same time).
+//
+
+#pragma once
+
+#include "vpux/compiler/utils/partitioner.hpp"
+
+#include "vpux/utils/core/array_ref.hpp"
+#include "vpux/utils/core/small_vector.hpp"
+
+#include <cstddef>
+
+namespace vpux {
+
+struct PackingBuffer final {
+    // The buffer is alive in the time steps [firstUse, lastUse]
+    size_t firstUse = 0;
+    size_t lastUse = 0;
+    AddressType size = 0;
+    AddressType alignment = 1;
+    // Buffers with a fixed address are placed there as is
+    AddressType fixedAddress = InvalidAddress;
+};
+
+struct PackingResult final {
+    // The address of every buffer, in the order of the input
+    SmallVector<AddressType> addresses;
+    // The end of the highest buffer, aligned to its alignment
+    AddressType footprint = 0;
+    // No placement can take less memory than this
+    AddressType lowerBound = 0;
+};
+
+// The peak of the total size of the buffers alive at the same time step,
+// or the end of the highest fixed buffer if it is above
+AddressType getPackingLowerBound(ArrayRef<PackingBuffer> buffers);
+
+PackingResult packBuffers(ArrayRef<PackingBuffer> buffers);
+
+}  // namespace vpux
@@ -9,10 +9,17 @@
 // Partitioner finds and allocates unused portion of memory from the contiguous
 // memory array; returns the portion back after their usage is finished
 //
+// The free gaps are kept in two balanced trees: ordered by address, to coalesce
+// the freed portions with their neighbours, and ordered by size, to find the
+// best fitting gap. Both lookups are logarithmic in the number of gaps.
+//
 
 #pragma once
 
 #include <limits>
+#include <map>
+#include <set>
+#include <utility>
 #include <vector>
 
 #include <cassert>
@@ -55,24 +62,40 @@ public:
         return _totalSize;
     }
 
-    AddressType totalFreeSize() const;
+    AddressType totalFreeSize() const {
+        return _totalFreeSize;
+    }
 
     AddressType maxFreeSize() const;
 
-    const std::vector<Gap>& gaps() const {
-        return _gaps;
+    size_t numGaps() const {
+        return _gapsByAddr.size();
     }
 
+    // Gaps ordered by address
+    std::vector<Gap> gaps() const;
+
 public:
     static bool intersects(AddressType addr1, AddressType size1, AddressType addr2, AddressType size2);
 
 private:
-    AddressType getAddrFromGap(size_t pos, AddressType size, AddressType alignment, Direction dir);
-    AddressType useGap(size_t pos, AddressType alignedBegin, AddressType size);
+    // begin -> end
+    using GapsByAddr = std::map<AddressType, AddressType>;
+    // (size, begin)
+    using GapsBySize = std::set<std::pair<AddressType, AddressType>>;
+
+    static AddressType getAddrFromGap(const Gap& g, AddressType size, AddressType alignment, Direction dir);
+
+    void addGap(AddressType begin, AddressType end);
+    GapsByAddr::iterator removeGap(GapsByAddr::iterator gapIt);
+
+    AddressType useGap(GapsByAddr::iterator gapIt, AddressType alignedBegin, AddressType size);
     AddressType chooseMinimalGap(AddressType size, AddressType alignment, Direction dir);
 
 private:
-    std::vector<Gap> _gaps;
+    GapsByAddr _gapsByAddr;
+    GapsBySize _gapsBySize;
+    AddressType _totalFreeSize = 0;
     AddressType _totalSize = 0;
 };
 
@@ -22,6 +22,7 @@ namespace vpux {
 using IntOption = mlir::detail::PassOptions::Option<int>;
 using StrOption = mlir::detail::PassOptions::Option<std::string>;
 using BoolOption = mlir::detail::PassOptions::Option<bool>;
+using DoubleOption = mlir::detail::PassOptions::Option<double>;
 
 //
 // PatternBenefit
@@ -0,0 +1,271 @@
+//
+// Copyright (C) 2022 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+//
+
+#include "vpux/compiler/compilation_cache.hpp"
+
+#include "vpux/compiler/dialect/VPUIP/generated/schema/gf_version.h"
+
+#include "vpux/utils/core/checked_cast.hpp"
+#include "vpux/utils/core/error.hpp"
+#include "vpux/utils/core/format.hpp"
+#include "vpux/utils/core/small_string.hpp"
+#include "vpux/utils/core/small_vector.hpp"
+
+#include <llvm/ADT/STLExtras.h>
+#include <llvm/ADT/StringExtras.h>
+#include <llvm/Support/Chrono.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/FileUtilities.h>
+#include <llvm/Support/Path.h>
+#include <llvm/Support/Process.h>
+#include <llvm/Support/SHA1.h>
+
+#include <ngraph/pass/manager.hpp>
+#include <transformations/serialize.hpp>
+
+#include <version.hpp>
+
+#include <chrono>
+#include <ostream>
+#include <streambuf>
+
+using namespace vpux;
+
+namespace {
+
+constexpr StringLiteral BLOB_EXTENSION = ".blob";
+constexpr StringLiteral TEMP_EXTENSION = ".tmp";
+
+// Temporary files are left behind only by the processes, which died while writing a blob
+constexpr auto STALE_TEMP_FILE_AGE = std::chrono::hours(1);
+
+//
+// HashingStreamBuf
+//
+
+// Feeds the serialized model directly to the hash, so the weights are never copied into memory.
+// The position is tracked, since the serializer computes the weights offsets from it.
+class HashingStreamBuf final : public std::streambuf {
+public:
+    explicit HashingStreamBuf(llvm::SHA1& hasher): _hasher(hasher) {
+    }
+
+protected:
+    std::streamsize xsputn(const char* data, std::streamsize size) final {
+        _hasher.update(StringRef(data, static_cast<size_t>(size)));
+        _pos += size;
+        return size;
+    }
+
+    int_type overflow(int_type ch) final {
+        if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+            const auto c = traits_type::to_char_type(ch);
+            xsputn(&c, 1);
+        }
+        return traits_type::not_eof(ch);
+    }
+
+    pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) final {
+        if (off == 0 && dir == std::ios_base::cur && (which & std::ios_base::out) != 0) {
+            return pos_type(_pos);
+        }
+        return pos_type(off_type(-1));
+    }
+
+private:
+    llvm::SHA1& _hasher;
+    std::streamsize _pos = 0;
+};
+
+void touch(StringRef path) {
+    int fd = -1;
+    if (llvm::sys::fs::openFileForWrite(path, fd, llvm::sys::fs::CD_OpenExisting, llvm::sys::fs::OF_Append)) {
+        return;
+    }
+
+    llvm::sys::TimePoint<> now = std::chrono::system_clock::now();
+    llvm::sys::fs::setLastAccessAndModificationTime(fd, now);
+    llvm::sys::Process::SafelyCloseFileDescriptor(fd);
+}
+
+}  // namespace
+
+//
+// CompilationCache
+//
+
+vpux::CompilationCache::CompilationCache(StringRef dirPath, int64_t maxSize, Logger log)
+        : _dirPath(dirPath.str()), _maxSize(maxSize), _log(log) {
+    VPUX_THROW_WHEN(_dirPath.empty(), "Compilation cache directory is not set");
+    VPUX_THROW_WHEN(_maxSize < 0, "Compilation cache size limit '{0}' is negative", _maxSize);
+}
+
+std::string vpux::CompilationCache::getKey(const std::shared_ptr<ngraph::Function>& func,
+                                           const InferenceEngine::InputsDataMap& inputsInfo,
+                                           const InferenceEngine::OutputsDataMap& outputsInfo, StringRef options) {
+    VPUX_THROW_WHEN(func == nullptr, "Null OV model");
+
+    llvm::SHA1 xmlHasher;
+    llvm::SHA1 binHasher;
+
+    {
+        HashingStreamBuf xmlBuf(xmlHasher);
+        HashingStreamBuf binBuf(binHasher);
+        std::ostream xmlStream(&xmlBuf);
+        std::ostream binStream(&binBuf);
+
+        ngraph::pass::Manager manager;
+        manager.register_pass<ngraph::pass::Serialize>(xmlStream, binStream);
+        manager.run_passes(func);
+    }
+
+    llvm::SHA1 hasher;
+    hasher.update(xmlHasher.final());
+    hasher.update(binHasher.final());
+
+    // The information maps are ordered by name, so the key does not depend on the insertion order
+    for (const auto& p : inputsInfo) {
+        hasher.update(printToString("input {0} {1} {2};", p.first, p.second->getPrecision().name(),
+                                    static_cast<int>(p.second->getLayout())));
+    }
+    for (const auto& p : outputsInfo) {
+        hasher.update(printToString("output {0} {1} {2};", p.first, p.second->getPrecision().name(),
+                                    static_cast<int>(p.second->getLayout())));
+    }
+
+    hasher.update(options);
+    hasher.update(printToString("version {0} {1}.{2}.{3}", VPUX_PLUGIN_VERSION, MVCNN_VERSION_MAJOR,
+                                MVCNN_VERSION_MINOR, MVCNN_VERSION_PATCH));
+
+    return llvm::toHex(hasher.final(), /*LowerCase=*/true);
+}
+
+std::string vpux::CompilationCache::getBlobPath(StringRef key) const {
+    SmallString path(_dirPath);
+    llvm::sys::path::append(path, key + BLOB_EXTENSION);
+    return path.str().str();
+}
+
+MappedBlob::Ptr vpux::CompilationCache::load(StringRef key) const {
+    const auto path = getBlobPath(key);
+    if (!llvm::sys::fs::exists(path)) {
+        _log.trace("No blob for the key '{0}'", key);
+        return nullptr;
+    }
+
+    // The modification time is the last use time for the eviction. The file is touched before it is mapped,
+    // since the existing mappings are shared only while the modification time is unchanged.
+    touch(path);
+
+    try {
+        auto blob = MappedBlob::open(path);
+        _log.trace("Loaded blob '{0}' of {1} bytes", path, blob->size());
+        return blob;
+    } catch (const std::exception& ex) {
+        // The file might have been evicted by another process in the meantime
+        _log.warning("Failed to load blob '{0}' : {1}", path, ex.what());
+        return nullptr;
+    }
+}
+
+void vpux::CompilationCache::store(StringRef key, ArrayRef<char> blob) const {
+    if (_maxSize != 0 && checked_cast<int64_t>(blob.size()) > _maxSize) {
+        _log.warning("Blob of {0} bytes does not fit the cache size limit {1}", blob.size(), _maxSize);
+        return;
+    }
+
+    if (const auto err = llvm::sys::fs::create_directories(_dirPath)) {
+        _log.warning("Failed to create directory '{0}' : {1}", _dirPath, err.message());
+        return;
+    }
+
+    const auto path = getBlobPath(key);
+
+    // The blob is written into a unique temporary file, which is then renamed, so the concurrent processes
+    // storing the same key never see a partially written file
+    SmallString tempPathModel(_dirPath);
+    llvm::sys::path::append(tempPathModel, key + "-%%%%%%%%" + TEMP_EXTENSION);
+
+    if (auto err = llvm::writeFileAtomically(tempPathModel, path, StringRef(blob.data(), blob.size()))) {
+        _log.warning("Failed to write blob '{0}' : {1}", path, llvm::toString(std::move(err)));
+        return;
+    }
+
+    _log.trace("Stored blob '{0}' of {1} bytes", path, blob.size());
+
+    evict(path);
+}
+
+// Removes the least recently used blobs until the total size fits the limit.
+// The other processes may be removing the same files, so the failures are ignored.
+void vpux::CompilationCache::evict(StringRef keepPath) const {
+    if (_maxSize == 0) {
+        return;
+    }
+
+    struct Entry final {
+        std::string path;
+        llvm::sys::TimePoint<> lastUse;
+        int64_t size;
+    };
+
+    SmallVector<Entry> entries;
+    int64_t totalSize = 0;
+
+    const llvm::sys::TimePoint<> now = std::chrono::system_clock::now();
+
+    std::error_code ec;
+    for (llvm::sys::fs::directory_iterator it(_dirPath, ec), end; it != end && !ec; it.increment(ec)) {
+        const auto path = it->path();
+        const auto extension = llvm::sys::path::extension(path);
+
+        const auto status = it->status();
+        if (!status || status->type() != llvm::sys::fs::file_type::regular_file) {
+            continue;
+        }
+
+        const auto lastUse = status->getLastModificationTime();
+
+        if (extension == TEMP_EXTENSION) {
+            if (now - lastUse > STALE_TEMP_FILE_AGE) {
+                llvm::sys::fs::remove(path);
+            }
+            continue;
+        }
+
+        if (extension != BLOB_EXTENSION) {
+            continue;
+        }
+
+        const auto size = checked_cast<int64_t>(status->getSize());
+        entries.push_back({path, lastUse, size});
+        totalSize += size;
+    }
+
+    if (totalSize <= _maxSize) {
+        return;
+    }
+
+    llvm::sort(entries, [](const Entry& lhs, const Entry& rhs) {
+        return lhs.lastUse < rhs.lastUse;
+    });
+
+    for (const auto& entry : entries) {
+        if (totalSize <= _maxSize) {
+            break;
+        }
+        if (entry.path == keepPath) {
+            continue;
+        }
+
+        if (!llvm::sys::fs::remove(entry.path)) {
+            _log.trace("Evicted blob '{0}' of {1} bytes", entry.path, entry.size);
+        }
+
+        totalSize -= entry.size;
+    }
+}
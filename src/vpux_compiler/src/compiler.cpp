@@ -6,6 +6,7 @@
 //
 
 #include "vpux/compiler/compiler.hpp"
+#include "vpux/compiler/compilation_cache.hpp"
 
 #include "vpux/al/config/common.hpp"
 #include "vpux/al/config/compiler.hpp"
@@ -17,6 +18,8 @@
 #include "vpux/compiler/dialect/VPUIP/graph-schema/export.hpp"
 #include "vpux/compiler/dialect/VPUIP/network_description.hpp"
 #include "vpux/compiler/dialect/VPUIP/ops.hpp"
+#include "vpux/compiler/dialect/const/ops.hpp"
+#include "vpux/compiler/dialect/const/utils/content_cache.hpp"
 #include "vpux/compiler/frontend/IE.hpp"
 #include "vpux/compiler/init.hpp"
 #include "vpux/compiler/pipelines.hpp"
@@ -119,6 +122,15 @@ public:
         return _crashReproducerFile.empty() && _irPrintingFilter.empty();
     }
 
+    // The stream of the timing report, null if the timing is disabled
+    llvm::raw_ostream* getTimingStream() const {
+        return _timingStream;
+    }
+
+    bool hasCompilationDumps() const {
+        return !_crashReproducerFile.empty() || !_irPrintingFilter.empty() || !_printDotOptions.empty();
+    }
+
 private:
     Logger _log;
 
@@ -373,6 +385,31 @@ auto exportToBlob(mlir::ModuleOp module, mlir::TimingScope& rootTiming,
     return VPUIP::exportToBlob(module, exportTiming, preprocessInfo, parameters, results, log);
 }
 
+// The counters are printed as a separate section of the compile timing output
+void reportConstFoldingCacheStatistics(mlir::MLIRContext& ctx, const DeveloperConfig& devConf) {
+    auto* timingStream = devConf.getTimingStream();
+    if (timingStream == nullptr) {
+        return;
+    }
+
+    auto* dialect = ctx.getLoadedDialect<Const::ConstDialect>();
+    if (dialect == nullptr || dialect->getFoldedContentCache() == nullptr) {
+        return;
+    }
+
+    const auto& stats = dialect->getFoldedContentCacheStatistics();
+    const auto usedSize = dialect->getFoldedContentCache()->getUsedSize();
+
+    auto& os = *timingStream;
+    os << "===-------------------------------------------------------------------------===\n";
+    os << "                            Folded constants cache\n";
+    os << "===-------------------------------------------------------------------------===\n";
+    printTo(os, "  Hits      : {0}\n", stats.hits);
+    printTo(os, "  Misses    : {0}\n", stats.misses);
+    printTo(os, "  Evictions : {0}\n", stats.evictions);
+    printTo(os, "  Used size : {0}\n\n", usedSize);
+}
+
 bool isIR10(const ov::Model& model) {
     const auto& rtInfo = model.get_rt_info();
     const auto it = rtInfo.find("version");
@@ -438,6 +475,13 @@ std::vector<std::shared_ptr<const ov::Node>> buildOVResults(const std::shared_pt
     return constResults;
 }
 
+// Everything, except the model, the compiled blob depends on
+std::string getCompilationCacheOptions(const Config& config) {
+    return printToString("arch={0};mode={1};params={2};dpu-groups={3};profiling={4}", getArchKind(config),
+                         getCompilationMode(config), config.get<COMPILATION_MODE_PARAMS>(),
+                         getNumberOfDPUGroups(config).getValueOr(-1), config.get<PERF_COUNT>());
+}
+
 }  // namespace
 
 std::shared_ptr<INetworkDescription> vpux::CompilerImpl::compile(const std::shared_ptr<ngraph::Function>& func,
@@ -448,6 +492,27 @@ std::shared_ptr<INetworkDescription> vpux::CompilerImpl::compile(const std::shar
 
     DeveloperConfig devConf(log);
 
+    // The IR and dot dumps and the crash reproducer are requested to look at the compilation itself,
+    // so the cache is bypassed
+    Optional<CompilationCache> cache;
+    std::string cacheKey;
+    if (!config.get<COMPILATION_CACHE_DIR>().empty() && !devConf.hasCompilationDumps()) {
+        cache.emplace(config.get<COMPILATION_CACHE_DIR>(), config.get<COMPILATION_CACHE_SIZE>(),
+                      log.nest("compilation-cache"));
+        cacheKey = CompilationCache::getKey(func, inputsInfo, outputsInfo, getCompilationCacheOptions(config));
+
+        if (auto cachedBlob = cache->load(cacheKey)) {
+            try {
+                auto networkDesc = std::make_shared<VPUIP::NetworkDescription>(std::move(cachedBlob));
+                log.info("Loaded compiled network from the cache, key '{0}'", cacheKey);
+                return networkDesc;
+            } catch (const std::exception& ex) {
+                log.warning("Cached blob for the key '{0}' is invalid, compiling the network : {1}", cacheKey,
+                            ex.what());
+            }
+        }
+    }
+
     mlir::DefaultTimingManager tm;
     devConf.setup(tm);
 
@@ -461,6 +526,10 @@ std::shared_ptr<INetworkDescription> vpux::CompilerImpl::compile(const std::shar
     addLogging(pm, log);
     devConf.setup(pm);
 
+    if (auto constFoldingCache = getConstFoldingCache(config)) {
+        ctx.getOrLoadDialect<Const::ConstDialect>()->setFoldedContentCache(std::move(constFoldingCache));
+    }
+
     auto rootTiming = tm.getRootScope();
     buildPipeline(pm, config, rootTiming, log);
 
@@ -468,13 +537,36 @@ std::shared_ptr<INetworkDescription> vpux::CompilerImpl::compile(const std::shar
     std::vector<vpux::PreProcessInfo> preProcInfo;
     const auto module = importNetwork(&ctx, cnnNet, devConf, preProcInfo, rootTiming, config.get<PERF_COUNT>(), log);
     compileNetwork(module.get(), pm, rootTiming);
-    const auto blob = exportToBlob(module.get(), rootTiming, preProcInfo, buildOVParams(func, inputsInfo),
-                                   buildOVResults(func, outputsInfo), log);
+    auto blob = exportToBlob(module.get(), rootTiming, preProcInfo, buildOVParams(func, inputsInfo),
+                             buildOVResults(func, outputsInfo), log);
+    reportConstFoldingCacheStatistics(ctx, devConf);
+
+    if (cache.hasValue()) {
+        auto cacheTiming = rootTiming.nest("Store into compilation cache");
+        cache->store(cacheKey, makeArrayRef(reinterpret_cast<const char*>(blob.data()), blob.size()));
+    }
 
     auto finalTiming = rootTiming.nest("Wrap into NetworkDescription");
-    std::vector<char> compiledNetwork(blob.size());
-    std::copy_n(reinterpret_cast<const char*>(blob.data()), blob.size(), compiledNetwork.data());
-    return std::make_shared<VPUIP::NetworkDescription>(std::move(compiledNetwork));
+    return std::make_shared<VPUIP::NetworkDescription>(std::move(blob));
+}
+
+//
+// CompilerImpl::getConstFoldingCache
+//
+
+std::shared_ptr<Const::FoldedContentCache> vpux::CompilerImpl::getConstFoldingCache(const Config& config) {
+    const auto maxSize = Byte(config.get<CONST_FOLDING_CACHE_SIZE>());
+    if (maxSize.count() <= 0) {
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(_constFoldingCacheMutex);
+
+    if (_constFoldingCache == nullptr || _constFoldingCache->getMaxSize() != maxSize) {
+        _constFoldingCache = std::make_shared<Const::FoldedContentCache>(maxSize);
+    }
+
+    return _constFoldingCache;
 }
 
 //
@@ -486,6 +578,11 @@ std::shared_ptr<vpux::INetworkDescription> vpux::CompilerImpl::parse(const std::
     return std::make_shared<VPUIP::NetworkDescription>(compiledNetwork);
 }
 
+std::shared_ptr<vpux::INetworkDescription> vpux::CompilerImpl::parse(const MappedBlob::Ptr& blob, const Config&,
+                                                                     const std::string&) {
+    return std::make_shared<VPUIP::NetworkDescription>(blob);
+}
+
 //
 // CreateVPUXCompiler
 //
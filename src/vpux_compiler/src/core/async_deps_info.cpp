@@ -11,8 +11,33 @@
 
 #include "vpux/utils/core/range.hpp"
 
+#include <algorithm>
+#include <limits>
+
 using namespace vpux;
 
+namespace {
+
+// The dense transitive closure is the fastest for the usual graphs, but its bit matrix does not fit the memory
+// for the large unrolled multi-cluster ones (~600 MB for 50k operations)
+constexpr size_t DENSE_DEPS_OPTIMIZATION_MAX_OPS = 8192;
+
+template <class IndexList>
+void insertIndex(IndexList& list, uint32_t index) {
+    // The indexes are added mostly in increasing order
+    if (list.empty() || list.back() < index) {
+        list.push_back(index);
+        return;
+    }
+
+    const auto it = std::lower_bound(list.begin(), list.end(), index);
+    if (it == list.end() || *it != index) {
+        list.insert(it, index);
+    }
+}
+
+}  // namespace
+
 //
 // Constructor
 //
@@ -58,9 +83,6 @@ void vpux::AsyncDepsInfo::buildDepsMap(mlir::FuncOp func) {
     }
 
     _depsMap.resize(_allExecOps.size());
-    for (auto& deps : _depsMap) {
-        deps.resize(checked_cast<uint32_t>(_allExecOps.size()));
-    }
 
     for (auto& op : func.getOps()) {
         if (auto execOp = mlir::dyn_cast<mlir::async::ExecuteOp>(op)) {
@@ -97,7 +119,7 @@ void vpux::AsyncDepsInfo::addExecOp(mlir::async::ExecuteOp execOp) {
         _log.trace("It has a dependency from other 'async.execute' Operation at '{0}'", argExecOp->getLoc());
 
         const auto argExecInd = getIndex(argExecOp);
-        _depsMap[execInd].set(argExecInd);
+        insertIndex(_depsMap[execInd], argExecInd);
     }
 
     _log = _log.unnest();
@@ -110,7 +132,7 @@ void vpux::AsyncDepsInfo::addExecOp(mlir::async::ExecuteOp execOp) {
 void vpux::AsyncDepsInfo::addDependency(mlir::async::ExecuteOp from, mlir::async::ExecuteOp to) {
     const auto fromInd = getIndex(from);
     const auto toInd = getIndex(to);
-    _depsMap[toInd].set(fromInd);
+    insertIndex(_depsMap[toInd], fromInd);
 }
 
 //
@@ -125,19 +147,107 @@ void vpux::AsyncDepsInfo::optimizeDepsMap() {
     // since it will be implicit dependency taken from B.
     //
 
-    for (auto& curDeps : _depsMap) {
+    if (_depsMap.size() <= DENSE_DEPS_OPTIMIZATION_MAX_OPS || !isIndexedInTopologicalOrder()) {
+        optimizeDepsMapDense();
+    } else {
+        optimizeDepsMapSparse();
+    }
+}
+
+bool vpux::AsyncDepsInfo::isIndexedInTopologicalOrder() const {
+    for (const auto& p : _depsMap | indexed) {
+        const auto& curDeps = p.value();
+        if (!curDeps.empty() && curDeps.back() >= p.index()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void vpux::AsyncDepsInfo::optimizeDepsMapDense() {
+    const auto numOps = checked_cast<uint32_t>(_depsMap.size());
+
+    SmallVector<llvm::BitVector> depsMap(numOps, llvm::BitVector(numOps));
+    for (auto p : _depsMap | indexed) {
+        for (auto depInd : p.value()) {
+            depsMap[p.index()].set(depInd);
+        }
+    }
+
+    for (auto& curDeps : depsMap) {
         for (auto curDepInd : curDeps.set_bits()) {
-            const auto& depOfDeps = _depsMap[curDepInd];
+            const auto& depOfDeps = depsMap[curDepInd];
             curDeps |= depOfDeps;
         }
     }
 
-    for (auto& curDeps : _depsMap | reversed) {
+    for (auto& curDeps : depsMap | reversed) {
         for (auto curDepInd : curDeps.set_bits()) {
-            const auto& depOfDeps = _depsMap[curDepInd];
+            const auto& depOfDeps = depsMap[curDepInd];
             curDeps.reset(depOfDeps);
         }
     }
+
+    for (auto p : depsMap | indexed) {
+        auto& curDeps = _depsMap[p.index()];
+        curDeps.clear();
+        for (auto depInd : p.value().set_bits()) {
+            curDeps.push_back(checked_cast<uint32_t>(depInd));
+        }
+    }
+}
+
+void vpux::AsyncDepsInfo::optimizeDepsMapSparse() {
+    //
+    // Transitive reduction without the closure matrix, for the graphs where every operation depends only on
+    // the operations with lower index.
+    //
+    // A dependency is redundant, if it is reachable from another dependency. Only the dependencies with higher
+    // index can reach it, so they are visited in decreasing order and everything reachable from the kept ones
+    // is marked. The search stops at the lowest dependency index, since the operations below it can't reach
+    // any of the dependencies. The lists of the previous operations are already reduced, which keeps the same
+    // reachability and shortens the search.
+    //
+
+    constexpr auto NOT_VISITED = std::numeric_limits<uint32_t>::max();
+    SmallVector<uint32_t> visitedBy(_depsMap.size(), NOT_VISITED);
+    SmallVector<uint32_t> stack;
+
+    for (auto p : _depsMap | indexed) {
+        auto& curDeps = p.value();
+        if (curDeps.size() < 2) {
+            continue;
+        }
+
+        const auto curInd = checked_cast<uint32_t>(p.index());
+        const auto minDepInd = curDeps.front();
+
+        IndexList reducedDeps;
+        for (auto depInd : curDeps | reversed) {
+            if (visitedBy[depInd] == curInd) {
+                continue;
+            }
+
+            reducedDeps.push_back(depInd);
+
+            stack.push_back(depInd);
+            while (!stack.empty()) {
+                const auto opInd = stack.pop_back_val();
+                for (auto depOfDepInd : _depsMap[opInd] | reversed) {
+                    if (depOfDepInd < minDepInd) {
+                        break;
+                    }
+                    if (visitedBy[depOfDepInd] != curInd) {
+                        visitedBy[depOfDepInd] = curInd;
+                        stack.push_back(depOfDepInd);
+                    }
+                }
+            }
+        }
+
+        std::reverse(reducedDeps.begin(), reducedDeps.end());
+        curDeps = std::move(reducedDeps);
+    }
 }
 
 //
@@ -147,13 +257,9 @@ void vpux::AsyncDepsInfo::optimizeDepsMap() {
 void vpux::AsyncDepsInfo::buildConsMap() {
     _consumerMap.resize(_depsMap.size());
 
-    for (auto& cons : _consumerMap) {
-        cons.resize(checked_cast<uint32_t>(_depsMap.size()));
-    }
-
     for (size_t idx = 0; idx < _depsMap.size(); idx++) {
-        for (auto bit : _depsMap[idx].set_bits()) {
-            _consumerMap[checked_cast<size_t>(bit)].set(checked_cast<uint32_t>(idx));
+        for (auto dep : _depsMap[idx]) {
+            insertIndex(_consumerMap[dep], checked_cast<uint32_t>(idx));
         }
     }
 }
@@ -173,7 +279,7 @@ void vpux::AsyncDepsInfo::updateTokenDependencies() {
         const auto& execDeps = _depsMap[execInd];
 
         SmallVector<mlir::Value> depsVec;
-        for (auto depInd : execDeps.set_bits()) {
+        for (auto depInd : execDeps) {
             depsVec.push_back(_allExecOps[depInd].token());
         }
 
@@ -191,12 +297,6 @@ size_t vpux::AsyncDepsInfo::insertNewExecOpToDepsMap(mlir::async::ExecuteOp exec
 
     _depsMap.resize(_allExecOps.size());
     _consumerMap.resize(_allExecOps.size());
-    for (auto& deps : _depsMap) {
-        deps.resize(checked_cast<uint32_t>(_allExecOps.size()));
-    }
-    for (auto& cons : _consumerMap) {
-        cons.resize(checked_cast<uint32_t>(_allExecOps.size()));
-    }
 
     addExecOp(execOp);
     return newIndex;
@@ -205,7 +305,7 @@ size_t vpux::AsyncDepsInfo::insertNewExecOpToDepsMap(mlir::async::ExecuteOp exec
 SmallVector<size_t> vpux::AsyncDepsInfo::getOpDeps(size_t opIdx) const {
     VPUX_THROW_UNLESS(_depsMap.size() > opIdx, "Invalid index '{0}' for _depsMap", opIdx);
     SmallVector<size_t> opDeps = {};
-    for (auto dep : _depsMap[opIdx].set_bits()) {
+    for (auto dep : _depsMap[opIdx]) {
         opDeps.push_back(static_cast<size_t>(dep));
     }
     return opDeps;
@@ -214,7 +314,7 @@ SmallVector<size_t> vpux::AsyncDepsInfo::getOpDeps(size_t opIdx) const {
 SmallVector<size_t> vpux::AsyncDepsInfo::getConsumerOps(size_t opIdx) const {
     VPUX_THROW_UNLESS(!_consumerMap.empty(), "Consumer map was not build");
     SmallVector<size_t> consumerOps = {};
-    for (auto con : _consumerMap[opIdx].set_bits()) {
+    for (auto con : _consumerMap[opIdx]) {
         consumerOps.push_back(static_cast<size_t>(con));
     }
     return consumerOps;
@@ -223,7 +323,7 @@ SmallVector<size_t> vpux::AsyncDepsInfo::getConsumerOps(size_t opIdx) const {
 std::unordered_map<size_t, size_t> vpux::AsyncDepsInfo::calculateOpInDegreeTable() const {
     std::unordered_map<size_t, size_t> opInDegree;
     for (size_t i = 0; i < _depsMap.size(); ++i) {
-        opInDegree[i] = static_cast<size_t>(_depsMap[i].count());
+        opInDegree[i] = _depsMap[i].size();
     }
     return opInDegree;
 }
@@ -232,7 +332,7 @@ std::unordered_map<size_t, size_t> vpux::AsyncDepsInfo::calculateOpOutDegreeTabl
     VPUX_THROW_UNLESS(!_consumerMap.empty(), "Consumer map was not build");
     std::unordered_map<size_t, size_t> opOutDegree;
     for (size_t i = 0; i < _consumerMap.size(); ++i) {
-        opOutDegree[i] = static_cast<size_t>(_consumerMap[i].count());
+        opOutDegree[i] = _consumerMap[i].size();
     }
     return opOutDegree;
 }
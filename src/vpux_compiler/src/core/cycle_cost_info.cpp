@@ -0,0 +1,221 @@
+//
+// Copyright (C) 2022 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+//
+
+#include "vpux/compiler/core/cycle_cost_info.hpp"
+
+#include "vpux/compiler/dialect/IE/utils/resources.hpp"
+#include "vpux/compiler/dialect/IERT/ops.hpp"
+#include "vpux/compiler/dialect/VPU/cost_model.hpp"
+#include "vpux/compiler/dialect/VPUIP/utils.hpp"
+#include "vpux/compiler/utils/attributes.hpp"
+
+#include "vpux/utils/core/checked_cast.hpp"
+
+#include <cmath>
+#include <map>
+
+using namespace vpux;
+
+namespace {
+
+// Bandwidth in bytes per cycle used for memories which are not described in the module resources
+constexpr double DEFAULT_MEMORY_BANDWIDTH = 8.0;
+
+// Software kernels have no cost model yet, assume a fixed launch overhead and one output element per cycle
+constexpr size_t SW_KERNEL_LAUNCH_CYCLES = 1000;
+
+int64_t getNumOfDPUs(mlir::ModuleOp module) {
+    auto nceCluster = IE::getAvailableExecutor(module, VPU::ExecutorKind::NCE);
+    VPUX_THROW_UNLESS(nceCluster != nullptr, "Failed to get NCE_Cluster information");
+
+    auto dpuExec =
+            nceCluster.getSubExecutor(VPU::ExecutorKindAttr::get(module.getContext(), VPU::ExecutorKind::DPU));
+    VPUX_THROW_UNLESS(dpuExec != nullptr, "Failed to get DPU information");
+
+    return dpuExec.count();
+}
+
+bool isDMAExecutor(mlir::async::ExecuteOp execOp) {
+    if (!execOp->hasAttr(IERT::IERTDialect::getExecutorAttrName())) {
+        return false;
+    }
+
+    const auto executor = IERT::IERTDialect::getExecutor(execOp);
+    return executor.getLeafNameAttr() == VPU::ExecutorKindAttr::get(execOp->getContext(), VPU::ExecutorKind::DMA_NN);
+}
+
+}  // namespace
+
+//
+// Constructor
+//
+
+vpux::CycleCostInfo::CycleCostInfo(mlir::ModuleOp module, Logger log)
+        : _log(log),
+          _module(module),
+          _arch(VPU::getArch(module)),
+          _numDPU(getNumOfDPUs(module)),
+          _workloadCostCache(VPU::createCostModel(_arch)) {
+}
+
+//
+// getCycleCost
+//
+
+size_t vpux::CycleCostInfo::getCycleCost(mlir::async::ExecuteOp execOp) {
+    const auto cached = _cycleCosts.find(execOp.getOperation());
+    if (cached != _cycleCosts.end()) {
+        return cached->second;
+    }
+
+    const auto isDMA = isDMAExecutor(execOp);
+
+    size_t cost = 0;
+    for (auto& op : execOp.body().front().getOperations()) {
+        if (mlir::isa<IERT::LayerOpInterface>(op) || mlir::isa<VPUIP::NCEClusterTilingOp>(op)) {
+            cost += getLayerCost(&op, isDMA);
+        }
+    }
+
+    // Every operation occupies its executor for at least one cycle
+    cost = std::max<size_t>(cost, 1);
+
+    _log.trace("Operation '{0}' is estimated to take '{1}' cycles", execOp->getLoc(), cost);
+    _cycleCosts[execOp.getOperation()] = cost;
+    return cost;
+}
+
+size_t vpux::CycleCostInfo::getLayerCost(mlir::Operation* op, bool isDMA) {
+    if (isDMA) {
+        if (op->getNumOperands() == 0 || op->getNumResults() == 0) {
+            return 0;
+        }
+
+        // CopyOp can be placed directly in async exec op or wrapped with NCEClusterTiling,
+        // in both cases the first operand is the source and the first result is the destination
+        const auto srcType = op->getOperand(0).getType().cast<vpux::NDTypeInterface>();
+        const auto dstType = op->getResult(0).getType().cast<vpux::NDTypeInterface>();
+        return getDMACost(dstType.getTotalAllocSize(), srcType.getMemoryKind(), dstType.getMemoryKind());
+    }
+
+    auto* taskOp = op;
+    if (auto clusterTilingOp = mlir::dyn_cast<VPUIP::NCEClusterTilingOp>(op)) {
+        taskOp = clusterTilingOp.getInnerTaskOp();
+    }
+
+    if (auto nceOp = mlir::dyn_cast_or_null<VPUIP::NCEClusterTaskOp>(taskOp)) {
+        return getNCECost(nceOp);
+    }
+
+    return getSWCost(op);
+}
+
+//
+// getDMACost
+//
+
+size_t vpux::CycleCostInfo::getDMACost(Byte size, VPU::MemoryKind srcMemKind, VPU::MemoryKind dstMemKind) {
+    const auto bandwidth = std::min(getBandwidth(srcMemKind), getBandwidth(dstMemKind));
+    return checked_cast<size_t>(std::ceil(static_cast<double>(size.count()) / bandwidth));
+}
+
+double vpux::CycleCostInfo::getBandwidth(VPU::MemoryKind memKind) {
+    const auto cached = _bandwidths.find(memKind);
+    if (cached != _bandwidths.end()) {
+        return cached->second;
+    }
+
+    auto bandwidth = DEFAULT_MEMORY_BANDWIDTH;
+
+    auto mem = IE::getAvailableMemory(_module, memKind);
+    if (mem != nullptr && mem->hasAttr(VPU::getMemoryBandwidthAttrName())) {
+        bandwidth = VPUIP::getMemoryBandwidth(mem);
+        if (mem->hasAttr(VPU::getMemoryDerateAttrName())) {
+            bandwidth *= VPUIP::getMemoryDerateFactor(mem);
+        }
+    }
+
+    VPUX_THROW_UNLESS(bandwidth > 0, "Got non-positive bandwidth '{0}' for memory '{1}'", bandwidth, memKind);
+
+    _bandwidths[memKind] = bandwidth;
+    return bandwidth;
+}
+
+//
+// getNCECost
+//
+
+size_t vpux::CycleCostInfo::getNCECost(VPUIP::NCEClusterTaskOp nceOp) {
+    // Workloads are described by their x, y and z coordinates, split them per cluster
+    std::map<int64_t, VPUIP::WorkloadSplit> clusterSplits;
+    for (auto dpuTaskOp : nceOp.variants().getOps<VPUIP::DPUTaskOp>()) {
+        const auto start = parseIntArrayAttr<int64_t>(dpuTaskOp.start());
+        const auto end = parseIntArrayAttr<int64_t>(dpuTaskOp.end());
+        VPUX_THROW_UNLESS(start.size() == 3 && end.size() == 3, "Unexpected DPU task coordinates '{0}' - '{1}'",
+                          start, end);
+
+        TileInfo outputTile(4);
+        outputTile.shape[Dims4D::Act::N] = 1;
+        outputTile.shape[Dims4D::Act::C] = end[2] - start[2] + 1;
+        outputTile.shape[Dims4D::Act::H] = end[1] - start[1] + 1;
+        outputTile.shape[Dims4D::Act::W] = end[0] - start[0] + 1;
+        outputTile.offsets[Dims4D::Act::C] = start[2];
+        outputTile.offsets[Dims4D::Act::H] = start[1];
+        outputTile.offsets[Dims4D::Act::W] = start[0];
+
+        const auto clusterId = dpuTaskOp.cluster_id().getValueOr(0);
+        clusterSplits[clusterId].push_back(std::make_tuple(outputTile, dpuTaskOp.mpe_mode()));
+    }
+
+    if (clusterSplits.empty()) {
+        // Workloads were not assigned, fall back to the generic estimation
+        return getSWCost(nceOp);
+    }
+
+    const auto inputType = nceOp.input().getType().cast<vpux::NDTypeInterface>();
+    const auto outputType = nceOp.output_buff().getType().cast<vpux::NDTypeInterface>();
+    const auto parentInputType = nceOp.parent_input().getType().cast<vpux::NDTypeInterface>();
+
+    VPUIP::WorkloadCostParams params;
+    params.nceTaskType = nceOp.task_type();
+    params.dataType = inputType.getElementType();
+    params.arch = _arch;
+    params.fullInputShape = parentInputType.getShape().raw();
+    params.inputShape = inputType.getShape().raw();
+    params.outputShape = outputType.getShape().raw();
+    params.padInfo = nceOp.kernel_paddingAttr() != nullptr ? VPU::toPadInfo(nceOp.kernel_paddingAttr())
+                                                            : PadInfo(0, 0, 0, 0);
+    params.numDPU = _numDPU;
+    params.kernelSize = nceOp.kernel_sizeAttr() != nullptr ? parseIntArrayAttr<int64_t>(nceOp.kernel_sizeAttr())
+                                                           : SmallVector<int64_t>{1, 1};
+    params.kernelStride = nceOp.kernel_stridesAttr() != nullptr
+                                  ? parseIntArrayAttr<int64_t>(nceOp.kernel_stridesAttr())
+                                  : SmallVector<int64_t>{1, 1};
+
+    // Clusters run in parallel, the slowest one defines the duration of the task
+    int64_t cost = 0;
+    for (const auto& clusterSplit : clusterSplits) {
+        cost = std::max(cost, VPUIP::computeSplitCost(clusterSplit.second, params, _workloadCostCache));
+    }
+
+    return checked_cast<size_t>(cost);
+}
+
+//
+// getSWCost
+//
+
+size_t vpux::CycleCostInfo::getSWCost(mlir::Operation* op) {
+    size_t numElements = 0;
+    for (auto result : op->getResults()) {
+        if (auto type = result.getType().dyn_cast<vpux::NDTypeInterface>()) {
+            numElements += checked_cast<size_t>(type.getNumElements());
+        }
+    }
+
+    return SW_KERNEL_LAUNCH_CYCLES + numElements;
+}
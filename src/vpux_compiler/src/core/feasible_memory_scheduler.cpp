@@ -30,16 +30,20 @@ using operationIdxType = FeasibleMemoryScheduler::operationIdxType;
 // 1. Scheduling the next earliest operation from the start time heap, and adding it to the op output table.
 // 2. Unscheduling operations: freeing CMX space and updating dependencies, creating new ready
 //      operations which will be allocated at the next time slot.
+// By default every operation takes a single unit of time. If CycleCostInfo is provided, operations take
+// their estimated number of cycles instead, so DMAs can overlap with long running compute operations.
 
 FeasibleMemoryScheduler::FeasibleMemoryScheduler(VPU::MemoryKind memKind, MemLiveRangeInfo& liveRangeInfo,
                                                  AsyncDepsInfo& depsInfo, AliasesInfo& aliasInfo, Logger log,
-                                                 LinearScan<mlir::Value, LinearScanHandler>& scan)
+                                                 LinearScan<mlir::Value, LinearScanHandler>& scan,
+                                                 CycleCostInfo* cycleCostInfo)
         : _log(log),
           _memKind(memKind),
           _liveRangeInfo(liveRangeInfo),
           _depsInfo(depsInfo),
           _aliasInfo(aliasInfo),
-          _scan(scan) {
+          _scan(scan),
+          _cycleCostInfo(cycleCostInfo) {
 }
 
 void FeasibleMemoryScheduler::pushToStartTimeHeap(const HeapElement& elem) {
@@ -495,7 +499,7 @@ void FeasibleMemoryScheduler::scheduleInputOpForComputeOp(operationIdxType input
     pushToStartTimeHeap(HeapElement(inputIdx, _currentTime + delay, EOpType::ORIGINAL_OP));
 }
 
-void FeasibleMemoryScheduler::scheduleSpilledOpBuffer(operationIdxType inputIdx, mlir::Value* buffer) {
+size_t FeasibleMemoryScheduler::scheduleSpilledOpBuffer(operationIdxType inputIdx, mlir::Value* buffer) {
     // schedule the spilled dependency
     _log.nest().trace("Scheduling spilled op:'{0}'", inputIdx);
     auto _opOutput = _opOutputTable.find(inputIdx);
@@ -506,14 +510,19 @@ void FeasibleMemoryScheduler::scheduleSpilledOpBuffer(operationIdxType inputIdx,
     (_opOutput->second).changeStateToActive();
     // also store the buffer spilled
     auto spilledReadBuffer = *buffer;
-    pushToStartTimeHeap(HeapElement(inputIdx, _currentTime, EOpType::IMPLICIT_OP_READ, spilledReadBuffer));
+    HeapElement spillRead(inputIdx, _currentTime, EOpType::IMPLICIT_OP_READ, spilledReadBuffer);
+    pushToStartTimeHeap(spillRead);
+
+    return getOpDuration(spillRead);
 }
 
 size_t FeasibleMemoryScheduler::allocateBuffersAndInputOps(operationIdxType opIdx, Partitioner::Direction allocDir) {
     // retrieve op demand list - input ops
     auto usedBuffers = getNonAliveBuffersUsedByOperation(opIdx);
     auto demandList = getNonEmptyOpDemandList(opIdx, usedBuffers);
-    size_t maxInputDelay = demandList.empty() ? 0 : 1;
+    // delay of the operation start and delay of input ops start, which wait for spilled reads of their buffers
+    size_t maxInputDelay = 0;
+    size_t inputOpsDelay = 0;
     mlir::DenseSet<mlir::Value> buffersNeedingAllocation;
 
     // retrieve operation's buffers that need allocation
@@ -527,8 +536,7 @@ size_t FeasibleMemoryScheduler::allocateBuffersAndInputOps(operationIdxType opId
             auto executeOpIdx =
                     _depsInfo.getIndex(writerOp->getBlock()->getParent()->getParentOfType<mlir::async::ExecuteOp>());
             demandList.erase(executeOpIdx);
-            scheduleSpilledOpBuffer(executeOpIdx, &val);
-            maxInputDelay = 1;
+            maxInputDelay = std::max(maxInputDelay, scheduleSpilledOpBuffer(executeOpIdx, &val));
         }
     }
 
@@ -544,11 +552,11 @@ size_t FeasibleMemoryScheduler::allocateBuffersAndInputOps(operationIdxType opId
                 auto writerOp = retrieveBufferWriter(val);
                 auto executeOpIdx = _depsInfo.getIndex(
                         writerOp->getBlock()->getParent()->getParentOfType<mlir::async::ExecuteOp>());
-                scheduleSpilledOpBuffer(executeOpIdx, &val);
-                maxInputDelay = 2;
+                inputOpsDelay = std::max(inputOpsDelay, scheduleSpilledOpBuffer(executeOpIdx, &val));
             }
         }
-        scheduleInputOpForComputeOp(inputIdx, maxInputDelay - 1);
+        scheduleInputOpForComputeOp(inputIdx, inputOpsDelay);
+        maxInputDelay = std::max(maxInputDelay, inputOpsDelay + getOpDuration(HeapElement(inputIdx)));
     }
 
     auto sortedBuffers = sortUsedBuffers(buffersNeedingAllocation);
@@ -561,20 +569,21 @@ size_t FeasibleMemoryScheduler::allocateBuffersAndInputOps(operationIdxType opId
     // Check if any of operation input dependencies have been scheduled
     // in the same scheduler iteration. In such case delay might need to be adjusted
     // based on start time of its input dependencies
-    size_t depOpsMaxTimeInStartHeap = 0;
+    size_t depOpsMaxEndTimeInStartHeap = 0;
     for (auto& dep : _depsInfo.getOpDeps(opIdx)) {
         auto depOpInStartHeap = std::find_if(_startTimeHeap.begin(), _startTimeHeap.end(), [&](HeapElement el) {
             return (dep == el.op_);
         });
         if (depOpInStartHeap != _startTimeHeap.end()) {
-            if (depOpInStartHeap->time_ > depOpsMaxTimeInStartHeap) {
-                depOpsMaxTimeInStartHeap = depOpInStartHeap->time_;
+            const auto depOpEndTime = depOpInStartHeap->time_ + getOpDuration(*depOpInStartHeap);
+            if (depOpEndTime > depOpsMaxEndTimeInStartHeap) {
+                depOpsMaxEndTimeInStartHeap = depOpEndTime;
             }
         }
     }
-    if (depOpsMaxTimeInStartHeap > 0) {
-        if (_currentTime + maxInputDelay <= depOpsMaxTimeInStartHeap) {
-            maxInputDelay = depOpsMaxTimeInStartHeap + 1 - _currentTime;
+    if (depOpsMaxEndTimeInStartHeap > 0) {
+        if (_currentTime + maxInputDelay < depOpsMaxEndTimeInStartHeap) {
+            maxInputDelay = depOpsMaxEndTimeInStartHeap - _currentTime;
         }
     }
 
@@ -1004,6 +1013,8 @@ void FeasibleMemoryScheduler::populateScheduledOps(HeapElement& scheduledOp) {
     scheduled.op_ = scheduledOp.op_;
     scheduled.opType_ = scheduledOp.opType_;
     scheduled.time_ = scheduledOp.time_;
+    scheduled.cycleBegin_ = scheduledOp.time_;
+    scheduled.cycleEnd_ = scheduledOp.time_ + getOpDuration(scheduledOp);
     scheduled.outputResourceInfo_ = outputIntervals;
     scheduled.inputResourceInfo_ = inputIntervals;
     scheduled.isDataOp_ = isDataOp(scheduledOp.op_);
@@ -1063,7 +1074,7 @@ void FeasibleMemoryScheduler::nextSchedulableOp() {
             // add to output table
             populateScheduledOps(firstOp);
             // move to completion time heap
-            pushToCompletionTimeHeap(HeapElement(firstOp.op_, _currentTime + 1, firstOp.opType_));
+            pushToCompletionTimeHeap(HeapElement(firstOp.op_, _currentTime + getOpDuration(firstOp), firstOp.opType_));
             _log.trace("Scheduled op: '{0}'", firstOp.op_);
             // decrease outputs ops if output op scheduled
             if (_outputOps.find(firstOp.op_) != _outputOps.end()) {
@@ -1088,6 +1099,56 @@ void FeasibleMemoryScheduler::nextSchedulableOp() {
     }
 }
 
+size_t FeasibleMemoryScheduler::getOpDuration(const HeapElement& elem) {
+    if (_cycleCostInfo == nullptr) {
+        return 1;
+    }
+
+    if (!elem.isOriginalOp()) {
+        // spill write or read is a DMA of the spilled buffer between the scheduled memory and DDR
+        const auto spillBufferType = elem.spillBuffer_.getType().cast<vpux::NDTypeInterface>();
+        return _cycleCostInfo->getDMACost(spillBufferType.getTotalAllocSize(), _memKind, VPU::MemoryKind::DDR);
+    }
+
+    return _cycleCostInfo->getCycleCost(_depsInfo.getExecuteOpAtIndex(elem.op_));
+}
+
+void FeasibleMemoryScheduler::finalizeScheduleTime() {
+    _estimatedCycles = 0;
+    if (_scheduledOps.empty()) {
+        return;
+    }
+
+    size_t scheduleBegin = std::numeric_limits<size_t>::max();
+    size_t scheduleEnd = 0;
+    for (const auto& op : _scheduledOps) {
+        scheduleBegin = std::min(scheduleBegin, op.cycleBegin_);
+        scheduleEnd = std::max(scheduleEnd, op.cycleEnd_);
+    }
+    _estimatedCycles = scheduleEnd - scheduleBegin;
+
+    if (_cycleCostInfo == nullptr) {
+        return;
+    }
+
+    // Following steps (prefetching, spilling and control edges) expect time to advance by unit steps,
+    // replace cycle start times with their order while keeping operations starting together at the same time
+    std::set<size_t> startCycles;
+    for (const auto& op : _scheduledOps) {
+        startCycles.insert(op.cycleBegin_);
+    }
+
+    std::unordered_map<size_t, size_t> startCycleToTime;
+    size_t time = 1;
+    for (auto startCycle : startCycles) {
+        startCycleToTime[startCycle] = time++;
+    }
+
+    for (auto& op : _scheduledOps) {
+        op.time_ = startCycleToTime[op.cycleBegin_];
+    }
+}
+
 SmallVector<FeasibleMemoryScheduler::ScheduledOpInfo> FeasibleMemoryScheduler::generateSchedule(
         prefetchMap prefetchEdges) {
     // iteration with prefetching edges
@@ -1099,6 +1160,8 @@ SmallVector<FeasibleMemoryScheduler::ScheduledOpInfo> FeasibleMemoryScheduler::g
     // start the memory scheduler
     init();
 
+    finalizeScheduleTime();
+
     // TODO: save schedule from _scheduledOps to file
 
     _log.trace("Generated Schedule");
@@ -1139,10 +1202,12 @@ SmallVector<FeasibleMemoryScheduler::ScheduledOpInfo> FeasibleMemoryScheduler::g
             }
         }
 
-        _log.trace("op = '{0}'\t type = '{1}'\t time = '{2}'\t inputs = '{3}' outputs = '{4}'", op.op_, op.opTypeName(),
-                   op.time_, inputResourceInfo, outputResourceInfo);
+        _log.trace("op = '{0}'\t type = '{1}'\t time = '{2}'\t cycles = [{3} - {4}]\t inputs = '{5}' outputs = '{6}'",
+                   op.op_, op.opTypeName(), op.time_, op.cycleBegin_, op.cycleEnd_, inputResourceInfo,
+                   outputResourceInfo);
     }
     _log = _log.unnest();
+    _log.trace("Estimated schedule duration: '{0}' cycles", _estimatedCycles);
 
     return _scheduledOps;
 }
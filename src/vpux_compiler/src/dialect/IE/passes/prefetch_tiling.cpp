@@ -86,7 +86,7 @@ void PrefetchTilingPass::safeRunOnFunc() {
         return true;
     });
     target.markUnknownOpDynamicallyLegal([this](mlir::Operation* op) {
-        if (op->hasAttr(manualTilingStrategyApplied)) {
+        if (op->hasAttr(manualTilingStrategyApplied) || op->hasAttr(verticalFusionApplied)) {
             return true;
         }
         if (auto iface = mlir::dyn_cast<IE::TilingInfoOpInterface>(op)) {
@@ -0,0 +1,464 @@
+//
+// Copyright (C) 2022 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+//
+
+#include "vpux/compiler/dialect/IE/passes.hpp"
+
+#include "vpux/compiler/core/cycle_cost_info.hpp"
+#include "vpux/compiler/core/tiling.hpp"
+#include "vpux/compiler/dialect/IE/ops.hpp"
+#include "vpux/compiler/dialect/IE/utils/resources.hpp"
+#include "vpux/compiler/dialect/VPU/cost_model.hpp"
+#include "vpux/compiler/dialect/VPU/manual_strategy_utils.hpp"
+#include "vpux/compiler/dialect/VPU/ops.hpp"
+#include "vpux/compiler/dialect/VPUIP/dpu_tiler.hpp"
+#include "vpux/compiler/dialect/const/ops.hpp"
+#include "vpux/compiler/utils/rewriter.hpp"
+
+#include "vpux/utils/core/range.hpp"
+
+#include <mlir/IR/BlockAndValueMapping.h>
+
+using namespace vpux;
+
+namespace {
+
+// The halo, which is recomputed by every tile, grows with the fused chain depth
+constexpr size_t MAX_FUSION_DEPTH = 4;
+
+//
+// Chain analysis
+//
+
+// The fused operations have a single activation input, all other operands are constants, which are not tiled over H
+bool isFusableOp(mlir::Operation* op) {
+    if (!mlir::isa<VPU::NCEConvolutionOp, VPU::NCEDepthConvolutionOp, VPU::NCEMaxPoolOp>(op)) {
+        return false;
+    }
+    if (!mlir::isa<mlir::FuncOp>(op->getParentOp())) {
+        // The operation is wrapped into the multi-cluster tiling
+        return false;
+    }
+    if (op->hasAttr(manualTilingStrategy) || op->hasAttr(manualTilingStrategyApplied)) {
+        return false;
+    }
+    if (getShape(op->getResult(0)).size() != 4) {
+        return false;
+    }
+
+    return llvm::all_of(op->getOperands().drop_front(), [](mlir::Value operand) {
+        return operand.getDefiningOp<Const::DeclareOp>() != nullptr;
+    });
+}
+
+mlir::Operation* getFusableConsumer(mlir::Operation* op) {
+    auto result = op->getResult(0);
+    if (!result.hasOneUse()) {
+        return nullptr;
+    }
+
+    auto* consumer = *result.getUsers().begin();
+    if (!isFusableOp(consumer) || consumer->getOperand(0) != result) {
+        return nullptr;
+    }
+
+    return consumer;
+}
+
+SmallVector<SmallVector<mlir::Operation*>> getFusableChains(mlir::FuncOp func) {
+    SmallVector<SmallVector<mlir::Operation*>> chains;
+
+    func.walk([&](mlir::Operation* op) {
+        if (!isFusableOp(op)) {
+            return;
+        }
+
+        // Start the chains at their first operation only
+        auto* producer = op->getOperand(0).getDefiningOp();
+        if (producer != nullptr && isFusableOp(producer) && getFusableConsumer(producer) == op) {
+            return;
+        }
+
+        SmallVector<mlir::Operation*> chain{op};
+        while (auto* consumer = getFusableConsumer(chain.back())) {
+            chain.push_back(consumer);
+        }
+
+        if (chain.size() > 1) {
+            chains.push_back(std::move(chain));
+        }
+    });
+
+    return chains;
+}
+
+// The output tiles of every operation of the chain, for the output of the last one split over H into `numTiles`.
+// Each operation computes exactly the rows its consumer needs, including the halo of the consumer kernel.
+SmallVector<OutputTiling> getFusedTiles(ArrayRef<mlir::Operation*> ops, int64_t numTiles) {
+    SmallVector<OutputTiling> opTiles(ops.size());
+
+    const auto outputShape = getShape(ops.back()->getResult(0));
+    Shape nTilesOnDim(outputShape.size(), 1);
+    nTilesOnDim[Dims4D::Act::H] = numTiles;
+    opTiles.back() = fillDividedTiles(nTilesOnDim, outputShape);
+
+    for (auto ind : irange(ops.size() - 1) | reversed) {
+        auto consumer = mlir::cast<IE::TilingBuilderOpInterface>(ops[ind + 1]);
+
+        opTiles[ind].reserve(numTiles);
+        for (const auto& consumerTile : opTiles[ind + 1]) {
+            opTiles[ind].push_back(consumer.backInferTileInfo(consumerTile).tiles[0]);
+        }
+    }
+
+    return opTiles;
+}
+
+bool isSupportedTiling(mlir::Operation* op, const OutputTiling& tiles, Logger log) {
+    return mlir::cast<IE::TilingInfoOpInterface>(op).isSupportedTiling(tiles, TilingMode::ISOLATED, log);
+}
+
+// The minimal number of tiles over H, which makes the operation fit CMX, when it is tiled alone
+Optional<int64_t> getIsolatedNumTiles(mlir::Operation* op, Logger log) {
+    const auto outputShape = getShape(op->getResult(0));
+    const auto maxNumTiles = mlir::cast<IE::TilingBuilderOpInterface>(op).getMaxNumTiles()[Dims4D::Act::H.ind()];
+
+    Shape nTilesOnDim(outputShape.size(), 1);
+    for (; nTilesOnDim[Dims4D::Act::H] <= maxNumTiles; ++nTilesOnDim[Dims4D::Act::H]) {
+        if (isSupportedTiling(op, fillDividedTiles(nTilesOnDim, outputShape), log)) {
+            return nTilesOnDim[Dims4D::Act::H];
+        }
+    }
+
+    return None;
+}
+
+//
+// FusionCostModel
+//
+
+// Estimates the time of the chain in cycles, as the sum of the DMA and the DPU time. The DMA time covers
+// the activations spilled to DDR between the operations and the weights, which are loaded for every tile.
+// The DPU time is estimated by VPUNN and grows with the halo rows recomputed by the fused tiles.
+class FusionCostModel final {
+public:
+    FusionCostModel(mlir::ModuleOp module, Logger log);
+
+public:
+    size_t getFusedCost(ArrayRef<mlir::Operation*> ops, ArrayRef<OutputTiling> opTiles);
+    size_t getIsolatedCost(ArrayRef<mlir::Operation*> ops, ArrayRef<int64_t> opNumTiles);
+
+private:
+    size_t getDMACost(Byte size);
+    size_t getTileDMACost(mlir::Operation* op, const TileInfo& outputTile, bool withInput);
+    size_t getTileDPUCost(mlir::Operation* op, const TileInfo& outputTile);
+
+private:
+    Logger _log;
+    VPU::ArchKind _arch;
+    int64_t _numDPU;
+    CycleCostInfo _cycleCostInfo;
+    VPUIP::WorkloadCostCache _workloadCostCache;
+};
+
+FusionCostModel::FusionCostModel(mlir::ModuleOp module, Logger log)
+        : _log(log),
+          _arch(VPU::getArch(module)),
+          _cycleCostInfo(module, log),
+          _workloadCostCache(VPU::createCostModel(_arch)) {
+    auto nceCluster = IE::getAvailableExecutor(module, VPU::ExecutorKind::NCE);
+    VPUX_THROW_UNLESS(nceCluster != nullptr, "Failed to get NCE_Cluster information");
+
+    auto dpuExec = nceCluster.getSubExecutor(VPU::ExecutorKindAttr::get(module.getContext(), VPU::ExecutorKind::DPU));
+    VPUX_THROW_UNLESS(dpuExec != nullptr, "Failed to get DPU information");
+
+    _numDPU = dpuExec.count();
+}
+
+size_t FusionCostModel::getDMACost(Byte size) {
+    return _cycleCostInfo.getDMACost(size, VPU::MemoryKind::DDR, VPU::MemoryKind::CMX_NN);
+}
+
+// The constant operands are loaded for every tile, the activation input - only if it is not kept in CMX
+size_t FusionCostModel::getTileDMACost(mlir::Operation* op, const TileInfo& outputTile, bool withInput) {
+    const auto inputTiles = mlir::cast<IE::TilingBuilderOpInterface>(op).backInferTileInfo(outputTile).tiles;
+
+    size_t cost = 0;
+    for (auto p : op->getOperands() | indexed) {
+        if (p.index() == 0 && !withInput) {
+            continue;
+        }
+
+        const auto& tile = inputTiles[p.index()];
+        const auto tileType = p.value().getType().cast<vpux::NDTypeInterface>().extractDenseTile(tile.offsets,
+                                                                                                  tile.shape);
+        cost += getDMACost(tileType.getTotalAllocSize());
+    }
+
+    return cost;
+}
+
+size_t FusionCostModel::getTileDPUCost(mlir::Operation* op, const TileInfo& outputTile) {
+    auto nceOp = mlir::cast<VPU::NCEOpInterface>(op);
+    const auto inputTiling = mlir::cast<IE::TilingBuilderOpInterface>(op).backInferTileInfo(outputTile);
+
+    auto params = VPU::getWorkloadCostParams(nceOp, _arch, _numDPU);
+    params.fullInputShape = inputTiling.tiles[0].shape;
+    params.inputShape = inputTiling.tiles[0].shape;
+    params.outputShape = outputTile.shape;
+    if (inputTiling.pads.hasValue()) {
+        params.padInfo = inputTiling.pads.getValue();
+    }
+
+    return checked_cast<size_t>(VPU::getDPUCost(nceOp, params, _workloadCostCache));
+}
+
+// The intermediate activations stay in CMX, the chain reads its input and writes its output once per tile
+size_t FusionCostModel::getFusedCost(ArrayRef<mlir::Operation*> ops, ArrayRef<OutputTiling> opTiles) {
+    size_t cost = 0;
+
+    for (auto ind : irange(ops.size())) {
+        for (const auto& tile : opTiles[ind]) {
+            cost += getTileDMACost(ops[ind], tile, ind == 0);
+            cost += getTileDPUCost(ops[ind], tile);
+        }
+    }
+
+    const auto outputType = ops.back()->getResult(0).getType().cast<vpux::NDTypeInterface>();
+    cost += getDMACost(outputType.getTotalAllocSize());
+
+    return cost;
+}
+
+// An activation between two operations stays in CMX only if neither of them is tiled,
+// otherwise it is written to DDR by the producer and read back by the consumer
+size_t FusionCostModel::getIsolatedCost(ArrayRef<mlir::Operation*> ops, ArrayRef<int64_t> opNumTiles) {
+    size_t cost = 0;
+
+    for (auto ind : irange(ops.size())) {
+        auto* op = ops[ind];
+
+        const auto outputShape = getShape(op->getResult(0));
+        Shape nTilesOnDim(outputShape.size(), 1);
+        nTilesOnDim[Dims4D::Act::H] = opNumTiles[ind];
+
+        const auto isTiled = opNumTiles[ind] > 1;
+        const auto isInputSpilled = ind == 0 || isTiled || opNumTiles[ind - 1] > 1;
+        const auto isOutputSpilled = ind == ops.size() - 1 || isTiled || opNumTiles[ind + 1] > 1;
+
+        for (const auto& tile : fillDividedTiles(nTilesOnDim, outputShape)) {
+            cost += getTileDMACost(op, tile, isInputSpilled);
+            cost += getTileDPUCost(op, tile);
+        }
+
+        if (isOutputSpilled) {
+            const auto outputType = op->getResult(0).getType().cast<vpux::NDTypeInterface>();
+            cost += getDMACost(outputType.getTotalAllocSize());
+        }
+    }
+
+    return cost;
+}
+
+//
+// Fusion
+//
+
+struct FusionCandidate final {
+    size_t depth = 0;
+    SmallVector<OutputTiling> opTiles;
+    size_t fusedCost = 0;
+    size_t isolatedCost = 0;
+};
+
+// The minimal number of tiles, which makes all the fused operations fit CMX.
+// It can't be lower than the number of tiles any of them needs alone.
+Optional<SmallVector<OutputTiling>> getFeasibleFusedTiles(ArrayRef<mlir::Operation*> ops,
+                                                          ArrayRef<int64_t> opNumTiles, Logger log) {
+    auto minNumTiles = std::max<int64_t>(2, *std::max_element(opNumTiles.begin(), opNumTiles.end()));
+
+    auto maxNumTiles = std::numeric_limits<int64_t>::max();
+    for (auto* op : ops) {
+        const auto opMaxNumTiles = mlir::cast<IE::TilingBuilderOpInterface>(op).getMaxNumTiles();
+        maxNumTiles = std::min(maxNumTiles, opMaxNumTiles[Dims4D::Act::H.ind()]);
+    }
+
+    for (auto numTiles = minNumTiles; numTiles <= maxNumTiles; ++numTiles) {
+        auto opTiles = getFusedTiles(ops, numTiles);
+
+        const auto isFeasible = llvm::all_of(irange(ops.size()), [&](size_t ind) {
+            return isSupportedTiling(ops[ind], opTiles[ind], log);
+        });
+
+        if (isFeasible) {
+            return opTiles;
+        }
+    }
+
+    return None;
+}
+
+void fuseChain(ArrayRef<mlir::Operation*> ops, ArrayRef<OutputTiling> opTiles, Logger log) {
+    auto* lastOp = ops.back();
+    const auto numTiles = opTiles.back().size();
+
+    mlir::OpBuilder builder(lastOp);
+
+    SmallVector<mlir::Value> resultTileVals;
+    SmallVector<ShapeRef> resultTileOffsets;
+
+    for (auto tileInd : irange(numTiles)) {
+        mlir::Value prevTiledRes;
+
+        for (auto opInd : irange(ops.size())) {
+            auto origOp = mlir::cast<IE::TilingBuilderOpInterface>(ops[opInd]);
+            const auto& outputTile = opTiles[opInd][tileInd];
+
+            log.trace("Tile '{0}' of '{1}' : {2}", tileInd, origOp->getLoc(), outputTile);
+
+            const auto inputTiling = origOp.backInferTileInfo(outputTile);
+            const auto& inTiles = inputTiling.tiles;
+
+            mlir::BlockAndValueMapping mapper;
+            for (auto p : origOp->getOperands() | indexed) {
+                if (p.index() == 0 && prevTiledRes != nullptr) {
+                    // The producer tile computes exactly the rows, the current tile needs
+                    VPUX_THROW_UNLESS(getShape(prevTiledRes) == inTiles[0].shape,
+                                      "Fused tile shape '{0}' doesn't match the required input tile '{1}'",
+                                      getShape(prevTiledRes), inTiles[0].shape);
+                    mapper.map(p.value(), prevTiledRes);
+                    continue;
+                }
+
+                const auto valName = printToString("input {0}", p.index());
+                mapper.map(p.value(), IE::makeTile(builder, origOp->getLoc(), p.value(), inTiles[p.index()], valName));
+            }
+
+            auto* tiledOp = builder.clone(*origOp, mapper);
+            tiledOp->setLoc(appendLoc(origOp->getLoc(), "fused tile {0}", outputTile.offsets));
+            tiledOp->setAttr(verticalFusionApplied, mlir::BoolAttr::get(tiledOp->getContext(), true));
+
+            mlir::cast<IE::TilingBuilderOpInterface>(tiledOp).adjustAttrs(inputTiling, outputTile);
+
+            const auto baseResType = origOp->getResult(0).getType().cast<vpux::NDTypeInterface>();
+            prevTiledRes = tiledOp->getResult(0);
+            prevTiledRes.setType(baseResType.extractDenseTile(outputTile.offsets, outputTile.shape));
+        }
+
+        resultTileVals.push_back(prevTiledRes);
+        resultTileOffsets.push_back(opTiles.back()[tileInd].offsets);
+    }
+
+    auto concatOp = builder.create<IE::ConcatOp>(lastOp->getLoc(), lastOp->getResult(0).getType(),
+                                                 mlir::ValueRange(resultTileVals), makeArrayRef(resultTileOffsets));
+    lastOp->getResult(0).replaceAllUsesWith(concatOp.output());
+
+    for (auto* op : ops | reversed) {
+        op->erase();
+    }
+}
+
+//
+// VerticalFusionTilingPass
+//
+
+class VerticalFusionTilingPass final : public IE::VerticalFusionTilingBase<VerticalFusionTilingPass> {
+public:
+    explicit VerticalFusionTilingPass(Logger log) {
+        Base::initLogger(log, Base::getArgumentName());
+    }
+
+private:
+    void safeRunOnFunc() final;
+};
+
+void VerticalFusionTilingPass::safeRunOnFunc() {
+    auto func = getFunction();
+    auto module = func->getParentOfType<mlir::ModuleOp>();
+
+    FusionCostModel costModel(module, _log.nest(2));
+
+    size_t numFusedChains = 0;
+    size_t numFusedOps = 0;
+    size_t savedCost = 0;
+
+    for (const auto& chain : getFusableChains(func)) {
+        _log.trace("Got chain of {0} operations starting at '{1}'", chain.size(), chain.front()->getLoc());
+
+        SmallVector<Optional<int64_t>> chainNumTiles;
+        for (auto* op : chain) {
+            chainNumTiles.push_back(getIsolatedNumTiles(op, _log.nest(2)));
+        }
+
+        // Fuse the chain greedily from its head, taking the depth with the largest estimated gain
+        size_t begin = 0;
+        while (begin + 1 < chain.size()) {
+            FusionCandidate best;
+
+            SmallVector<int64_t> opNumTiles;
+            for (auto end = begin; end < chain.size() && end - begin < MAX_FUSION_DEPTH; ++end) {
+                if (!chainNumTiles[end].hasValue()) {
+                    // The operation needs more than H tiling to fit CMX
+                    break;
+                }
+                opNumTiles.push_back(chainNumTiles[end].getValue());
+
+                if (end == begin) {
+                    continue;
+                }
+
+                const auto ops = makeArrayRef(chain).slice(begin, end - begin + 1);
+                auto opTiles = getFeasibleFusedTiles(ops, opNumTiles, _log.nest(2));
+                if (!opTiles.hasValue()) {
+                    break;
+                }
+
+                const auto fusedCost = costModel.getFusedCost(ops, opTiles.getValue());
+                const auto isolatedCost = costModel.getIsolatedCost(ops, opNumTiles);
+
+                _log.nest().trace("Depth {0} : {1} tiles, fused cost {2}, isolated cost {3}", ops.size(),
+                                  opTiles->front().size(), fusedCost, isolatedCost);
+
+                if (fusedCost < isolatedCost &&
+                    (best.depth == 0 || isolatedCost - fusedCost > best.isolatedCost - best.fusedCost)) {
+                    best.depth = ops.size();
+                    best.opTiles = std::move(opTiles.getValue());
+                    best.fusedCost = fusedCost;
+                    best.isolatedCost = isolatedCost;
+                }
+            }
+
+            if (best.depth == 0) {
+                ++begin;
+                continue;
+            }
+
+            _log.nest().trace("Fuse {0} operations at '{1}' into {2} tiles", best.depth, chain[begin]->getLoc(),
+                              best.opTiles.front().size());
+
+            fuseChain(makeArrayRef(chain).slice(begin, best.depth), best.opTiles, _log.nest(2));
+
+            ++numFusedChains;
+            numFusedOps += best.depth;
+            savedCost += best.isolatedCost - best.fusedCost;
+
+            begin += best.depth;
+        }
+    }
+
+    _log.info("Fused {0} chains of {1} operations, estimated gain is {2} cycles", numFusedChains, numFusedOps,
+              savedCost);
+}
+
+}  // namespace
+
+//
+// createVerticalFusionTilingPass
+//
+
+std::unique_ptr<mlir::Pass> vpux::IE::createVerticalFusionTilingPass(Logger log) {
+    return std::make_unique<VerticalFusionTilingPass>(log);
+}
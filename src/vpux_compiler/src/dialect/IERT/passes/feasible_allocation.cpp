@@ -7,6 +7,7 @@
 #include "vpux/compiler/dialect/IERT/passes.hpp"
 
 #include "vpux/compiler/core/async_deps_info.hpp"
+#include "vpux/compiler/core/cycle_cost_info.hpp"
 #include "vpux/compiler/core/feasible_memory_scheduler.hpp"
 #include "vpux/compiler/core/feasible_memory_scheduler_control_edges.hpp"
 #include "vpux/compiler/core/feasible_memory_scheduler_spilling.hpp"
@@ -206,11 +207,19 @@ void FeasibleAllocationPass::safeRunOnModule() {
     auto prefetchScan = scan;
     auto prefetchLiveRangeInfo = liveRangeInfo;
 
+    // optional estimation of operation durations, without it every operation takes a unit of time
+    std::unique_ptr<CycleCostInfo> cycleCostInfo;
+    if (enableCycleCost) {
+        cycleCostInfo = std::make_unique<CycleCostInfo>(module, _log.nest());
+    }
+
     // feasible memory scheduler - list scheduler
-    FeasibleMemoryScheduler scheduler(_memKind, liveRangeInfo, depsInfo, aliasesInfo, _log, scan);
+    FeasibleMemoryScheduler scheduler(_memKind, liveRangeInfo, depsInfo, aliasesInfo, _log, scan,
+                                      cycleCostInfo.get());
 
     // 1. initial schedule
     auto scheduledOps = scheduler.generateSchedule();
+    auto estimatedCycles = scheduler.getEstimatedCycles();
 
     // 2. prefetching
     // 2.1. optimization for initial schedule - generating prefetch edges
@@ -220,11 +229,16 @@ void FeasibleAllocationPass::safeRunOnModule() {
     // 2.2. schedule again with prefetching
     if (!prefetchEdges.empty()) {
         FeasibleMemoryScheduler schedulerWithPrefetch(_memKind, prefetchLiveRangeInfo, depsInfo, aliasesInfo, _log,
-                                                      prefetchScan);
+                                                      prefetchScan, cycleCostInfo.get());
         scheduledOps = schedulerWithPrefetch.generateSchedule(prefetchEdges);
+        estimatedCycles = schedulerWithPrefetch.getEstimatedCycles();
         scan = prefetchScan;
     }
 
+    if (cycleCostInfo != nullptr) {
+        _log.info("Estimated inference duration: '{0}' cycles", estimatedCycles);
+    }
+
     // 3. optimize spills
     FeasibleMemorySchedulerSpilling spilling(netFunc, _memKind, _secondLvlMemKind, depsInfo, aliasesInfo, _log, scan);
     spilling.optimizeDataOpsSpills(scheduledOps);
@@ -18,10 +18,12 @@
 #include "vpux/compiler/utils/analysis.hpp"
 #include "vpux/compiler/utils/error.hpp"
 #include "vpux/compiler/utils/linear_scan.hpp"
+#include "vpux/compiler/utils/offline_packing.hpp"
 
 #include "vpux/utils/core/checked_cast.hpp"
 #include "vpux/utils/core/error.hpp"
 #include "vpux/utils/core/format.hpp"
+#include "vpux/utils/core/range.hpp"
 
 #include <mlir/Dialect/MemRef/IR/MemRef.h>
 #include <mlir/IR/Value.h>
@@ -29,6 +31,8 @@
 
 #include <llvm/ADT/DenseSet.h>
 
+#include <limits>
+
 using namespace vpux;
 
 namespace {
@@ -80,27 +84,43 @@ mlir::LogicalResult AllocRewrite::matchAndRewrite(mlir::memref::AllocOp origOp,
 
 class StaticAllocationPass final : public IERT::StaticAllocationBase<StaticAllocationPass> {
 public:
-    StaticAllocationPass(IERT::MemKindCreateFunc memSpaceCb, Logger log);
+    StaticAllocationPass(IERT::MemKindCreateFunc memSpaceCb, bool offlinePacking, Logger log);
 
 public:
     mlir::LogicalResult initialize(mlir::MLIRContext* ctx) final;
+    mlir::LogicalResult initializeOptions(StringRef options) final;
 
 private:
     void safeRunOnModule() final;
 
     LinearScanHandler runLinearScan(mlir::FuncOp netFunc);
+    Optional<LinearScanHandler> runOfflinePacking(ArrayRef<mlir::Value> buffers, ArrayRef<PackingBuffer> liveRanges,
+                                                  const LinearScanHandler& scanHandler, uint64_t memDefaultAlignment);
 
 private:
     IERT::MemKindCreateFunc _memKindCb;
+    bool _offlinePacking;
     VPU::MemoryKind _memKind;
     mlir::SymbolRefAttr _memKindAttr;
 };
 
-StaticAllocationPass::StaticAllocationPass(IERT::MemKindCreateFunc memKindCb, Logger log)
-        : _memKindCb(std::move(memKindCb)) {
+StaticAllocationPass::StaticAllocationPass(IERT::MemKindCreateFunc memKindCb, bool offlinePacking, Logger log)
+        : _memKindCb(std::move(memKindCb)), _offlinePacking(offlinePacking) {
     Base::initLogger(log, Base::getArgumentName());
 }
 
+mlir::LogicalResult StaticAllocationPass::initializeOptions(StringRef options) {
+    if (mlir::failed(Base::initializeOptions(options))) {
+        return mlir::failure();
+    }
+
+    if (offlinePacking.hasValue()) {
+        _offlinePacking = offlinePacking.getValue();
+    }
+
+    return mlir::success();
+}
+
 mlir::LogicalResult StaticAllocationPass::initialize(mlir::MLIRContext* ctx) {
     if (mlir::failed(Base::initialize(ctx))) {
         return mlir::failure();
@@ -131,6 +151,12 @@ LinearScanHandler StaticAllocationPass::runLinearScan(mlir::FuncOp netFunc) {
 
     LinearScanImpl scan(maxMemSize.count(), memDefaultAlignment);
 
+    // Live ranges of the buffers in the task steps, for the offline packing
+    SmallVector<mlir::Value> buffers;
+    SmallVector<PackingBuffer> liveRanges;
+    DenseMap<mlir::Value, size_t> bufferIndices;
+    size_t curStep = 0;
+
     const auto allocNewBuffers = [&](const ValueOrderedSet& usedBufs) {
         _log.trace("Locate new buffers");
         _log = _log.nest();
@@ -153,6 +179,19 @@ LinearScanHandler StaticAllocationPass::runLinearScan(mlir::FuncOp netFunc) {
 
             scan.handler().markAsAlive(val);
             newBufs.push_back(val);
+
+            PackingBuffer liveRange;
+            liveRange.firstUse = curStep;
+            liveRange.lastUse = std::numeric_limits<size_t>::max();
+            liveRange.size = scan.handler().getSize(val);
+            liveRange.alignment = scan.handler().getAlignment(val);
+            if (scan.handler().isFixedAlloc(val)) {
+                liveRange.fixedAddress = scan.handler().getAddress(val);
+            }
+
+            bufferIndices.insert({val, buffers.size()});
+            buffers.push_back(val);
+            liveRanges.push_back(liveRange);
         }
 
         _log.trace("Allocate memory for the new buffers");
@@ -177,6 +216,11 @@ LinearScanHandler StaticAllocationPass::runLinearScan(mlir::FuncOp netFunc) {
             if (liveRangeInfo.eraseUser(val, op) == 0) {
                 _log.nest().trace("This bucket is the last usage of the buffer, free it");
                 scan.handler().markAsDead(val);
+
+                const auto it = bufferIndices.find(val);
+                if (it != bufferIndices.end()) {
+                    liveRanges[it->second].lastUse = curStep;
+                }
             }
         }
 
@@ -186,8 +230,14 @@ LinearScanHandler StaticAllocationPass::runLinearScan(mlir::FuncOp netFunc) {
         _log = _log.unnest();
     };
 
-    mlir::async::ExecuteOp prevExecOp;
-    std::list<ScheduledOpOneResource> scheduledOpsResources;
+    // Buffers used by operation, both inputs and outputs
+    struct OpBuffers final {
+        size_t opIndex;
+        mlir::DenseSet<mlir::Value> inputBuffers;
+        mlir::DenseSet<mlir::Value> outputBuffers;
+    };
+    SmallVector<OpBuffers> opsBuffers;
+
     for (auto curExecOp : netFunc.getOps<mlir::async::ExecuteOp>()) {
         _log.trace("Process next task at '{0}'", curExecOp->getLoc());
         _log = _log.nest();
@@ -196,11 +246,9 @@ LinearScanHandler StaticAllocationPass::runLinearScan(mlir::FuncOp netFunc) {
 
         allocNewBuffers(usedBufs);
 
-        auto opIndex = depsInfo.getIndex(curExecOp);
-
-        // buffers used by operation, both inputs and outputs
-        mlir::DenseSet<mlir::Value> inputBuffers;
-        mlir::DenseSet<mlir::Value> outputBuffers;
+        opsBuffers.emplace_back();
+        auto& opBuffers = opsBuffers.back();
+        opBuffers.opIndex = depsInfo.getIndex(curExecOp);
 
         // Get operation buffers for all operands. Go through each layer op and
         // store in a set all root buffers
@@ -220,7 +268,7 @@ LinearScanHandler StaticAllocationPass::runLinearScan(mlir::FuncOp netFunc) {
                 VPUX_THROW_UNLESS(rootBuffers.size() == 1, "Value '{0}' expected to have only one root. Got {1}", input,
                                   rootBuffers.size());
                 auto rootBuffer = *rootBuffers.begin();
-                inputBuffers.insert(rootBuffer);
+                opBuffers.inputBuffers.insert(rootBuffer);
             }
 
             auto outputs = mlir::dyn_cast<IERT::LayerOpInterface>(innerOp).getOutputs();
@@ -233,36 +281,53 @@ LinearScanHandler StaticAllocationPass::runLinearScan(mlir::FuncOp netFunc) {
                 VPUX_THROW_UNLESS(rootBuffers.size() == 1, "Value '{0}' expected to have only one root. Got {1}",
                                   output, rootBuffers.size());
                 auto rootBuffer = *rootBuffers.begin();
-                outputBuffers.insert(rootBuffer);
+                opBuffers.outputBuffers.insert(rootBuffer);
             }
         }
 
-        // For all identified buffers used by operation create separate entries with information
-        // about memory ranges to properly identify range producer and consumers at a given time
-        for (auto& buf : inputBuffers) {
+        freeDeadBuffers(usedBufs, curExecOp);
+
+        ++curStep;
+        _log = _log.unnest();
+    }
+
+    // The buffers, which are never freed, live till the end
+    for (auto& liveRange : liveRanges) {
+        liveRange.lastUse = std::min(liveRange.lastUse, curStep);
+    }
+
+    Optional<LinearScanHandler> packedHandler;
+    if (_offlinePacking) {
+        packedHandler = runOfflinePacking(buffers, liveRanges, scan.handler(), memDefaultAlignment);
+    }
+    const auto& allocHandler = packedHandler.hasValue() ? packedHandler.getValue() : scan.handler();
+
+    // For all identified buffers used by operation create separate entries with information
+    // about memory ranges to properly identify range producer and consumers at a given time
+    std::list<ScheduledOpOneResource> scheduledOpsResources;
+    for (const auto& opBuffers : opsBuffers) {
+        const auto opIndex = opBuffers.opIndex;
+
+        for (auto& buf : opBuffers.inputBuffers) {
             if (!isBufAllocOp(buf.getDefiningOp())) {
                 continue;
             }
-            auto addressStart = scan.handler().getAddress(buf);
-            auto addressEnd = addressStart + scan.handler().getSize(buf) - 1;
+            auto addressStart = allocHandler.getAddress(buf);
+            auto addressEnd = addressStart + allocHandler.getSize(buf) - 1;
             _log.trace("op = '{0}'\t input = [{1} - {2}]", opIndex, addressStart, addressEnd);
             scheduledOpsResources.push_back(ScheduledOpOneResource(opIndex, addressStart, addressEnd,
                                                                    ScheduledOpOneResource::EResRelation::CONSUMER));
         }
-        for (auto& buf : outputBuffers) {
+        for (auto& buf : opBuffers.outputBuffers) {
             if (!isBufAllocOp(buf.getDefiningOp())) {
                 continue;
             }
-            auto addressStart = scan.handler().getAddress(buf);
-            auto addressEnd = addressStart + scan.handler().getSize(buf) - 1;
+            auto addressStart = allocHandler.getAddress(buf);
+            auto addressEnd = addressStart + allocHandler.getSize(buf) - 1;
             _log.trace("op = '{0}'\t output = [{1} - {2}]", opIndex, addressStart, addressEnd);
             scheduledOpsResources.push_back(ScheduledOpOneResource(opIndex, addressStart, addressEnd,
                                                                    ScheduledOpOneResource::EResRelation::PRODUCER));
         }
-
-        freeDeadBuffers(usedBufs, curExecOp);
-
-        _log = _log.unnest();
     }
 
     ControlEdgeSet controlEdges;
@@ -287,7 +352,30 @@ LinearScanHandler StaticAllocationPass::runLinearScan(mlir::FuncOp netFunc) {
 
     depsInfo.updateTokenDependencies();
 
-    return scan.handler();
+    return allocHandler;
+}
+
+Optional<LinearScanHandler> StaticAllocationPass::runOfflinePacking(ArrayRef<mlir::Value> buffers,
+                                                                    ArrayRef<PackingBuffer> liveRanges,
+                                                                    const LinearScanHandler& scanHandler,
+                                                                    uint64_t memDefaultAlignment) {
+    const auto packing = packBuffers(liveRanges);
+    const auto scanSize = checked_cast<AddressType>(scanHandler.maxAllocatedSize().count());
+
+    _log.info("Offline packing of '{0}' memory: {1} bytes, linear scan: {2} bytes, lower bound: {3} bytes", _memKind,
+              packing.footprint, scanSize, packing.lowerBound);
+
+    if (packing.footprint >= scanSize) {
+        _log.trace("Offline packing does not reduce the footprint, keep the linear scan allocation");
+        return None;
+    }
+
+    LinearScanHandler handler(memDefaultAlignment);
+    for (auto ind : irange(buffers.size())) {
+        handler.allocated(buffers[ind], packing.addresses[ind]);
+    }
+
+    return handler;
 }
 
 void StaticAllocationPass::safeRunOnModule() {
@@ -319,6 +407,7 @@ void StaticAllocationPass::safeRunOnModule() {
 
 }  // namespace
 
-std::unique_ptr<mlir::Pass> vpux::IERT::createStaticAllocationPass(MemKindCreateFunc memKindCb, Logger log) {
-    return std::make_unique<StaticAllocationPass>(std::move(memKindCb), log);
+std::unique_ptr<mlir::Pass> vpux::IERT::createStaticAllocationPass(MemKindCreateFunc memKindCb, bool offlinePacking,
+                                                                   Logger log) {
+    return std::make_unique<StaticAllocationPass>(std::move(memKindCb), offlinePacking, log);
 }
@@ -5,6 +5,15 @@
 
 #include "vpux/compiler/dialect/VPU/cost_model.hpp"
 #include "vpux/compiler/dialect/VPU/cost_model_data.hpp"
+#include "vpux/compiler/dialect/VPU/ops.hpp"
+
+#include "vpux/utils/core/enums.hpp"
+
+#include <mlir/Dialect/Quant/QuantTypes.h>
+
+#include <llvm/ADT/TypeSwitch.h>
+
+#include <cmath>
 
 using namespace vpux;
 
@@ -28,3 +37,115 @@ std::shared_ptr<VPUNN::VPUCostModel> vpux::VPU::createCostModel(ArchKind arch) {
     const auto costModelData = getCostModelData(arch);
     return std::make_shared<VPUNN::VPUCostModel>(costModelData.data(), costModelData.size(), false);
 }
+
+//
+// MPE mode utilities
+//
+
+namespace {
+
+VPU::MPEMode getMpeModeForVPUX30XX(mlir::Type inElemType, mlir::Type outElemType, mlir::Operation*, ShapeRef shape) {
+    if (inElemType.isa<mlir::quant::QuantizedType>() || outElemType.isa<mlir::quant::QuantizedType>()) {
+        const double W = static_cast<double>(shape[Dims4D::Act::W]);
+        const double H = static_cast<double>(shape[Dims4D::Act::H]);
+        // VPU::MPEMode::MATRIX process tensor using W=4 H=4 parts, calculate grid cells count for it
+        const double matrixPartsCount = std::ceil(W / 4.0) * std::ceil(H / 4.0);
+        // VPU::MPEMode::VECTOR process tensor using W=16 H=1 parts, calculate grid cells count for it
+        const double vectorPartsCount = std::ceil(W / 16.0) * H;
+        // Cells count is in direct ratio with work size, so choose smaller one
+        return (vectorPartsCount <= matrixPartsCount) ? VPU::MPEMode::VECTOR : VPU::MPEMode::MATRIX;
+    }
+
+    if (inElemType.isF16() || inElemType.isBF16() || outElemType.isF16() || outElemType.isBF16()) {
+        return VPU::MPEMode::VECTOR_FP16;
+    }
+
+    // Let's fall back to vector (might be a bad idea though).
+    return VPU::MPEMode::VECTOR;
+}
+
+VPU::MPEMode getMpeModeForVPUX37XX(mlir::Type, mlir::Type, mlir::Operation* operation, ShapeRef) {
+    if (mlir::isa<VPU::NCEConvolutionOp>(operation)) {
+        return VPU::MPEMode::CUBOID_16x16;
+    } else if (mlir::isa<VPU::NCEDepthConvolutionOp>(operation) || mlir::isa<VPU::NCEMaxPoolOp>(operation)) {
+        return VPU::MPEMode::CUBOID_4x16;
+    } else if (mlir::isa<VPU::NCEEltwiseOp>(operation)) {
+        return VPU::MPEMode::CUBOID_8x16;
+    }
+
+    return VPU::MPEMode::CUBOID_16x16;
+}
+
+using GetMpeModeCb = VPU::MPEMode (*)(mlir::Type, mlir::Type, mlir::Operation*, ShapeRef);
+
+const EnumMap<VPU::ArchKind, GetMpeModeCb> mpeMap = {
+        {VPU::ArchKind::VPUX30XX, getMpeModeForVPUX30XX},
+        {VPU::ArchKind::VPUX311X, getMpeModeForVPUX30XX},
+        {VPU::ArchKind::VPUX37XX, getMpeModeForVPUX37XX},
+};
+
+}  // namespace
+
+VPU::MPEMode vpux::VPU::getMPEMode(ArchKind arch, mlir::Type inElemType, mlir::Type outElemType,
+                                   mlir::Operation* nceOp, ShapeRef outputShape) {
+    const auto mpeByType = mpeMap.find(arch);
+    VPUX_THROW_UNLESS(mpeByType != mpeMap.end(), "Failed to map MPE mode to target arch '{0}'", arch);
+
+    return mpeByType->second(inElemType, outElemType, nceOp, outputShape);
+}
+
+//
+// getWorkloadCostParams
+//
+
+VPUIP::WorkloadCostParams vpux::VPU::getWorkloadCostParams(NCEOpInterface nceOp, ArchKind arch, int64_t numDPU) {
+    const auto inputType = nceOp->getOperand(0).getType().cast<vpux::NDTypeInterface>();
+    const auto outputType = nceOp->getResult(0).getType().cast<vpux::NDTypeInterface>();
+
+    VPUIP::WorkloadCostParams params;
+    params.dataType = inputType.getElementType();
+    params.arch = arch;
+    params.numDPU = numDPU;
+    params.fullInputShape = inputType.getShape().raw();
+    params.inputShape = inputType.getShape().raw();
+    params.outputShape = outputType.getShape().raw();
+    params.padInfo = VPU::toPadInfo(nceOp.getPad());
+    params.kernelSize = nceOp.getKernelSize();
+    params.kernelStride = nceOp.getStrides();
+
+    llvm::TypeSwitch<mlir::Operation*, void>(nceOp.getOperation())
+            .Case<VPU::NCEConvolutionOp>([&](VPU::NCEConvolutionOp) {
+                const auto isCMajor = inputType.getDimsOrder() == DimsOrder::NCHW;
+                params.nceTaskType = isCMajor ? VPUIP::NCETaskType::CMCONV : VPUIP::NCETaskType::CONV;
+            })
+            .Case<VPU::NCEDepthConvolutionOp>([&](VPU::NCEDepthConvolutionOp) {
+                params.nceTaskType = VPUIP::NCETaskType::DWCONV;
+            })
+            .Case<VPU::NCEMaxPoolOp>([&](VPU::NCEMaxPoolOp) {
+                params.nceTaskType = VPUIP::NCETaskType::MAXPOOL;
+            })
+            .Case<VPU::NCEEltwiseOp>([&](VPU::NCEEltwiseOp) {
+                params.nceTaskType = VPUIP::NCETaskType::ELTWISE;
+            })
+            .Default([](mlir::Operation* op) {
+                VPUX_THROW("Unsupported NCE operation '{0}' at '{1}'", op->getName(), op->getLoc());
+            });
+
+    return params;
+}
+
+//
+// getDPUCost
+//
+
+int64_t vpux::VPU::getDPUCost(NCEOpInterface nceOp, const VPUIP::WorkloadCostParams& params,
+                              VPUIP::WorkloadCostCache& costCache) {
+    const auto outElemType = nceOp->getResult(0).getType().cast<vpux::NDTypeInterface>().getElementType();
+    const auto mpeMode = getMPEMode(params.arch, params.dataType, outElemType, nceOp, params.outputShape);
+
+    VPUIP::DpuTiler dpuTiler(params.outputShape, mpeMode);
+    VPUIP::WorkloadSplitPool splitPool;
+    dpuTiler.tileOverH(params.numDPU, splitPool);
+
+    return VPUIP::computeSplitCost(*splitPool.begin(), params, costCache);
+}
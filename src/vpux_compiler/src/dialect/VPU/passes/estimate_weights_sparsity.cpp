@@ -0,0 +1,285 @@
+//
+// Copyright (C) 2022 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+//
+
+#include "vpux/compiler/dialect/VPU/passes.hpp"
+
+#include "vpux/compiler/core/cycle_cost_info.hpp"
+#include "vpux/compiler/dialect/IE/ops.hpp"
+#include "vpux/compiler/dialect/IE/utils/resources.hpp"
+#include "vpux/compiler/dialect/VPU/attributes.hpp"
+#include "vpux/compiler/dialect/VPU/cost_model.hpp"
+#include "vpux/compiler/dialect/VPU/ops.hpp"
+#include "vpux/compiler/dialect/VPUIP/dpu_tiler.hpp"
+#include "vpux/compiler/dialect/const/ops.hpp"
+#include "vpux/compiler/utils/attributes.hpp"
+
+#include "vpux/utils/core/numeric.hpp"
+
+#include <mlir/Dialect/Quant/QuantTypes.h>
+
+#include <climits>
+#include <map>
+#include <numeric>
+
+using namespace vpux;
+
+namespace {
+
+// The compressed weights and the sparsity map of every output channel start at an aligned address
+constexpr int64_t SPARSE_WEIGHTS_ALIGNMENT = 16;
+
+//
+// Weights analysis
+//
+
+// Finds the constant the weights are copied to CMX from, either directly or by the cluster tiling.
+Const::DeclareOp getWeightsConst(VPU::NCEConvolutionOp convOp) {
+    auto filter = convOp.filter();
+
+    if (auto blockArg = filter.dyn_cast<mlir::BlockArgument>()) {
+        auto clusterOp = mlir::dyn_cast<VPU::NCEClusterTilingOp>(blockArg.getOwner()->getParentOp());
+        if (clusterOp == nullptr) {
+            return nullptr;
+        }
+        filter = clusterOp->getOperand(blockArg.getArgNumber());
+    }
+
+    if (auto copyOp = filter.getDefiningOp<IE::CopyOp>()) {
+        filter = copyOp.input();
+    } else if (auto copyClusterOp = filter.getDefiningOp<VPU::NCEClusterTilingOp>()) {
+        if (!mlir::isa<IE::CopyOp>(copyClusterOp.body().front().front())) {
+            return nullptr;
+        }
+        filter = copyClusterOp->getOperand(0);
+    }
+
+    return filter.getDefiningOp<Const::DeclareOp>();
+}
+
+// The sparse weights skip the values equal to the zero point, which must be the same for all of them
+Optional<float> getSparsifyValue(mlir::Type elemType) {
+    if (elemType.isa<mlir::FloatType>()) {
+        return 0.0f;
+    }
+    if (const auto qType = elemType.dyn_cast<mlir::quant::UniformQuantizedType>()) {
+        return static_cast<float>(qType.getZeroPoint());
+    }
+    return None;
+}
+
+// Counts the values, which are kept by the sparse weights, for every output channel
+SmallVector<int64_t> countNonZerosPerOC(const Const::Content& content, float sparsifyValue) {
+    const auto OC = content.getShape()[Dims4D::Filter::OC];
+    const auto workloadSize = content.getNumElements() / OC;
+
+    if (content.isSplat()) {
+        const auto isZero = content.getSplatValue<float>() == sparsifyValue;
+        return SmallVector<int64_t>(OC, isZero ? 0 : workloadSize);
+    }
+
+    // The output channels are the outermost dimension, so every channel occupies a contiguous range
+    SmallVector<int64_t> nonZeros(OC, 0);
+
+    int64_t ind = 0;
+    for (const auto val : content.getValues<float>()) {
+        if (val != sparsifyValue) {
+            ++nonZeros[ind / workloadSize];
+        }
+        ++ind;
+    }
+
+    return nonZeros;
+}
+
+// The size of the compressed weights and the sparsity map (one bit per weight), both aligned per output channel
+Byte getSparseWeightsSize(ArrayRef<int64_t> nonZerosPerOC, int64_t workloadSize, Byte elemSize) {
+    const auto sparsityMapSize = alignVal(divUp(workloadSize, int64_t(CHAR_BIT)), SPARSE_WEIGHTS_ALIGNMENT);
+
+    int64_t totalSize = 0;
+    for (const auto nonZeros : nonZerosPerOC) {
+        totalSize += alignVal(nonZeros * elemSize.count(), SPARSE_WEIGHTS_ALIGNMENT) + sparsityMapSize;
+    }
+
+    return Byte(totalSize);
+}
+
+//
+// EstimateWeightsSparsityPass
+//
+
+class EstimateWeightsSparsityPass final : public VPU::EstimateWeightsSparsityBase<EstimateWeightsSparsityPass> {
+public:
+    EstimateWeightsSparsityPass() = default;
+    EstimateWeightsSparsityPass(double densityThreshold, Logger log);
+
+private:
+    mlir::LogicalResult initializeOptions(StringRef options) final;
+    void safeRunOnFunc() final;
+
+private:
+    size_t getDPUCost(VPU::NCEConvolutionOp convOp);
+
+private:
+    double _densityThreshold = 0.5;
+
+    VPU::ArchKind _arch = VPU::ArchKind::UNKNOWN;
+    int64_t _numDPU = 1;
+    std::unique_ptr<VPUIP::WorkloadCostCache> _workloadCostCache;
+};
+
+EstimateWeightsSparsityPass::EstimateWeightsSparsityPass(double densityThreshold, Logger log)
+        : _densityThreshold(densityThreshold) {
+    Base::initLogger(log, Base::getArgumentName());
+}
+
+mlir::LogicalResult EstimateWeightsSparsityPass::initializeOptions(StringRef options) {
+    if (mlir::failed(Base::initializeOptions(options))) {
+        return mlir::failure();
+    }
+
+    if (densityThreshold.hasValue()) {
+        _densityThreshold = densityThreshold.getValue();
+    }
+
+    return mlir::success();
+}
+
+// The slowest cluster defines the duration of the operation.
+// The operations without the workloads are treated as free, so only the weights transfer is compared for them.
+size_t EstimateWeightsSparsityPass::getDPUCost(VPU::NCEConvolutionOp convOp) {
+    std::map<int64_t, VPUIP::WorkloadSplit> clusterSplits;
+    for (auto workloadOp : convOp.workloads().getOps<VPU::DPUWorkloadOp>()) {
+        TileInfo outputTile(4);
+        outputTile.offsets = Shape(parseIntArrayAttr<int64_t>(workloadOp.offsets()));
+        outputTile.shape = Shape(parseIntArrayAttr<int64_t>(workloadOp.sizes()));
+
+        const auto clusterId = workloadOp.cluster_id().getValueOr(0);
+        clusterSplits[clusterId].push_back(std::make_tuple(outputTile, workloadOp.mpe_mode()));
+    }
+
+    if (clusterSplits.empty()) {
+        return 0;
+    }
+
+    const auto params = VPU::getWorkloadCostParams(convOp, _arch, _numDPU);
+
+    int64_t cost = 0;
+    for (const auto& clusterSplit : clusterSplits) {
+        cost = std::max(cost, VPUIP::computeSplitCost(clusterSplit.second, params, *_workloadCostCache));
+    }
+
+    return checked_cast<size_t>(cost);
+}
+
+void EstimateWeightsSparsityPass::safeRunOnFunc() {
+    auto& ctx = getContext();
+    auto func = getFunction();
+    auto module = func->getParentOfType<mlir::ModuleOp>();
+
+    VPUX_THROW_UNLESS(_densityThreshold >= 0.0 && _densityThreshold <= 1.0,
+                      "Weights density threshold '{0}' is out of [0, 1] range", _densityThreshold);
+
+    _arch = VPU::getArch(module);
+
+    auto nceCluster = IE::getAvailableExecutor(module, VPU::ExecutorKind::NCE);
+    VPUX_THROW_UNLESS(nceCluster != nullptr, "Failed to get NCE_Cluster information");
+
+    auto dpuExec = nceCluster.getSubExecutor(VPU::ExecutorKindAttr::get(&ctx, VPU::ExecutorKind::DPU));
+    VPUX_THROW_UNLESS(dpuExec != nullptr, "Failed to get DPU information");
+
+    _numDPU = dpuExec.count();
+    _workloadCostCache = std::make_unique<VPUIP::WorkloadCostCache>(VPU::createCostModel(_arch));
+
+    CycleCostInfo cycleCostInfo(module, _log);
+
+    size_t numCandidates = 0;
+    Byte savedSize(0);
+    size_t savedCycles = 0;
+
+    func->walk([&](VPU::NCEConvolutionOp convOp) {
+        _log.trace("Process '{0}' at '{1}'", convOp->getName(), convOp->getLoc());
+        auto innerLog = _log.nest();
+
+        // Channel major convolution reads the weights by the activation window
+        if (convOp.activationWindow() != nullptr) {
+            innerLog.trace("Channel major convolution is not supported");
+            return;
+        }
+
+        auto weightsConst = getWeightsConst(convOp);
+        if (weightsConst == nullptr) {
+            innerLog.trace("Weights are not constant");
+            return;
+        }
+
+        const auto weightsType = weightsConst.getType().cast<vpux::NDTypeInterface>();
+        if (weightsType.getDimsOrder().dimAt(0) != Dims4D::Filter::OC) {
+            innerLog.trace("Weights order '{0}' is not supported", weightsType.getDimsOrder());
+            return;
+        }
+
+        const auto sparsifyValue = getSparsifyValue(weightsType.getElementType());
+        if (!sparsifyValue.hasValue() || weightsType.getElemTypeSize().count() % CHAR_BIT != 0) {
+            innerLog.trace("Weights element type '{0}' is not supported", weightsType.getElementType());
+            return;
+        }
+
+        const auto content = weightsConst.content();
+        const auto nonZerosPerOC = countNonZerosPerOC(content, sparsifyValue.getValue());
+
+        const auto numElements = weightsType.getNumElements();
+        const auto numNonZeros = std::accumulate(nonZerosPerOC.begin(), nonZerosPerOC.end(), int64_t(0));
+        const auto zeroDensity = static_cast<double>(numElements - numNonZeros) / static_cast<double>(numElements);
+
+        if (zeroDensity < _densityThreshold) {
+            innerLog.trace("Zero density '{0}' is below the threshold '{1}'", zeroDensity, _densityThreshold);
+            return;
+        }
+
+        const auto workloadSize = numElements / weightsType.getShape()[Dims4D::Filter::OC];
+        const auto denseSize = weightsType.getTotalAllocSize();
+        const auto sparseSize = getSparseWeightsSize(nonZerosPerOC, workloadSize, weightsType.getElemTypeSize());
+
+        // The weights are prefetched while the previous operations are running,
+        // so the slower of the transfer and the computation defines the operation time
+        const auto denseDMACost = cycleCostInfo.getDMACost(denseSize, VPU::MemoryKind::DDR, VPU::MemoryKind::CMX_NN);
+        const auto sparseDMACost = cycleCostInfo.getDMACost(sparseSize, VPU::MemoryKind::DDR, VPU::MemoryKind::CMX_NN);
+        const auto dpuCost = getDPUCost(convOp);
+
+        const auto denseCost = std::max(denseDMACost, dpuCost);
+        const auto sparseCost = std::max(sparseDMACost, dpuCost);
+
+        innerLog.trace("Zero density '{0}', dense/sparse size '{1}'/'{2}', estimated dense/sparse cost '{3}'/'{4}'",
+                       zeroDensity, denseSize, sparseSize, denseCost, sparseCost);
+
+        if (sparseCost >= denseCost) {
+            innerLog.trace("Sparse weights are not estimated to reduce the cost");
+            return;
+        }
+
+        ++numCandidates;
+        savedSize += denseSize - sparseSize;
+        savedCycles += denseCost - sparseCost;
+    });
+
+    _log.info("Sparse weights would benefit {0} convolutions, estimated saving {1} of transfer and {2} cycles",
+              numCandidates, savedSize, savedCycles);
+}
+
+}  // namespace
+
+//
+// createEstimateWeightsSparsityPass
+//
+
+std::unique_ptr<mlir::Pass> vpux::VPU::createEstimateWeightsSparsityPass() {
+    return std::make_unique<EstimateWeightsSparsityPass>();
+}
+
+std::unique_ptr<mlir::Pass> vpux::VPU::createEstimateWeightsSparsityPass(double densityThreshold, Logger log) {
+    return std::make_unique<EstimateWeightsSparsityPass>(densityThreshold, log);
+}
@@ -29,11 +29,35 @@ public:
     explicit MultiClusterStrategyAssignmentPass(Logger log) {
         Base::initLogger(log, Base::getArgumentName());
     }
+    MultiClusterStrategyAssignmentPass(bool enableGraphOptimization, int timeBudget, Logger log)
+            : _enableGraphOptimization(enableGraphOptimization), _timeBudget(timeBudget) {
+        Base::initLogger(log, Base::getArgumentName());
+    }
 
 private:
+    mlir::LogicalResult initializeOptions(StringRef options) final;
     void safeRunOnFunc() final;
+
+private:
+    bool _enableGraphOptimization = false;
+    int _timeBudget = 1000;
 };
 
+mlir::LogicalResult MultiClusterStrategyAssignmentPass::initializeOptions(StringRef options) {
+    if (mlir::failed(Base::initializeOptions(options))) {
+        return mlir::failure();
+    }
+
+    if (enableGraphOptimization.hasValue()) {
+        _enableGraphOptimization = enableGraphOptimization.getValue();
+    }
+    if (timeBudget.hasValue()) {
+        _timeBudget = timeBudget.getValue();
+    }
+
+    return mlir::success();
+}
+
 //
 // safeRunOnFunc
 //
@@ -48,7 +72,12 @@ void MultiClusterStrategyAssignmentPass::safeRunOnFunc() {
 
     if (nceCluster.count() > 1) {
         StrategyManager strategyManager(func, _log);
-        strategyManager.assignMultiClusterStrategy();
+        if (_enableGraphOptimization) {
+            VPUX_THROW_UNLESS(_timeBudget >= 0, "Negative strategy search time budget '{0}'", _timeBudget);
+            strategyManager.optimizeMultiClusterStrategy(std::chrono::milliseconds(_timeBudget));
+        } else {
+            strategyManager.assignMultiClusterStrategy();
+        }
     }
 }
 
@@ -61,3 +90,8 @@ void MultiClusterStrategyAssignmentPass::safeRunOnFunc() {
 std::unique_ptr<mlir::Pass> VPU::createMultiClusterStrategyAssignmentPass(Logger log) {
     return std::make_unique<MultiClusterStrategyAssignmentPass>(log);
 }
+
+std::unique_ptr<mlir::Pass> VPU::createMultiClusterStrategyAssignmentPass(bool enableGraphOptimization, int timeBudget,
+                                                                          Logger log) {
+    return std::make_unique<MultiClusterStrategyAssignmentPass>(enableGraphOptimization, timeBudget, log);
+}
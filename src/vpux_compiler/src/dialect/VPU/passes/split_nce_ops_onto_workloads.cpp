@@ -18,12 +18,8 @@
 #include "vpux/compiler/utils/logging.hpp"
 #include "vpux/compiler/utils/rewriter.hpp"
 
-#include "vpux/utils/core/enums.hpp"
-
 #include <mlir/Transforms/GreedyPatternRewriteDriver.h>
 
-#include <llvm/ADT/TypeSwitch.h>
-
 using namespace vpux;
 using namespace VPU;
 
@@ -35,50 +31,6 @@ namespace {
 
 constexpr int64_t MAX_SPLIT_NUMBER = 50;
 
-//
-// MPE mode utilities
-//
-
-VPU::MPEMode getMpeModeForVPUX30XX(mlir::Type inElemType, mlir::Type outElemType, mlir::Operation*, ShapeRef shape) {
-    if (inElemType.isa<mlir::quant::QuantizedType>() || outElemType.isa<mlir::quant::QuantizedType>()) {
-        const double W = static_cast<double>(shape[Dims4D::Act::W]);
-        const double H = static_cast<double>(shape[Dims4D::Act::H]);
-        // VPU::MPEMode::MATRIX process tensor using W=4 H=4 parts, calculate grid cells count for it
-        const double matrixPartsCount = std::ceil(W / 4.0) * std::ceil(H / 4.0);
-        // VPU::MPEMode::VECTOR process tensor using W=16 H=1 parts, calculate grid cells count for it
-        const double vectorPartsCount = std::ceil(W / 16.0) * H;
-        // Cells count is in direct ratio with work size, so choose smaller one
-        return (vectorPartsCount <= matrixPartsCount) ? VPU::MPEMode::VECTOR : VPU::MPEMode::MATRIX;
-    }
-
-    if (inElemType.isF16() || inElemType.isBF16() || outElemType.isF16() || outElemType.isBF16()) {
-        return VPU::MPEMode::VECTOR_FP16;
-    }
-
-    // Let's fall back to vector (might be a bad idea though).
-    return VPU::MPEMode::VECTOR;
-}
-
-VPU::MPEMode getMpeModeForVPUX37XX(mlir::Type, mlir::Type, mlir::Operation* operation, ShapeRef) {
-    if (mlir::isa<VPU::NCEConvolutionOp>(operation)) {
-        return VPU::MPEMode::CUBOID_16x16;
-    } else if (mlir::isa<VPU::NCEDepthConvolutionOp>(operation) || mlir::isa<VPU::NCEMaxPoolOp>(operation)) {
-        return VPU::MPEMode::CUBOID_4x16;
-    } else if (mlir::isa<VPU::NCEEltwiseOp>(operation)) {
-        return VPU::MPEMode::CUBOID_8x16;
-    }
-
-    return VPU::MPEMode::CUBOID_16x16;
-}
-
-using GetMpeModeCb = VPU::MPEMode (*)(mlir::Type, mlir::Type, mlir::Operation*, ShapeRef);
-
-const EnumMap<VPU::ArchKind, GetMpeModeCb> mpeMap = {
-        {VPU::ArchKind::VPUX30XX, getMpeModeForVPUX30XX},
-        {VPU::ArchKind::VPUX311X, getMpeModeForVPUX30XX},
-        {VPU::ArchKind::VPUX37XX, getMpeModeForVPUX37XX},
-};
-
 //
 // generateWorkloads
 //
@@ -97,7 +49,7 @@ void addSubTensorOffset(TileInfo& tileInfo, ShapeRef tensorOffset) {
 
 void generateWorkloads(mlir::OpBuilder& builder, VPU::NCEOpInterface origOp,
                        const VPUIP::WorkloadCostParams& costParams, VPU::MPEMode mpeMode, bool isTileOverZSupported,
-                       const std::shared_ptr<VPUNN::VPUCostModel>& costModel, mlir::IntegerAttr clusterId = nullptr,
+                       VPUIP::WorkloadCostCache& costCache, mlir::IntegerAttr clusterId = nullptr,
                        ShapeRef subTensorOffset = {}) {
     VPUIP::DpuTiler dpuTiler(costParams.outputShape, mpeMode);
 
@@ -122,20 +74,17 @@ void generateWorkloads(mlir::OpBuilder& builder, VPU::NCEOpInterface origOp,
     auto splitPool = to_std_vector(splitPoolSet);
     VPUX_THROW_WHEN(splitPool.empty(), "Workload split pool is empty");
 
-    std::vector<int64_t> splitPoolCosts(splitPool.size(), 0);
-    for (const auto ind : irange(splitPool.size())) {
-        auto& curSplit = splitPool[ind];
-
-        if (clusterId != nullptr) {
+    if (clusterId != nullptr) {
+        for (auto& curSplit : splitPool) {
             for (auto& wl : curSplit) {
                 auto& outTile = std::get<0>(wl);
                 addSubTensorOffset(outTile, subTensorOffset);
             }
         }
-
-        splitPoolCosts[ind] = VPUIP::computeSplitCost(curSplit, costParams, costModel);
     }
 
+    const auto splitPoolCosts = VPUIP::computeSplitCosts(splitPool, costParams, costCache);
+
     const auto bestSplitInd = std::min_element(splitPoolCosts.begin(), splitPoolCosts.end()) - splitPoolCosts.begin();
     const auto& bestSplit = splitPool[bestSplitInd];
 
@@ -159,8 +108,7 @@ void generateWorkloads(mlir::OpBuilder& builder, VPU::NCEOpInterface origOp,
 //
 
 void splitOntoWorkloads(mlir::OpBuilder& builder, VPU::NCEOpInterface origOp, VPUIP::WorkloadCostParams& costParams,
-                        VPU::MPEMode mpeMode, bool isTileOverZSupported,
-                        const std::shared_ptr<VPUNN::VPUCostModel>& costModel) {
+                        VPU::MPEMode mpeMode, bool isTileOverZSupported, VPUIP::WorkloadCostCache& costCache) {
     if (auto clusterOp = mlir::dyn_cast<VPU::NCEClusterTilingOp>(origOp->getParentOp())) {
         const auto outputs = clusterOp->getResults();
         VPUX_THROW_UNLESS(outputs.size() == 1, "Wrong outputs size: {0}", outputs.size());
@@ -194,11 +142,11 @@ void splitOntoWorkloads(mlir::OpBuilder& builder, VPU::NCEOpInterface origOp, VP
             costParams.inputShape = inputSubTensorShapes[clusterId];
             costParams.outputShape = outputSubTensorShapes[clusterId];
 
-            generateWorkloads(builder, origOp, costParams, mpeMode, isTileOverZSupported, costModel, clusterIdAttr,
+            generateWorkloads(builder, origOp, costParams, mpeMode, isTileOverZSupported, costCache, clusterIdAttr,
                               outputSubTensorOffsets[clusterId]);
         }
     } else {
-        generateWorkloads(builder, origOp, costParams, mpeMode, isTileOverZSupported, costModel);
+        generateWorkloads(builder, origOp, costParams, mpeMode, isTileOverZSupported, costCache);
     }
 }
 
@@ -208,12 +156,12 @@ void splitOntoWorkloads(mlir::OpBuilder& builder, VPU::NCEOpInterface origOp, VP
 
 class GenericNCERewrite final : public mlir::OpInterfaceRewritePattern<VPU::NCEOpInterface> {
 public:
-    GenericNCERewrite(mlir::MLIRContext* ctx, int64_t numDPU, VPU::ArchKind arch,
-                      std::shared_ptr<VPUNN::VPUCostModel> costModel, Logger log)
+    GenericNCERewrite(mlir::MLIRContext* ctx, int64_t numDPU, VPU::ArchKind arch, VPUIP::WorkloadCostCache& costCache,
+                      Logger log)
             : mlir::OpInterfaceRewritePattern<VPU::NCEOpInterface>(ctx),
               _numDPU(numDPU),
               _arch(arch),
-              _costModel(std::move(costModel)),
+              _costCache(costCache),
               _log(log) {
     }
 
@@ -223,63 +171,24 @@ public:
 private:
     int64_t _numDPU;
     VPU::ArchKind _arch;
-    std::shared_ptr<VPUNN::VPUCostModel> _costModel;
+    VPUIP::WorkloadCostCache& _costCache;
     Logger _log;
 };
 
 mlir::LogicalResult GenericNCERewrite::matchAndRewrite(VPU::NCEOpInterface nceOp,
                                                        mlir::PatternRewriter& rewriter) const {
-    const auto inputType = nceOp->getOperand(0).getType().cast<NDTypeInterface>();
-    const auto outputType = nceOp->getResult(0).getType().cast<NDTypeInterface>();
-
-    const auto inElemType = inputType.getElementType();
-    const auto outElemType = outputType.getElementType();
-
-    const auto inputShape = inputType.getShape();
-    const auto outputShape = outputType.getShape();
-
-    const auto pads = nceOp.getPad();
-
-    const auto mpeByType = mpeMap.at(_arch);
-    const auto mpeMode = mpeByType(inElemType, outElemType, nceOp, outputShape);
-
-    VPUIP::WorkloadCostParams params;
-    params.dataType = inElemType;
-    params.numDPU = _numDPU;
-    params.arch = _arch;
-    params.fullInputShape = inputShape.raw();
-    params.inputShape = inputShape.raw();
-    params.outputShape = outputShape.raw();
-    params.padInfo = VPU::toPadInfo(pads);
-    params.kernelSize = nceOp.getKernelSize();
-    params.kernelStride = nceOp.getStrides();
-
-    bool isTileOverZSupported = mpeMode == VPU::MPEMode::VECTOR;
-
-    llvm::TypeSwitch<mlir::Operation*, void>(nceOp.getOperation())
-            .Case<VPU::NCEConvolutionOp>([&](VPU::NCEConvolutionOp) {
-                const auto inOrder = inputType.getDimsOrder();
-                const auto isCMajor = inOrder == DimsOrder::NCHW;
-
-                params.nceTaskType = isCMajor ? VPUIP::NCETaskType::CMCONV : VPUIP::NCETaskType::CONV;
-                isTileOverZSupported |= !isCMajor;
-            })
-            .Case<VPU::NCEDepthConvolutionOp>([&](VPU::NCEDepthConvolutionOp) {
-                params.nceTaskType = VPUIP::NCETaskType::DWCONV;
-            })
-            .Case<VPU::NCEMaxPoolOp>([&](VPU::NCEMaxPoolOp) {
-                params.nceTaskType = VPUIP::NCETaskType::MAXPOOL;
-            })
-            .Case<VPU::NCEEltwiseOp>([&](VPU::NCEEltwiseOp) {
-                params.nceTaskType = VPUIP::NCETaskType::ELTWISE;
-                isTileOverZSupported = false;
-            })
-            .Default([](mlir::Operation* op) {
-                VPUX_THROW("Unsupported NCE operation '{0}' at '{1}'", op->getName(), op->getLoc());
-            });
+    auto params = VPU::getWorkloadCostParams(nceOp, _arch, _numDPU);
+
+    const auto outElemType = nceOp->getResult(0).getType().cast<NDTypeInterface>().getElementType();
+    const auto mpeMode = VPU::getMPEMode(_arch, params.dataType, outElemType, nceOp, params.outputShape);
+
+    // Z-major convolution can be split over Z in any MPE mode, eltwise can't be split over Z at all
+    const auto isTileOverZSupported =
+            params.nceTaskType != VPUIP::NCETaskType::ELTWISE &&
+            (mpeMode == VPU::MPEMode::VECTOR || params.nceTaskType == VPUIP::NCETaskType::CONV);
 
     rewriter.updateRootInPlace(nceOp, [&]() {
-        splitOntoWorkloads(rewriter, nceOp, params, mpeMode, isTileOverZSupported, _costModel);
+        splitOntoWorkloads(rewriter, nceOp, params, mpeMode, isTileOverZSupported, _costCache);
     });
 
     return mlir::success();
@@ -309,7 +218,6 @@ void SplitNCEOpsOntoWorkloadsPass::safeRunOnFunc() {
     auto module = func->getParentOfType<mlir::ModuleOp>();
 
     const auto arch = VPU::getArch(module);
-    VPUX_THROW_UNLESS(mpeMap.find(arch) != mpeMap.end(), "Failed to map MPE mode to target arch");
 
     auto nceCluster = IE::getAvailableExecutor(module, VPU::ExecutorKind::NCE);
     VPUX_THROW_UNLESS(nceCluster != nullptr, "Failed to get NCE_Cluster information");
@@ -319,7 +227,8 @@ void SplitNCEOpsOntoWorkloadsPass::safeRunOnFunc() {
 
     const auto numDPUs = dpuExec.count();
 
-    const auto costModel = VPU::createCostModel(arch);
+    // Shared by all NCE operations of the function, layers with the same geometry reuse the workload costs
+    VPUIP::WorkloadCostCache costCache(VPU::createCostModel(arch));
 
     mlir::ConversionTarget target(ctx);
     target.markUnknownOpDynamicallyLegal([&](mlir::Operation* op) {
@@ -331,11 +240,13 @@ void SplitNCEOpsOntoWorkloadsPass::safeRunOnFunc() {
     target.addLegalOp<VPU::DPUWorkloadOp>();
 
     mlir::RewritePatternSet patterns(&ctx);
-    patterns.add<GenericNCERewrite>(&ctx, numDPUs, arch, costModel, _log);
+    patterns.add<GenericNCERewrite>(&ctx, numDPUs, arch, costCache, _log);
 
     if (mlir::failed(mlir::applyPartialConversion(func, target, std::move(patterns)))) {
         signalPassFailure();
     }
+
+    _log.trace("Queried VPUNN cost model for {0} unique workloads", costCache.size());
 }
 
 }  // namespace
@@ -0,0 +1,388 @@
+//
+// Copyright (C) 2022 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+//
+
+#include "vpux/compiler/core/cycle_cost_info.hpp"
+#include "vpux/compiler/dialect/VPU/cost_model.hpp"
+#include "vpux/compiler/dialect/VPU/strategy_manager.hpp"
+
+#include "vpux/utils/core/range.hpp"
+
+#include <llvm/ADT/EquivalenceClasses.h>
+
+using namespace vpux;
+using namespace VPU;
+
+namespace {
+
+// The number of the partial assignments kept by the search on the non-linear regions of the graph
+constexpr size_t BEAM_WIDTH = 16;
+
+//
+// Distributed types
+//
+
+// Channel major convolution uses its input and output without the alignment
+bool isChannelMajorConvolution(VPU::NCEOpInterface nceOp) {
+    auto convOp = mlir::dyn_cast<NCEConvolutionOp>(nceOp.getOperation());
+    if (convOp == nullptr) {
+        return false;
+    }
+
+    const auto arch = VPU::getArch(nceOp.getOperation());
+    return VPU::NCEInvariant::isChannelMajorCompatible(arch, convOp.input().getType().cast<vpux::NDTypeInterface>());
+}
+
+DistributedTensorType getDistributedActivationType(VPU::NCEOpInterface nceOp, mlir::Value input,
+                                                   VPU::MultiClusterStrategy strategy, int64_t numClusters) {
+    auto* ctx = nceOp->getContext();
+
+    mlir::ArrayAttr alignmentAttr = nullptr;
+    if (!isChannelMajorConvolution(nceOp)) {
+        const auto alignment = getActivationTensorAlignment(nceOp, strategy);
+        if (alignment.hasValue()) {
+            alignmentAttr = getIntArrayAttr(ctx, alignment.getValue());
+        }
+    }
+
+    const auto distributionMode = getActivationTensorDistributionMode(strategy);
+    const auto numTiles = getIntArrayAttr(ctx, getActivationTensorNumTiles(numClusters, strategy));
+    return createDistributedTensorType(nceOp, input, distributionMode, numTiles, alignmentAttr, strategy);
+}
+
+DistributedTensorType getDistributedOutputType(VPU::NCEOpInterface nceOp, VPU::MultiClusterStrategy strategy,
+                                               int64_t numClusters) {
+    auto* ctx = nceOp->getContext();
+
+    mlir::ArrayAttr alignmentAttr = nullptr;
+    if (!isChannelMajorConvolution(nceOp)) {
+        const auto alignment = getOutputTensorAlignment(strategy);
+        if (alignment.hasValue()) {
+            alignmentAttr = getIntArrayAttr(ctx, alignment.getValue());
+        }
+    }
+
+    const auto distributionMode = getOutputTensorDistributionMode(strategy);
+    const auto numTiles = getIntArrayAttr(ctx, getOutputTensorNumTiles(nceOp, numClusters, strategy));
+    return createDistributedTensorType(nceOp, nceOp->getResult(0), distributionMode, numTiles, alignmentAttr,
+                                       strategy);
+}
+
+// The activation inputs, which are distributed according to the layer strategy
+SmallVector<mlir::Value> getActivationInputs(VPU::NCEOpInterface nceOp) {
+    if (auto eltwiseOp = mlir::dyn_cast<NCEEltwiseOp>(nceOp.getOperation())) {
+        return {eltwiseOp.input1(), eltwiseOp.input2()};
+    }
+    return {nceOp->getOperand(0)};
+}
+
+//
+// StrategyCostModel
+//
+
+// The cost of the layer is the DPU time of the largest per-cluster workload, estimated by VPUNN.
+// The cost of the transition is the spill of the activation to DDR and back, which is inserted between
+// the layers, when the producer output distribution can't be used as the consumer input distribution.
+class StrategyCostModel final {
+public:
+    StrategyCostModel(mlir::FuncOp func, Logger log);
+
+public:
+    size_t getLayerCost(VPU::NCEOpInterface nceOp, VPU::MultiClusterStrategy strategy);
+    size_t getTransitionCost(VPU::NCEOpInterface producer, VPU::MultiClusterStrategy producerStrategy,
+                             VPU::NCEOpInterface consumer, VPU::MultiClusterStrategy consumerStrategy,
+                             mlir::Value activation);
+
+private:
+    VPU::ArchKind _arch;
+    int64_t _numClusters;
+    int64_t _numDPU;
+    CycleCostInfo _cycleCostInfo;
+    VPUIP::WorkloadCostCache _workloadCostCache;
+};
+
+StrategyCostModel::StrategyCostModel(mlir::FuncOp func, Logger log)
+        : _arch(VPU::getArch(func)),
+          _cycleCostInfo(func->getParentOfType<mlir::ModuleOp>(), log),
+          _workloadCostCache(VPU::createCostModel(_arch)) {
+    auto module = func->getParentOfType<mlir::ModuleOp>();
+    auto nceCluster = IE::getAvailableExecutor(module, ExecutorKind::NCE);
+    auto dpuExec = nceCluster.getSubExecutor(VPU::ExecutorKindAttr::get(module->getContext(), ExecutorKind::DPU));
+    _numClusters = nceCluster.count();
+    _numDPU = dpuExec.count();
+}
+
+size_t StrategyCostModel::getLayerCost(VPU::NCEOpInterface nceOp, VPU::MultiClusterStrategy strategy) {
+    auto params = VPU::getWorkloadCostParams(nceOp, _arch, _numDPU);
+    params.inputShape =
+            getDistributedActivationType(nceOp, nceOp->getOperand(0), strategy, _numClusters).getLargestCompactShape();
+    params.outputShape = getDistributedOutputType(nceOp, strategy, _numClusters).getLargestCompactShape();
+
+    return checked_cast<size_t>(VPU::getDPUCost(nceOp, params, _workloadCostCache));
+}
+
+size_t StrategyCostModel::getTransitionCost(VPU::NCEOpInterface producer, VPU::MultiClusterStrategy producerStrategy,
+                                            VPU::NCEOpInterface consumer, VPU::MultiClusterStrategy consumerStrategy,
+                                            mlir::Value activation) {
+    const auto outputType = getDistributedOutputType(producer, producerStrategy, _numClusters);
+    const auto inputType = getDistributedActivationType(consumer, activation, consumerStrategy, _numClusters);
+
+    if (outputType == inputType || VPU::isDistributedCastCompatible(outputType, inputType).succeeded()) {
+        return 0;
+    }
+
+    const auto size = activation.getType().cast<vpux::NDTypeInterface>().getTotalAllocSize();
+    return _cycleCostInfo.getDMACost(size, MemoryKind::CMX_NN, MemoryKind::DDR) +
+           _cycleCostInfo.getDMACost(size, MemoryKind::DDR, MemoryKind::CMX_NN);
+}
+
+//
+// StrategyGraph
+//
+
+struct StrategyNode final {
+    VPU::NCEOpInterface nceOp;
+    SmallVector<VPU::MultiClusterStrategy> strategies;
+    SmallVector<size_t> costs;
+};
+
+// The transition costs are indexed by the producer and the consumer strategy indices
+struct StrategyEdge final {
+    size_t producer;
+    size_t consumer;
+    SmallVector<SmallVector<size_t>> costs;
+};
+
+struct StrategyGraph final {
+    SmallVector<StrategyNode> nodes;
+    SmallVector<StrategyEdge> edges;
+    SmallVector<SmallVector<size_t>> inEdges;
+    SmallVector<SmallVector<size_t>> outEdges;
+};
+
+// The partial assignment, which covers the nodes of the component up to the current one
+struct BeamState final {
+    SmallVector<size_t> choices;
+    size_t cost = 0;
+};
+
+// The position of every graph node in the region, the choices for the region are indexed by it
+DenseMap<size_t, size_t> getLocalIndices(ArrayRef<size_t> region) {
+    DenseMap<size_t, size_t> localIndices;
+    for (auto p : region | indexed) {
+        localIndices[p.value()] = p.index();
+    }
+    return localIndices;
+}
+
+// Every node of a linear chain has at most one producer and one consumer within the chain
+bool isLinearChain(const StrategyGraph& graph, ArrayRef<size_t> component) {
+    return llvm::all_of(component, [&](size_t node) {
+        return graph.inEdges[node].size() <= 1 && graph.outEdges[node].size() <= 1;
+    });
+}
+
+// The exact solution for the linear chain, with the nodes in the topological order
+SmallVector<size_t> solveChain(const StrategyGraph& graph, ArrayRef<size_t> chain) {
+    // The best cost of the chain prefix for every strategy of its last node and the choice for its producer
+    SmallVector<SmallVector<size_t>> bestCosts(chain.size());
+    SmallVector<SmallVector<size_t>> bestPrev(chain.size());
+
+    bestCosts[0] = graph.nodes[chain[0]].costs;
+
+    for (auto ind : irange<size_t>(1, chain.size())) {
+        const auto& node = graph.nodes[chain[ind]];
+        const auto& edge = graph.edges[graph.inEdges[chain[ind]].front()];
+
+        bestCosts[ind].assign(node.strategies.size(), std::numeric_limits<size_t>::max());
+        bestPrev[ind].assign(node.strategies.size(), 0);
+
+        for (auto cur : irange(node.strategies.size())) {
+            for (auto prev : irange(bestCosts[ind - 1].size())) {
+                const auto cost = bestCosts[ind - 1][prev] + edge.costs[prev][cur] + node.costs[cur];
+                if (cost < bestCosts[ind][cur]) {
+                    bestCosts[ind][cur] = cost;
+                    bestPrev[ind][cur] = prev;
+                }
+            }
+        }
+    }
+
+    SmallVector<size_t> choices(chain.size());
+
+    const auto& lastCosts = bestCosts.back();
+    choices.back() = std::distance(lastCosts.begin(), std::min_element(lastCosts.begin(), lastCosts.end()));
+    for (auto ind : irange<size_t>(1, chain.size()) | reversed) {
+        choices[ind - 1] = bestPrev[ind][choices[ind]];
+    }
+
+    return choices;
+}
+
+// Beam search over the nodes in the topological order. The cost of a node choice includes the transitions
+// from all its producers, which are assigned before it. Once the deadline has passed, only the best
+// assignment is extended, which degrades the search into the greedy one.
+SmallVector<size_t> solveRegion(const StrategyGraph& graph, ArrayRef<size_t> region,
+                                std::chrono::steady_clock::time_point deadline, bool& isTimedOut) {
+    const auto localIndices = getLocalIndices(region);
+
+    SmallVector<BeamState> beam(1);
+
+    for (auto ind : irange(region.size())) {
+        if (!isTimedOut && std::chrono::steady_clock::now() > deadline) {
+            isTimedOut = true;
+        }
+
+        const auto& node = graph.nodes[region[ind]];
+
+        SmallVector<BeamState> candidates;
+        for (const auto& state : beam) {
+            for (auto cur : irange(node.strategies.size())) {
+                auto cost = state.cost + node.costs[cur];
+                for (auto edgeInd : graph.inEdges[region[ind]]) {
+                    const auto& edge = graph.edges[edgeInd];
+                    cost += edge.costs[state.choices[localIndices.lookup(edge.producer)]][cur];
+                }
+
+                BeamState candidate{state.choices, cost};
+                candidate.choices.push_back(cur);
+                candidates.push_back(std::move(candidate));
+            }
+        }
+
+        const auto beamWidth = std::min(isTimedOut ? size_t(1) : BEAM_WIDTH, candidates.size());
+        std::partial_sort(candidates.begin(), candidates.begin() + beamWidth, candidates.end(),
+                          [](const BeamState& lhs, const BeamState& rhs) {
+                              return lhs.cost < rhs.cost;
+                          });
+        candidates.resize(beamWidth);
+
+        beam = std::move(candidates);
+    }
+
+    return beam.front().choices;
+}
+
+}  // namespace
+
+//
+// optimizeMultiClusterStrategy
+//
+
+void StrategyManager::optimizeMultiClusterStrategy(std::chrono::milliseconds timeBudget) {
+    StrategyCostModel costModel(_func, _log);
+
+    StrategyGraph graph;
+    DenseMap<mlir::Operation*, size_t> nodeIndices;
+
+    _func.walk([&](VPU::NCEOpInterface nceOp) {
+        auto strategies = getFeasibleStrategies(nceOp);
+        if (strategies.empty()) {
+            _log.trace("Layer '{0}' at '{1}' doesn't fit CMX with any multi-cluster strategy", nceOp->getName(),
+                       nceOp->getLoc());
+            return;
+        }
+
+        StrategyNode node{nceOp, std::move(strategies), {}};
+        for (auto strategy : node.strategies) {
+            node.costs.push_back(costModel.getLayerCost(nceOp, strategy));
+        }
+
+        nodeIndices[nceOp.getOperation()] = graph.nodes.size();
+        graph.nodes.push_back(std::move(node));
+    });
+
+    graph.inEdges.resize(graph.nodes.size());
+    graph.outEdges.resize(graph.nodes.size());
+
+    // The operations are visited in the topological order, so the producers are always assigned first
+    llvm::EquivalenceClasses<size_t> components;
+    for (auto consumerInd : irange(graph.nodes.size())) {
+        components.insert(consumerInd);
+
+        const auto& consumer = graph.nodes[consumerInd];
+        for (auto activation : getActivationInputs(consumer.nceOp)) {
+            const auto producerIt = nodeIndices.find(activation.getDefiningOp());
+            if (producerIt == nodeIndices.end()) {
+                continue;
+            }
+
+            const auto producerInd = producerIt->second;
+            const auto& producer = graph.nodes[producerInd];
+
+            StrategyEdge edge{producerInd, consumerInd, {}};
+            for (auto producerStrategy : producer.strategies) {
+                SmallVector<size_t> costs;
+                for (auto consumerStrategy : consumer.strategies) {
+                    costs.push_back(costModel.getTransitionCost(producer.nceOp, producerStrategy, consumer.nceOp,
+                                                                consumerStrategy, activation));
+                }
+                edge.costs.push_back(std::move(costs));
+            }
+
+            graph.inEdges[consumerInd].push_back(graph.edges.size());
+            graph.outEdges[producerInd].push_back(graph.edges.size());
+            graph.edges.push_back(std::move(edge));
+
+            components.unionSets(producerInd, consumerInd);
+        }
+    }
+
+    SmallVector<SmallVector<size_t>> regions;
+    for (auto it = components.begin(); it != components.end(); ++it) {
+        if (!it->isLeader()) {
+            continue;
+        }
+
+        SmallVector<size_t> region(components.member_begin(it), components.member_end());
+        llvm::sort(region);
+        regions.push_back(std::move(region));
+    }
+
+    const auto deadline = std::chrono::steady_clock::now() + timeBudget;
+    bool isTimedOut = false;
+
+    size_t totalCost = 0;
+    size_t numSpilledEdges = 0;
+
+    for (const auto& region : regions) {
+        const auto choices = isLinearChain(graph, region) ? solveChain(graph, region)
+                                                          : solveRegion(graph, region, deadline, isTimedOut);
+
+        for (auto p : region | indexed) {
+            const auto& node = graph.nodes[p.value()];
+            const auto choice = choices[p.index()];
+
+            setLayerStrategy(node.strategies[choice], node.nceOp);
+            totalCost += node.costs[choice];
+        }
+
+        const auto localIndices = getLocalIndices(region);
+        for (auto nodeInd : region) {
+            for (auto edgeInd : graph.inEdges[nodeInd]) {
+                const auto& edge = graph.edges[edgeInd];
+                const auto producerChoice = choices[localIndices.lookup(edge.producer)];
+                const auto consumerChoice = choices[localIndices.lookup(edge.consumer)];
+
+                const auto cost = edge.costs[producerChoice][consumerChoice];
+                if (cost != 0) {
+                    ++numSpilledEdges;
+                }
+                totalCost += cost;
+            }
+        }
+    }
+
+    if (isTimedOut) {
+        _log.warning("Multi-cluster strategy search exceeded the time budget of {0} ms, the rest of the graph was "
+                     "assigned greedily",
+                     timeBudget.count());
+    }
+
+    _log.trace("Assigned multi-cluster strategies to {0} layers in {1} regions, {2} activations are spilled, "
+               "estimated cost is {3} cycles",
+               graph.nodes.size(), regions.size(), numSpilledEdges, totalCost);
+}
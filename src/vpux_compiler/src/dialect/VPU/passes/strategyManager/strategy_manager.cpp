@@ -137,6 +137,68 @@ void StrategyManager::assignMultiClusterStrategy() {
     _func.walk(callback);
 }
 
+// The strategies, which are compatible with the layer and fit CMX, under the same compatibility rules as the greedy
+// assignment. Unlike the greedy assignment, Clustering is offered even when a split strategy fits, because keeping
+// the activation whole can be cheaper than the spills around a split layer.
+SmallVector<VPU::MultiClusterStrategy> StrategyManager::getFeasibleStrategies(VPU::NCEOpInterface nceOp) const {
+    SmallVector<VPU::MultiClusterStrategy> strategies;
+
+    const auto addIfFits = [&](const auto& layerStrategy, VPU::MultiClusterStrategy strategy) {
+        if (layerStrategy.doesLayerFitIntoCMX(nceOp, strategy)) {
+            strategies.push_back(strategy);
+        }
+    };
+
+    llvm::TypeSwitch<mlir::Operation*, void>(nceOp.getOperation())
+            .Case<NCEMaxPoolOp>([&](NCEMaxPoolOp) {
+                if (_maxPoolStrategy.isOperationSplitOverHeightCompatible(nceOp)) {
+                    addIfFits(_maxPoolStrategy, VPU::MultiClusterStrategy::SplitOverHeight);
+                }
+                addIfFits(_maxPoolStrategy, VPU::MultiClusterStrategy::Clustering);
+            })
+            .Case<NCEEltwiseOp>([&](NCEEltwiseOp) {
+                if (_eltwiseStrategy.isOperationSplitOverHeightCompatible(nceOp)) {
+                    addIfFits(_eltwiseStrategy, VPU::MultiClusterStrategy::SplitOverHeight);
+                }
+                addIfFits(_eltwiseStrategy, VPU::MultiClusterStrategy::Clustering);
+            })
+            .Case<NCEConvolutionOp>([&](NCEConvolutionOp origOp) {
+                if (DimsOrder::fromValue(origOp.input()) == DimsOrder::NHWC) {
+                    if (_convolutionStrategy.isOperationSplitOverHeightCompatible(nceOp)) {
+                        addIfFits(_convolutionStrategy, VPU::MultiClusterStrategy::SplitOverHeight);
+                    }
+                    if (_convolutionStrategy.isOperationSplitOverKernelCompatible(nceOp)) {
+                        addIfFits(_convolutionStrategy, VPU::MultiClusterStrategy::SplitOverKernel);
+                    }
+                } else if (DimsOrder::fromValue(origOp.input()) == DimsOrder::NCHW) {
+                    const auto arch = VPU::getArch(origOp.getOperation());
+                    const auto canUseCMajor = VPU::NCEInvariant::isChannelMajorCompatible(
+                            arch, origOp.input().getType().cast<vpux::NDTypeInterface>());
+
+                    if (canUseCMajor && _convolutionStrategy.isOperationSplitOverHeightCompatible(nceOp)) {
+                        addIfFits(_convolutionStrategy, VPU::MultiClusterStrategy::SplitOverHeightOverlapped);
+                    }
+                } else {
+                    VPUX_THROW("Unsupported input layout {0} to convolution ", DimsOrder::fromValue(origOp.input()));
+                }
+                addIfFits(_convolutionStrategy, VPU::MultiClusterStrategy::Clustering);
+            })
+            .Case<NCEDepthConvolutionOp>([&](NCEDepthConvolutionOp) {
+                if (_depthConvolutionStrategy.isOperationSplitOverHeightCompatible(nceOp)) {
+                    addIfFits(_depthConvolutionStrategy, VPU::MultiClusterStrategy::SplitOverHeight);
+                }
+                if (_depthConvolutionStrategy.isOperationSplitOverKernelCompatible(nceOp)) {
+                    addIfFits(_depthConvolutionStrategy, VPU::MultiClusterStrategy::SplitOverKernel);
+                }
+                addIfFits(_depthConvolutionStrategy, VPU::MultiClusterStrategy::Clustering);
+            })
+            .Default([](mlir::Operation*) {
+                // Not supported by the NCE, so it doesn't get a multi-cluster strategy
+            });
+
+    return strategies;
+}
+
 void StrategyManager::setLayerStrategy(VPU::MultiClusterStrategy strategy, VPU::NCEOpInterface nceOp) {
     if (strategy == VPU::MultiClusterStrategy::SplitOverHeight ||
         strategy == VPU::MultiClusterStrategy::SplitOverKernel || strategy == VPU::MultiClusterStrategy::Clustering ||
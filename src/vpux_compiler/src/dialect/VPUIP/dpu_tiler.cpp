@@ -12,6 +12,8 @@
 
 #include "vpux/utils/core/numeric.hpp"
 
+#include <llvm/ADT/Hashing.h>
+
 #include <numeric>
 #include <set>
 
@@ -99,15 +101,13 @@ VPUNN::VPUDevice getVPUDeviceType(VPU::ArchKind archKind) {
     }
 }
 
-VPUNN::VPUTensor getVPUTensor(ShapeRef shape, mlir::Type elemType) {
-    return VPUNN::VPUTensor(
-            {
-                    static_cast<unsigned int>(shape[Dims4D::Act::W]),  //
-                    static_cast<unsigned int>(shape[Dims4D::Act::H]),  //
-                    static_cast<unsigned int>(shape[Dims4D::Act::C]),  //
-                    static_cast<unsigned int>(shape[Dims4D::Act::N]),  //
-            },
-            getElementType(elemType));
+std::array<unsigned int, 4> getVPUTensorShape(ShapeRef shape) {
+    return {
+            static_cast<unsigned int>(shape[Dims4D::Act::W]),  //
+            static_cast<unsigned int>(shape[Dims4D::Act::H]),  //
+            static_cast<unsigned int>(shape[Dims4D::Act::C]),  //
+            static_cast<unsigned int>(shape[Dims4D::Act::N]),  //
+    };
 }
 
 SmallVector<int64_t> getSplitsFromRange(int64_t maxSplitRange, int64_t maxLimit) {
@@ -353,56 +353,123 @@ void vpux::VPUIP::DpuTiler::tileOverHW(int64_t splitNumber, SplitDimension split
     }
 }
 
-int64_t vpux::VPUIP::computeSplitCost(const WorkloadSplit& split, const WorkloadCostParams& params,
-                                      const std::shared_ptr<VPUNN::VPUCostModel>& costModel) {
-    VPUX_THROW_WHEN(params.kernelSize.size() < 2, "Kernel array size less than 2");
+//
+// WorkloadCostCache
+//
+
+bool vpux::VPUIP::DPUWorkloadKey::operator==(const DPUWorkloadKey& other) const {
+    return device == other.device && op == other.op && dataType == other.dataType && inputShape == other.inputShape &&
+           outputShape == other.outputShape && kernels == other.kernels && strides == other.strides &&
+           pads == other.pads && mpeMode == other.mpeMode;
+}
+
+size_t vpux::VPUIP::DPUWorkloadKeyHash::operator()(const DPUWorkloadKey& key) const {
+    return llvm::hash_combine(key.device, key.op, key.dataType,
+                              llvm::hash_combine_range(key.inputShape.begin(), key.inputShape.end()),
+                              llvm::hash_combine_range(key.outputShape.begin(), key.outputShape.end()),
+                              llvm::hash_combine_range(key.kernels.begin(), key.kernels.end()),
+                              llvm::hash_combine_range(key.strides.begin(), key.strides.end()),
+                              llvm::hash_combine_range(key.pads.begin(), key.pads.end()), key.mpeMode);
+}
+
+vpux::VPUIP::WorkloadCostCache::WorkloadCostCache(std::shared_ptr<VPUNN::VPUCostModel> costModel)
+        : _costModel(std::move(costModel)) {
+    VPUX_THROW_UNLESS(_costModel != nullptr, "Got NULL cost model");
+}
+
+int64_t vpux::VPUIP::WorkloadCostCache::getDPUCost(const DPUWorkloadKey& key) {
+    const auto it = _costs.find(key);
+    if (it != _costs.end()) {
+        return it->second;
+    }
+
+    const auto wlCost = _costModel->DPU({key.device,
+                                         key.op,
+                                         {VPUNN::VPUTensor(key.inputShape, key.dataType)},
+                                         {VPUNN::VPUTensor(key.outputShape, key.dataType)},
+                                         key.kernels,
+                                         key.strides,
+                                         key.pads,
+                                         key.mpeMode});
+
+    return _costs.emplace(key, static_cast<int64_t>(wlCost)).first->second;
+}
+
+//
+// computeSplitCost
+//
+
+namespace {
+
+VPUIP::DPUWorkloadKey getWorkloadKey(const VPUIP::WorkloadTile& wl, const VPUIP::WorkloadCostParams& params) {
     const auto KY = params.kernelSize[Dims4D::Kernel::Y.ind()];
     const auto KX = params.kernelSize[Dims4D::Kernel::X.ind()];
 
-    VPUX_THROW_WHEN(params.kernelStride.size() < 2, "Kernel stride array size less than 2");
     const auto SY = params.kernelStride[Dims4D::Strides::Y.ind()];
     const auto SX = params.kernelStride[Dims4D::Strides::X.ind()];
 
-    const auto opType = getOperationType(params.nceTaskType);
+    const auto& outputTile = std::get<0>(wl);
+    const auto mpeMode = std::get<1>(wl);
+
+    const auto padsTileConf = backInferPadsTile(outputTile, params.fullInputShape, params.padInfo,
+                                                makeArrayRef({KY, KX}), makeArrayRef({SY, SX}));
+
+    const auto IW = (outputTile.shape[Dims4D::Act::W] - 1) * SX + KX - padsTileConf.left - padsTileConf.right;
+    const auto IH = (outputTile.shape[Dims4D::Act::H] - 1) * SY + KY - padsTileConf.top - padsTileConf.bottom;
+    const auto IC = params.nceTaskType == VPUIP::NCETaskType::CONV ||
+                                    params.nceTaskType == VPUIP::NCETaskType::CMCONV ||
+                                    params.nceTaskType == VPUIP::NCETaskType::FCL
+                            ? params.inputShape[Dims4D::Act::C]
+                            : outputTile.shape[Dims4D::Act::C];
+    const auto IN = outputTile.shape[Dims4D::Act::N];
+
+    return {getVPUDeviceType(params.arch),
+            getOperationType(params.nceTaskType),
+            getElementType(params.dataType),
+            getVPUTensorShape(ShapeRef({IN, IC, IH, IW})),
+            getVPUTensorShape(outputTile.shape),
+            {static_cast<unsigned int>(KX), static_cast<unsigned int>(KY)},
+            {static_cast<unsigned int>(SX), static_cast<unsigned int>(SY)},
+            {static_cast<unsigned int>(padsTileConf.top), static_cast<unsigned int>(padsTileConf.bottom),
+             static_cast<unsigned int>(padsTileConf.left), static_cast<unsigned int>(padsTileConf.right)},
+            getExecutionMode(mpeMode)};
+}
+
+}  // namespace
+
+int64_t vpux::VPUIP::computeSplitCost(const WorkloadSplit& split, const WorkloadCostParams& params,
+                                      const std::shared_ptr<VPUNN::VPUCostModel>& costModel) {
+    WorkloadCostCache costCache(costModel);
+    return computeSplitCost(split, params, costCache);
+}
+
+int64_t vpux::VPUIP::computeSplitCost(const WorkloadSplit& split, const WorkloadCostParams& params,
+                                      WorkloadCostCache& costCache) {
+    return computeSplitCosts(ArrayRef<WorkloadSplit>(split), params, costCache).front();
+}
+
+SmallVector<int64_t> vpux::VPUIP::computeSplitCosts(ArrayRef<WorkloadSplit> splits, const WorkloadCostParams& params,
+                                                    WorkloadCostCache& costCache) {
+    VPUX_THROW_WHEN(params.kernelSize.size() < 2, "Kernel array size less than 2");
+    VPUX_THROW_WHEN(params.kernelStride.size() < 2, "Kernel stride array size less than 2");
+
+    SmallVector<int64_t> splitCosts;
+    splitCosts.reserve(splits.size());
 
     std::vector<int64_t> workloadCost;
-    workloadCost.reserve(split.size());
-
-    for (const auto& wl : split) {
-        const auto& outputTile = std::get<0>(wl);
-        const auto mpeMode = std::get<1>(wl);
-
-        const auto padsTileConf = backInferPadsTile(outputTile, params.fullInputShape, params.padInfo,
-                                                    makeArrayRef({KY, KX}), makeArrayRef({SY, SX}));
-
-        const auto outputTensor = getVPUTensor(outputTile.shape, params.dataType);
-
-        const auto IW = (outputTile.shape[Dims4D::Act::W] - 1) * SX + KX - padsTileConf.left - padsTileConf.right;
-        const auto IH = (outputTile.shape[Dims4D::Act::H] - 1) * SY + KY - padsTileConf.top - padsTileConf.bottom;
-        const auto IC = params.nceTaskType == VPUIP::NCETaskType::CONV ||
-                                        params.nceTaskType == VPUIP::NCETaskType::CMCONV ||
-                                        params.nceTaskType == VPUIP::NCETaskType::FCL
-                                ? params.inputShape[Dims4D::Act::C]
-                                : outputTile.shape[Dims4D::Act::C];
-        const auto IN = outputTile.shape[Dims4D::Act::N];
-
-        const auto inputTensor = getVPUTensor(ShapeRef({IN, IC, IH, IW}), params.dataType);
-
-        const auto wlCost = costModel->DPU(
-                {getVPUDeviceType(params.arch),
-                 opType,
-                 {inputTensor},
-                 {outputTensor},
-                 {static_cast<unsigned int>(KX), static_cast<unsigned int>(KY)},
-                 {static_cast<unsigned int>(SX), static_cast<unsigned int>(SY)},
-                 {static_cast<unsigned int>(padsTileConf.top), static_cast<unsigned int>(padsTileConf.bottom),
-                  static_cast<unsigned int>(padsTileConf.left), static_cast<unsigned int>(padsTileConf.right)},
-                 getExecutionMode(mpeMode)});
-
-        workloadCost.push_back(static_cast<int64_t>(wlCost));
+
+    for (const auto& split : splits) {
+        workloadCost.clear();
+        workloadCost.reserve(split.size());
+
+        for (const auto& wl : split) {
+            workloadCost.push_back(costCache.getDPUCost(getWorkloadKey(wl, params)));
+        }
+
+        splitCosts.push_back(VPUNN::dpu_schedule(params.numDPU, workloadCost, RUNTIME_OVERHEAD_PER_WORKLOAD));
     }
 
-    return VPUNN::dpu_schedule(params.numDPU, workloadCost, RUNTIME_OVERHEAD_PER_WORKLOAD);
+    return splitCosts;
 }
 
 StringLiteral vpux::VPUIP::stringifyEnum(SplitDimension splitDimension) {
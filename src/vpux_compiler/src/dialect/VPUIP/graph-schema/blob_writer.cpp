@@ -613,8 +613,13 @@ VPUIP::BlobWriter::IndirectDataReference vpux::VPUIP::BlobWriter::createIndirect
 VPUIP::BlobWriter::BinaryData vpux::VPUIP::BlobWriter::createBinaryData(ArrayRef<uint64_t> content,
                                                                         vpux::NDTypeInterface type,
                                                                         bool csram_cacheable) {
+    return createBinaryData(createVector(content), type, csram_cacheable);
+}
+
+VPUIP::BlobWriter::BinaryData vpux::VPUIP::BlobWriter::createBinaryData(Vector<uint64_t> serializedContent,
+                                                                        vpux::NDTypeInterface type,
+                                                                        bool csram_cacheable) {
     const auto totalByteSize = type.getTotalAllocSize();
-    const auto serializedContent = createVector(content);
 
     MVCNN::BinaryDataBuilder builder(_impl);
     builder.add_underlying_type(MVCNN::DType::DType_U8);
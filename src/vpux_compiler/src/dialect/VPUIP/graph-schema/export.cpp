@@ -17,6 +17,7 @@
 #include "vpux/compiler/dialect/VPUIP/ops.hpp"
 #include "vpux/compiler/dialect/VPUIP/utils.hpp"
 #include "vpux/compiler/dialect/VPURT/ops.hpp"
+#include "vpux/compiler/dialect/const/utils/content_cache.hpp"
 
 #include "vpux/utils/IE/loop.hpp"
 #include "vpux/utils/core/array_ref.hpp"
@@ -36,6 +37,7 @@
 #include <transformations/utils/utils.hpp>
 #include <version.hpp>
 
+#include <cstring>
 #include <unordered_map>
 
 // Base of frequency values used in tables (in MHz).
@@ -506,32 +508,48 @@ SmallVector<VPUIP::BlobWriter::BinaryData> serializeBinaryData(VPUIP::BlobWriter
 
     auto constOps = to_small_vector(netFunc.getOps<Const::DeclareOp>());
 
-    SmallVector<std::vector<uint64_t>> bufs(constOps.size());
+    // Reserve the space for all constants inside the builder first and fold them directly into it
 
-    loop_1d(LoopExecPolicy::Parallel, checked_cast<int64_t>(constOps.size()), [&](int64_t ind) {
-        const auto attr = constOps[static_cast<size_t>(ind)].contentAttr();
+    SmallVector<VPUIP::BlobWriter::Vector<uint64_t>> serializedContents;
+    serializedContents.reserve(constOps.size());
+
+    for (auto constOp : constOps) {
+        const auto totalByteSize = constOp.contentAttr().getType().getTotalAllocSize();
+        const auto numElems = alignVal(static_cast<size_t>(totalByteSize.count()), sizeof(uint64_t)) / sizeof(uint64_t);
+
+        uint64_t* data = nullptr;
+        serializedContents.push_back(writer.impl().CreateUninitializedVector(numElems, &data));
+    }
+
+    // The builder storage might be reallocated while the vectors are created,
+    // so the final data locations are resolved only after all of them are in place.
+    // No other builder calls are allowed until the data is copied.
+    SmallVector<MutableArrayRef<char>> slots;
+    slots.reserve(constOps.size());
 
-        const auto type = attr.getType();
-        const auto content = attr.fold();
+    for (const auto& serializedContent : serializedContents) {
+        auto* vec = flatbuffers::GetMutableTemporaryPointer(writer.impl(), serializedContent);
+        slots.push_back(makeMutableArrayRef(reinterpret_cast<char*>(vec->data()), vec->size() * sizeof(uint64_t)));
+    }
 
-        const auto totalByteSize = type.cast<vpux::NDTypeInterface>().getTotalAllocSize();
-        bufs[static_cast<size_t>(ind)].resize(
-                alignVal(static_cast<size_t>(totalByteSize.count()), sizeof(uint64_t)) / sizeof(uint64_t), 0);
+    loop_1d(LoopExecPolicy::Parallel, checked_cast<int64_t>(constOps.size()), [&](int64_t ind) {
+        const auto attr = constOps[static_cast<size_t>(ind)].contentAttr();
+        const auto totalByteSize = static_cast<size_t>(attr.getType().getTotalAllocSize().count());
 
-        const auto buf = makeMutableArrayRef(reinterpret_cast<char*>(bufs[static_cast<size_t>(ind)].data()),
-                                             totalByteSize.count());
-        content.copyTo(buf);
+        auto slot = slots[static_cast<size_t>(ind)];
+        Const::copyFoldedContent(attr, slot.take_front(totalByteSize));
+        std::fill(slot.begin() + totalByteSize, slot.end(), char(0));
     });
 
     SmallVector<VPUIP::BlobWriter::BinaryData> binaryData(constOps.size());
 
     for (auto constTensorInd : irange(constOps.size())) {
         auto constOp = constOps[constTensorInd];
-        const auto& content = bufs[constTensorInd];
 
         log.trace("Got constant at '{0}' with type '{1}'", constOp->getLoc(), constOp.getType());
 
-        binaryData[constTensorInd] = writer.createBinaryData(content, constOp.getType().cast<vpux::NDTypeInterface>());
+        binaryData[constTensorInd] = writer.createBinaryData(serializedContents[constTensorInd],
+                                                             constOp.getType().cast<vpux::NDTypeInterface>());
 
         writer.createTensorRef(constOp.output(), printToString("constant-{0}", constTensorInd),
                                VPURT::BufferSection::Constant, checked_cast<uint32_t>(constTensorInd), 0);
@@ -633,22 +651,33 @@ flatbuffers::Offset<MVCNN::GraphFile> createGraphFile(VPUIP::BlobWriter& writer,
     return graphBuilder.Finish();
 }
 
-}  // namespace
+//
+// estimateBlobSize
+//
 
-flatbuffers::DetachedBuffer vpux::VPUIP::exportToBlob(mlir::ModuleOp module, mlir::TimingScope& rootTiming,
-                                                      const std::vector<vpux::PreProcessInfo>& preprocessInfo,
-                                                      const std::vector<std::shared_ptr<const ov::Node>>& parameters,
-                                                      const std::vector<std::shared_ptr<const ov::Node>>& results,
-                                                      Logger log) {
-    log.setName("VPUIP::BackEnd");
+size_t estimateBlobSize(mlir::FuncOp netFunc) {
+    // Room for the tasks, tensors and kernels descriptions
+    constexpr Byte METADATA_RESERVE = 16_MB;
 
-    log.trace("Extract 'IE.{0}' from Module", IE::CNNNetworkOp::getOperationName());
-    IE::CNNNetworkOp netOp;
-    mlir::FuncOp netFunc;
-    IE::CNNNetworkOp::getFromModule(module, netOp, netFunc);
+    size_t constantsSize = 0;
+    for (auto constOp : netFunc.getOps<Const::DeclareOp>()) {
+        const auto totalByteSize = constOp.contentAttr().getType().getTotalAllocSize();
+        constantsSize += alignVal(static_cast<size_t>(totalByteSize.count()), sizeof(uint64_t));
+    }
 
-    VPUIP::BlobWriter writer(log.nest(), VPU::getArch(module));
+    return constantsSize + static_cast<size_t>(METADATA_RESERVE.count());
+}
 
+//
+// serializeGraphFile
+//
+
+// Serializes the graph file and finishes the builder, the result is available via `writer.impl()`
+void serializeGraphFile(VPUIP::BlobWriter& writer, mlir::ModuleOp module, IE::CNNNetworkOp netOp,
+                        mlir::FuncOp netFunc, mlir::TimingScope& rootTiming,
+                        const std::vector<vpux::PreProcessInfo>& preprocessInfo,
+                        const std::vector<std::shared_ptr<const ov::Node>>& parameters,
+                        const std::vector<std::shared_ptr<const ov::Node>>& results, Logger log) {
     const auto withDynamicBarriers = !netFunc.getOps<VPURT::DeclareVirtualBarrierOp>().empty();
 
     const auto header = createSummaryHeader(writer, module, netOp, netFunc, withDynamicBarriers, rootTiming,
@@ -663,9 +692,9 @@ flatbuffers::DetachedBuffer vpux::VPUIP::exportToBlob(mlir::ModuleOp module, mli
 
     auto finalTiming = rootTiming.nest("Finalize serialized graph");
     writer.impl().Finish(graphFile, "BLOB");
-    auto detached = writer.impl().Release();
 
-    auto serializedGraphFile = MVCNN::GetGraphFile(detached.data());
+    const auto blobData = writer.impl().GetBufferPointer();
+    auto serializedGraphFile = MVCNN::GetGraphFile(blobData);
 
     const uint64_t reserved_offset = 1;
     std::unordered_set<uint32_t> kernelDataAligned;
@@ -680,7 +709,7 @@ flatbuffers::DetachedBuffer vpux::VPUIP::exportToBlob(mlir::ModuleOp module, mli
 
         // checking that current description designates aligned section -
         // TODO: implement cases where offset is 1 actually fixes alignment
-        auto section_data_plus_offset = section_data->Data() + section->data_offset() - detached.data();
+        auto section_data_plus_offset = section_data->Data() + section->data_offset() - blobData;
 
         if (!(section_data_plus_offset % alignmentReq)) {
             VPUX_THROW_UNLESS(section->data_offset() != reserved_offset,
@@ -689,7 +718,7 @@ flatbuffers::DetachedBuffer vpux::VPUIP::exportToBlob(mlir::ModuleOp module, mli
                               section->name()->c_str(), sectionLogical, section_data_plus_offset, reserved_offset);
             return static_cast<ptrdiff_t>(0);
         }
-        ptrdiff_t offset = section_data->Data() - detached.data();
+        ptrdiff_t offset = section_data->Data() - blobData;
         log.trace("offset to kernel {0} {1} in Finished FBB is {2}", section->name()->c_str(), sectionLogical, offset);
 
         auto aligned_offset = llvm::alignTo(offset, alignmentReq);
@@ -777,6 +806,33 @@ flatbuffers::DetachedBuffer vpux::VPUIP::exportToBlob(mlir::ModuleOp module, mli
             alignSection(managementKernel->globalArgs(), ".runtime.data");
         }
     }
+}
+
+}  // namespace
+
+//
+// exportToBlob
+//
+
+flatbuffers::DetachedBuffer vpux::VPUIP::exportToBlob(mlir::ModuleOp module, mlir::TimingScope& rootTiming,
+                                                      const std::vector<vpux::PreProcessInfo>& preprocessInfo,
+                                                      const std::vector<std::shared_ptr<const ov::Node>>& parameters,
+                                                      const std::vector<std::shared_ptr<const ov::Node>>& results,
+                                                      Logger log) {
+    log.setName("VPUIP::BackEnd");
+
+    log.trace("Extract 'IE.{0}' from Module", IE::CNNNetworkOp::getOperationName());
+    IE::CNNNetworkOp netOp;
+    mlir::FuncOp netFunc;
+    IE::CNNNetworkOp::getFromModule(module, netOp, netFunc);
+
+    // The default allocator doesn't initialize the memory, so the reservation costs nothing until it is written
+    const auto initialSize = estimateBlobSize(netFunc);
+    log.trace("Pre-allocate '{0}' bytes for the blob", initialSize);
+
+    VPUIP::BlobWriter writer(log.nest(), VPU::getArch(module), initialSize);
+    serializeGraphFile(writer, module, netOp, netFunc, rootTiming, preprocessInfo, parameters, results, log);
 
-    return detached;
+    // The finished blob is located at the end of the builder storage and is returned as a view on it
+    return writer.impl().Release();
 }
@@ -20,6 +20,7 @@
 #include <ie_input_info.hpp>
 
 #include <algorithm>
+#include <cstdint>
 
 using namespace vpux;
 using namespace InferenceEngine;
@@ -272,12 +273,56 @@ void adjustNumStreams(const MVCNN::SummaryHeader* header, int& numStreams) {
 
 vpux::VPUIP::NetworkDescription::NetworkDescription(std::vector<char> blob)
         : _compiledNetwork(std::move(blob)), _quantParams{} {
-    VPUX_THROW_UNLESS(!_compiledNetwork.empty(), "Got NULL pointer");
+    _networkModel = _compiledNetwork.data();
+    _networkModelSize = _compiledNetwork.size();
 
-    flatbuffers::Verifier verifier(reinterpret_cast<const uint8_t*>(_compiledNetwork.data()), _compiledNetwork.size());
+    parseNetworkModel();
+}
+
+vpux::VPUIP::NetworkDescription::NetworkDescription(MappedBlob::Ptr blob)
+        : _mappedBlob(std::move(blob)), _quantParams{} {
+    VPUX_THROW_UNLESS(_mappedBlob != nullptr, "Got NULL pointer");
+
+    _networkModel = _mappedBlob->data();
+    _networkModelSize = _mappedBlob->size();
+
+    // FlatBuffers verifier requires the buffer to be aligned to its largest scalar,
+    // which might not hold for blobs stored after the export header
+    if (reinterpret_cast<std::uintptr_t>(_networkModel) % alignof(uint64_t) != 0) {
+        _compiledNetwork.assign(_networkModel, _networkModel + _networkModelSize);
+        _mappedBlob.reset();
+
+        _networkModel = _compiledNetwork.data();
+    }
+
+    parseNetworkModel();
+}
+
+vpux::VPUIP::NetworkDescription::NetworkDescription(flatbuffers::DetachedBuffer blob)
+        : _detachedBlob(std::move(blob)), _quantParams{} {
+    _networkModel = reinterpret_cast<const char*>(_detachedBlob.data());
+    _networkModelSize = _detachedBlob.size();
+
+    parseNetworkModel();
+}
+
+const std::vector<char>& vpux::VPUIP::NetworkDescription::getCompiledNetwork() const {
+    if (_mappedBlob != nullptr || _detachedBlob.data() != nullptr) {
+        std::call_once(_compiledNetworkCopied, [this]() {
+            _compiledNetwork.assign(_networkModel, _networkModel + _networkModelSize);
+        });
+    }
+
+    return _compiledNetwork;
+}
+
+void vpux::VPUIP::NetworkDescription::parseNetworkModel() {
+    VPUX_THROW_UNLESS(_networkModel != nullptr && _networkModelSize != 0, "Got NULL pointer");
+
+    flatbuffers::Verifier verifier(reinterpret_cast<const uint8_t*>(_networkModel), _networkModelSize);
     VPUX_THROW_UNLESS(MVCNN::VerifyGraphFileBuffer(verifier), "Got invalid VPUIP blob");
 
-    const auto* graphFile = MVCNN::GetGraphFile(_compiledNetwork.data());
+    const auto* graphFile = MVCNN::GetGraphFile(_networkModel);
     const auto* header = graphFile->header();
 
     if (header->identifier() != nullptr) {
@@ -8,6 +8,7 @@
 #include "vpux/compiler/dialect/VPUIP/ops.hpp"
 #include "vpux/compiler/dialect/VPUIP/passes.hpp"
 #include "vpux/compiler/dialect/VPURT/ops.hpp"
+#include "vpux/compiler/dialect/const/utils/content_cache.hpp"
 #include "vpux/compiler/utils/codec_factory.hpp"
 #include "vpux/compiler/utils/rewriter.hpp"
 #include "vpux/compiler/utils/types.hpp"
@@ -74,9 +75,11 @@ mlir::LogicalResult NNDMAOpConverter::matchAndRewrite(VPUIP::NNDMAOp origOp, mli
         return mlir::failure();
     }
 
-    const auto inContent = inContentAttr.fold();
-    std::vector<uint8_t> origData(checked_cast<size_t>(totalInputSize.count()));
-    inContent.copyTo(makeMutableArrayRef(reinterpret_cast<char*>(origData.data()), origData.size()));
+    const auto inContent = Const::foldContent(inContentAttr);
+    VPUX_THROW_UNLESS(inContent->size() == checked_cast<size_t>(totalInputSize.count()),
+                      "Folded constant size '{0}' doesn't match the DMA input size '{1}'", inContent->size(),
+                      totalInputSize);
+    const std::vector<uint8_t> origData(inContent->begin(), inContent->end());
 
     const auto compressedData = _codec->compress(origData);
     if (compressedData.empty()) {
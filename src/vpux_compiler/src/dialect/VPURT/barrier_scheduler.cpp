@@ -778,19 +778,24 @@ bool BarrierScheduler::performRuntimeSimulation() {
 
     if (!success) {
         _log.trace("Barrier simulation was not successful removing the barriers that were inserted");
-        removeVirtualBarriers();
-        _configureBarrierOpWaitMap.clear();
-        _configureBarrierOpUpdateMap.clear();
-        _configureTaskOpWaitMap.clear();
-        _configureTaskOpUpdateMap.clear();
-        _orderedBarrier.clear();
-        _schedulingOrder.clear();
+        removeScheduledBarriers();
     }
 
     _log.trace("Barrier simulation result is {0} with upperbound {1}", success, _barrierCount);
     return success;
 }
 
+// Drops the barriers inserted by the last generated schedule, so a schedule with another barrier bound can be generated
+void BarrierScheduler::removeScheduledBarriers() {
+    removeVirtualBarriers();
+    _configureBarrierOpWaitMap.clear();
+    _configureBarrierOpUpdateMap.clear();
+    _configureTaskOpWaitMap.clear();
+    _configureTaskOpUpdateMap.clear();
+    _orderedBarrier.clear();
+    _schedulingOrder.clear();
+}
+
 // If two barriers have same consumers, they can be merged
 // If a barrier has no producers, it can be removed
 // If a barrier only has DMA producers and consumers, it can be removed
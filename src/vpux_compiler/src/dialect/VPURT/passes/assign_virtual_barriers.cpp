@@ -57,16 +57,67 @@ void AssignVirtualBarriersPass::safeRunOnFunc() {
     // safety' from the runtime to the compiler. The definition of barrier safety is that it can be guaranteed the
     // barriers will be reprogrammed by the LeonNN during inference at the correct time during an inference.
 
-    bool success = false;
-    for (size_t barrier_bound = (numBarriersToUse / 2); !success && (barrier_bound >= 1UL); --barrier_bound) {
-        barrierScheduler.generateScheduleWithBarriers(barrier_bound, numSlotsPerBarrierToUse);
-        success = barrierScheduler.performRuntimeSimulation();
+    // The largest barrier bound that simulates successfully is searched, since it keeps the most parallelism.
+    // The bounds are probed from the top with a galloping step, the last failed and the first successful bounds are
+    // then narrowed with bisection, relying on a smaller bound being feasible whenever a larger one is. Only one schedule
+    // can live in the IR, so the barriers of a successful attempt are removed before the next probe and the best
+    // schedule is regenerated if the last probe was not the best one.
+
+    const auto maxBarrierBound = static_cast<size_t>(numBarriersToUse / 2);
+
+    size_t scheduledBound = 0;
+    const auto trySchedule = [&](size_t barrierBound) {
+        if (scheduledBound != 0) {
+            barrierScheduler.removeScheduledBarriers();
+            scheduledBound = 0;
+        }
+
+        barrierScheduler.generateScheduleWithBarriers(barrierBound, numSlotsPerBarrierToUse);
+        if (!barrierScheduler.performRuntimeSimulation()) {
+            return false;
+        }
+
+        scheduledBound = barrierBound;
+        return true;
+    };
+
+    size_t successBound = 0;
+    size_t failedBound = maxBarrierBound + 1;
+
+    for (size_t barrierBound = maxBarrierBound, step = 1; barrierBound >= 1; step *= 2) {
+        if (trySchedule(barrierBound)) {
+            successBound = barrierBound;
+            break;
+        }
+
+        failedBound = barrierBound;
+        if (barrierBound == 1) {
+            break;
+        }
+        barrierBound = barrierBound > step ? barrierBound - step : 1;
     }
-    barrierScheduler.clearTemporaryAttributes();
 
-    if (!success) {
+    if (successBound == 0) {
+        barrierScheduler.clearTemporaryAttributes();
         VPUX_THROW("Barrier scheduling and/or runtime simulation was not suceessful");
     }
+
+    while (failedBound - successBound > 1) {
+        const auto barrierBound = successBound + (failedBound - successBound) / 2;
+        if (trySchedule(barrierBound)) {
+            successBound = barrierBound;
+        } else {
+            failedBound = barrierBound;
+        }
+    }
+
+    if (scheduledBound != successBound) {
+        VPUX_THROW_UNLESS(trySchedule(successBound), "Failed to regenerate the schedule with {0} barriers",
+                          successBound);
+    }
+
+    _log.trace("Barrier scheduling succeeded with barrier bound {0}", successBound);
+    barrierScheduler.clearTemporaryAttributes();
 }
 
 }  // namespace
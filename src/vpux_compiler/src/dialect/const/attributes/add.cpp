@@ -9,6 +9,7 @@
 #include "vpux/compiler/utils/attributes.hpp"
 
 #include "vpux/utils/IE/loop.hpp"
+#include "vpux/utils/core/checked_cast.hpp"
 #include "vpux/utils/core/func_ref.hpp"
 
 #include <mlir/Dialect/Quant/QuantTypes.h>
@@ -81,9 +82,12 @@ Const::Content vpux::Const::AddAttr::transform(vpux::Const::Content& input) cons
 
     const auto bias = static_cast<float>(getBias().getValue().convertToDouble());
 
-    loop_1d(LoopExecPolicy::Parallel, shiftedVals.size(), [&](size_t i) {
-        shiftedVals[i] = values[i] + bias;
-    });
+    loop_1d_chunked(LoopExecPolicy::Parallel, checked_cast<int64_t>(shiftedVals.size()),
+                    [&](int64_t begin, int64_t end) {
+                        for (int64_t i = begin; i < end; ++i) {
+                            shiftedVals[i] = values[i] + bias;
+                        }
+                    });
 
     return output;
 }
@@ -8,6 +8,7 @@
 #include "vpux/compiler/dialect/const/attributes/content.hpp"
 
 #include "vpux/compiler/dialect/const/ops.hpp"
+#include "vpux/compiler/dialect/const/utils/transformations.hpp"
 #include "vpux/compiler/utils/types.hpp"
 
 #include "vpux/utils/core/format.hpp"
@@ -170,10 +171,8 @@ Const::Content wrapBaseContent(mlir::ElementsAttr baseContent) {
 Const::Content vpux::Const::ContentAttr::fold() const {
     auto res = wrapBaseContent(getBaseContent());
 
-    if (const auto transformations = getImpl()->transformations) {
-        for (const auto attr : transformations.getAsRange<Const::TransformAttrInterface>()) {
-            res = attr.transform(res);
-        }
+    if (getImpl()->transformations != nullptr) {
+        return Const::details::applyTransformations(res, getTransformations());
     }
 
     return res;
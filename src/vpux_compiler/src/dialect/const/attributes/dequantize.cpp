@@ -59,9 +59,12 @@ Const::Content vpux::Const::DequantizeAttr::transform(vpux::Const::Content& inpu
         const auto scale = uniformType.getScale();
         const auto zeroPoint = uniformType.getZeroPoint();
 
-        loop_1d(LoopExecPolicy::Parallel, realVals.size(), [&](size_t i) {
-            realVals[i] = dequantize(qVals[i], scale, zeroPoint);
-        });
+        loop_1d_chunked(LoopExecPolicy::Parallel, checked_cast<int64_t>(realVals.size()),
+                        [&](int64_t begin, int64_t end) {
+                            for (int64_t i = begin; i < end; ++i) {
+                                realVals[i] = dequantize(qVals[i], scale, zeroPoint);
+                            }
+                        });
     } else if (const auto uniformType = qElemType.dyn_cast<mlir::quant::UniformQuantizedPerAxisType>()) {
         const auto scales = uniformType.getScales();
         const auto zeroPoints = uniformType.getZeroPoints();
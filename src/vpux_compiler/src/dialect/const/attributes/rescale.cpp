@@ -12,6 +12,7 @@
 
 #include "vpux/utils/IE/loop.hpp"
 #include "vpux/utils/core/format.hpp"
+#include "vpux/utils/core/checked_cast.hpp"
 #include "vpux/utils/core/func_ref.hpp"
 #include "vpux/utils/core/range.hpp"
 
@@ -85,9 +86,12 @@ Const::Content vpux::Const::RescaleAttr::transform(vpux::Const::Content& input)
 
     const auto scale = static_cast<float>(getScale().getValue().convertToDouble());
 
-    loop_1d(LoopExecPolicy::Parallel, scaledVals.size(), [&](size_t i) {
-        scaledVals[i] = values[i] * scale;
-    });
+    loop_1d_chunked(LoopExecPolicy::Parallel, checked_cast<int64_t>(scaledVals.size()),
+                    [&](int64_t begin, int64_t end) {
+                        for (int64_t i = begin; i < end; ++i) {
+                            scaledVals[i] = values[i] * scale;
+                        }
+                    });
 
     return output;
 }
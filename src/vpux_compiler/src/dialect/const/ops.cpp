@@ -40,6 +40,23 @@ mlir::Operation* vpux::Const::ConstDialect::materializeConstant(mlir::OpBuilder&
     return builder.create<Const::DeclareOp>(loc, type, value.cast<Const::ContentAttr>());
 }
 
+//
+// ConstDialect::FoldedContentCache
+//
+
+void vpux::Const::ConstDialect::setFoldedContentCache(std::shared_ptr<FoldedContentCache> cache) {
+    _foldedContentCache = std::move(cache);
+    _foldedContentCacheStats = FoldedContentCache::Statistics();
+}
+
+Const::FoldedContentCache* vpux::Const::ConstDialect::getFoldedContentCache() const {
+    return _foldedContentCache.get();
+}
+
+Const::FoldedContentCache::Statistics& vpux::Const::ConstDialect::getFoldedContentCacheStatistics() {
+    return _foldedContentCacheStats;
+}
+
 //
 // ConstDialect::populateBufferizePatterns
 //
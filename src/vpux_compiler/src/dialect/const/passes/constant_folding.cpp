@@ -7,10 +7,14 @@
 
 #include "vpux/compiler/dialect/IE/ops.hpp"
 #include "vpux/compiler/dialect/const/ops.hpp"
+#include "vpux/compiler/dialect/const/utils/content_cache.hpp"
 #include "vpux/compiler/utils/error.hpp"
 #include "vpux/compiler/utils/rewriter.hpp"
 #include "vpux/compiler/utils/types.hpp"
+#include "vpux/utils/IE/loop.hpp"
+#include "vpux/utils/core/dense_map.hpp"
 #include "vpux/utils/core/numeric.hpp"
+#include "vpux/utils/core/range.hpp"
 
 #include <mlir/IR/DialectImplementation.h>
 #include <mlir/Pass/PassManager.h>
@@ -34,39 +38,85 @@ private:
     void safeRunOnFunc() final;
 };
 
+//
+// getFoldedType
+//
+
+mlir::RankedTensorType getFoldedType(Const::ContentAttr content) {
+    const auto contentType = content.getType();
+    const auto contentElemType = contentType.getElementType();
+
+    if (auto qtype = contentElemType.dyn_cast<mlir::quant::QuantizedType>()) {
+        return contentType.changeElemType(normalizeQuantStorageType(qtype)).cast<mlir::RankedTensorType>();
+    }
+
+    return contentType.cast<mlir::RankedTensorType>();
+}
+
+//
+// safeRunOnFunc
+//
+
 void ConstantFoldingPass::safeRunOnFunc() {
     auto func = getFunction();
 
-    func.walk([](Const::DeclareOp origOp) {
-        mlir::OpBuilder builder(origOp);
-
-        const auto content = origOp.content();
-        const auto contentType = content.getType();
-        const auto contentElemType = contentType.getElementType();
+    // Identical (baseContent, transformations) pairs are uniqued by the MLIR context,
+    // so the attribute itself can be used as a key to fold each content only once.
 
-        const auto bufSize = checked_cast<size_t>(contentType.getTotalAllocSize().count());
-        std::vector<char> tempBuf(bufSize);
-        content.copyTo(makeMutableArrayRef(tempBuf.data(), bufSize));
+    SmallVector<Const::DeclareOp> constOps;
+    SmallVector<Const::ContentAttr> uniqueContents;
+    DenseMap<mlir::Attribute, size_t> contentInds;
 
-        auto rankedTensorType = contentType.cast<mlir::RankedTensorType>();
+    func.walk([&](Const::DeclareOp origOp) {
+        const auto content = origOp.contentAttr();
 
-        if (auto qtype = contentElemType.dyn_cast<mlir::quant::QuantizedType>()) {
-            rankedTensorType =
-                    contentType.changeElemType(normalizeQuantStorageType(qtype)).cast<mlir::RankedTensorType>();
+        if (contentInds.insert({content, uniqueContents.size()}).second) {
+            uniqueContents.push_back(content);
         }
 
+        constOps.push_back(origOp);
+    });
+
+    _log.trace("Got '{0}' constants with '{1}' unique contents", constOps.size(), uniqueContents.size());
+
+    SmallVector<Const::FoldedContentCache::Buffer> foldedBufs(uniqueContents.size());
+
+    // Folding creates types and affine maps in the context, which is safe only while its multithreading is enabled.
+    // It is disabled for the crash reproducer and the IR printing.
+    const auto isParallel = enableParallelOpt && getContext().isMultithreadingEnabled();
+    const auto policy = isParallel ? LoopExecPolicy::Parallel : LoopExecPolicy::Sequential;
+    loop_1d(policy, checked_cast<int64_t>(uniqueContents.size()), [&](int64_t ind) {
+        const auto contentInd = checked_cast<size_t>(ind);
+        foldedBufs[contentInd] = Const::foldContent(uniqueContents[contentInd]);
+    });
+
+    SmallVector<Const::ContentAttr> foldedContents(uniqueContents.size());
+
+    for (auto contentInd : irange(uniqueContents.size())) {
+        const auto rankedTensorType = getFoldedType(uniqueContents[contentInd]);
+
+        // Release the buffer reference as soon as its data is owned by the MLIR context
+        const auto foldedBuf = std::move(foldedBufs[contentInd]);
+        const auto tempBuf = makeArrayRef(foldedBuf->data(), foldedBuf->size());
+
         bool isSplatBuffer = false;
         VPUX_THROW_UNLESS(mlir::DenseElementsAttr::isValidRawBuffer(rankedTensorType, tempBuf, isSplatBuffer),
-                          "Constant node '{0}' has invalid buffer", origOp.getLoc());
+                          "Constant content '{0}' has invalid buffer", uniqueContents[contentInd]);
 
         const auto denseAttr = mlir::DenseElementsAttr::getFromRawBuffer(rankedTensorType, tempBuf, isSplatBuffer);
+        foldedContents[contentInd] = Const::ContentAttr::get(denseAttr);
+    }
+
+    for (auto origOp : constOps) {
+        const auto contentInd = contentInds[origOp.contentAttr()];
 
+        mlir::OpBuilder builder(origOp);
         const auto newOp =
-                builder.create<Const::DeclareOp>(origOp.getLoc(), origOp.getType(), Const::ContentAttr::get(denseAttr));
+                builder.create<Const::DeclareOp>(origOp.getLoc(), origOp.getType(), foldedContents[contentInd]);
         origOp.replaceAllUsesWith(newOp);
 
         origOp.erase();
-    });
+    }
 }
 
 }  // namespace
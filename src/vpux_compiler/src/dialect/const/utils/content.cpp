@@ -96,9 +96,11 @@ void fillBuf(const Range& range, MutableArrayRef<char> buf) {
                       "Buffer with byte size '{0}' is not enough to hold actual elements with '{1}' byte size",
                       buf.size(), range.size() * VALUE_BYTE_SIZE);
 
-    loop_1d(LoopExecPolicy::Parallel, range.size(), [&](size_t i) {
-        auto* bufPtr = reinterpret_cast<value_type*>(buf.data() + i * VALUE_BYTE_SIZE);
-        *bufPtr = range[i];
+    auto* bufPtr = reinterpret_cast<value_type*>(buf.data());
+    loop_1d_chunked(LoopExecPolicy::Parallel, checked_cast<int64_t>(range.size()), [&](int64_t begin, int64_t end) {
+        for (int64_t i = begin; i < end; ++i) {
+            bufPtr[i] = range[i];
+        }
     });
 }
 
@@ -0,0 +1,206 @@
+//
+// Copyright (C) 2022 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+//
+
+#include "vpux/compiler/dialect/const/utils/content_cache.hpp"
+
+#include "vpux/compiler/dialect/const/ops.hpp"
+
+#include "vpux/utils/core/checked_cast.hpp"
+#include "vpux/utils/core/format.hpp"
+
+#include <llvm/ADT/StringExtras.h>
+#include <llvm/Support/SHA1.h>
+#include <llvm/Support/raw_ostream.h>
+
+using namespace vpux;
+
+namespace {
+
+// The keys of the contents seen only once are dropped all together when the limit is reached
+constexpr size_t MAX_CANDIDATES = 64 * 1024;
+
+ArrayRef<char> getBaseContentData(mlir::ElementsAttr baseContent) {
+    if (const auto dense = baseContent.dyn_cast<mlir::DenseElementsAttr>()) {
+        return dense.getRawData();
+    }
+
+    const auto opaque = baseContent.cast<mlir::OpaqueElementsAttr>();
+    const auto bytes = opaque.getValue();
+    return makeArrayRef(bytes.data(), bytes.size());
+}
+
+}  // namespace
+
+//
+// FoldedContentCache
+//
+
+vpux::Const::FoldedContentCache::FoldedContentCache(Byte maxSize): _maxSize(maxSize) {
+}
+
+Const::FoldedContentCache::Key vpux::Const::FoldedContentCache::getKey(ContentAttr attr) {
+    const auto baseContent = attr.getBaseContent();
+    const auto data = getBaseContentData(baseContent);
+
+    llvm::SHA1 hasher;
+    hasher.update(StringRef(data.data(), data.size()));
+
+    // Types and transformations are context-dependent objects, so their textual form is used as a part of the key
+    std::string descr;
+    llvm::raw_string_ostream os(descr);
+
+    os << baseContent.getType() << " " << attr.getType();
+    for (const auto tr : attr.getTransformations()) {
+        os << " " << tr;
+    }
+    os.flush();
+
+    return Key(llvm::toHex(hasher.final()), data.size(), std::move(descr));
+}
+
+Const::FoldedContentCache::Buffer vpux::Const::FoldedContentCache::fold(ContentAttr attr) {
+    const auto bufSize = checked_cast<size_t>(attr.getType().getTotalAllocSize().count());
+    auto folded = std::make_shared<std::vector<char>>(bufSize);
+    attr.fold().copyTo(makeMutableArrayRef(folded->data(), bufSize));
+    return folded;
+}
+
+Const::FoldedContentCache::Buffer vpux::Const::FoldedContentCache::find(const Key& key, Statistics& stats) {
+    const auto it = _entries.find(key);
+    if (it == _entries.end()) {
+        ++stats.misses;
+        return nullptr;
+    }
+
+    ++stats.hits;
+    _lru.splice(_lru.begin(), _lru, it->second);
+    return it->second->second;
+}
+
+bool vpux::Const::FoldedContentCache::admit(const Key& key) {
+    if (_candidates.erase(key) != 0) {
+        return true;
+    }
+
+    if (_candidates.size() >= MAX_CANDIDATES) {
+        _candidates.clear();
+    }
+
+    _candidates.insert(key);
+    return false;
+}
+
+Const::FoldedContentCache::Buffer vpux::Const::FoldedContentCache::getOrFold(ContentAttr attr, Statistics& stats) {
+    auto key = getKey(attr);
+
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        if (auto cached = find(key, stats)) {
+            return cached;
+        }
+    }
+
+    // Fold outside of the lock to allow concurrent folding of different contents
+    auto buf = fold(attr);
+    const auto requiredSize = Byte(checked_cast<int64_t>(buf->size()));
+
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    if (requiredSize > _maxSize || _entries.count(key) != 0 || !admit(key)) {
+        return buf;
+    }
+
+    evict(requiredSize, stats);
+
+    _lru.emplace_front(key, buf);
+    _entries.emplace(std::move(key), _lru.begin());
+    _usedSize += requiredSize;
+
+    return buf;
+}
+
+void vpux::Const::FoldedContentCache::copyTo(ContentAttr attr, MutableArrayRef<char> buf, Statistics& stats) {
+    const auto key = getKey(attr);
+
+    Buffer cached;
+
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        cached = find(key, stats);
+    }
+
+    if (cached == nullptr) {
+        attr.fold().copyTo(buf);
+        return;
+    }
+
+    VPUX_THROW_UNLESS(buf.size() == cached->size(), "Buffer size '{0}' doesn't match folded content size '{1}'",
+                      buf.size(), cached->size());
+    std::copy_n(cached->data(), cached->size(), buf.data());
+}
+
+void vpux::Const::FoldedContentCache::evict(Byte requiredSize, Statistics& stats) {
+    while (!_lru.empty() && _usedSize + requiredSize > _maxSize) {
+        const auto& last = _lru.back();
+
+        _usedSize -= Byte(checked_cast<int64_t>(last.second->size()));
+        ++stats.evictions;
+
+        _entries.erase(last.first);
+        _lru.pop_back();
+    }
+}
+
+Byte vpux::Const::FoldedContentCache::getMaxSize() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _maxSize;
+}
+
+Byte vpux::Const::FoldedContentCache::getUsedSize() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _usedSize;
+}
+
+void vpux::Const::FoldedContentCache::clear() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _lru.clear();
+    _entries.clear();
+    _candidates.clear();
+    _usedSize = Byte(0);
+}
+
+//
+// foldContent
+//
+
+Const::FoldedContentCache::Buffer vpux::Const::foldContent(ContentAttr attr) {
+    auto* dialect = attr.getContext()->getLoadedDialect<ConstDialect>();
+    VPUX_THROW_WHEN(dialect == nullptr, "Const dialect is not loaded");
+
+    if (auto* cache = dialect->getFoldedContentCache()) {
+        return cache->getOrFold(attr, dialect->getFoldedContentCacheStatistics());
+    }
+
+    return FoldedContentCache::fold(attr);
+}
+
+//
+// copyFoldedContent
+//
+
+void vpux::Const::copyFoldedContent(ContentAttr attr, MutableArrayRef<char> buf) {
+    auto* dialect = attr.getContext()->getLoadedDialect<ConstDialect>();
+    VPUX_THROW_WHEN(dialect == nullptr, "Const dialect is not loaded");
+
+    if (auto* cache = dialect->getFoldedContentCache()) {
+        cache->copyTo(attr, buf, dialect->getFoldedContentCacheStatistics());
+        return;
+    }
+
+    attr.fold().copyTo(buf);
+}
@@ -7,11 +7,17 @@
 
 #include "vpux/compiler/dialect/const/utils/transformations.hpp"
 #include "vpux/compiler/dialect/const/attributes/content.hpp"
+#include "vpux/compiler/utils/attributes.hpp"
+#include "vpux/compiler/utils/quantization.hpp"
 
 #include "vpux/utils/IE/blob.hpp"
 #include "vpux/utils/IE/loop.hpp"
 #include "vpux/utils/core/hash.hpp"
+#include "vpux/utils/core/range.hpp"
 
+#include <mlir/Dialect/Quant/QuantTypes.h>
+
+#include <algorithm>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -92,3 +98,281 @@ Const::Content Const::details::memPermuteTransformation(vpux::Const::Content& in
         return output;
     }
 }
+
+//
+// Element-wise chain
+//
+
+namespace {
+
+bool isElementWiseTransformation(Const::TransformAttrInterface attr) {
+    return attr.isa<Const::ConvertElemTypeAttr, Const::RescaleAttr, Const::AddAttr>();
+}
+
+size_t getElementWiseChainLength(const Const::Content& input,
+                                 ArrayRef<Const::TransformAttrInterface> transformations) {
+    size_t length = 0;
+    size_t numDataSteps = 0;
+
+    // Dequantize is fused only as the first step, when the quantization parameters are per-tensor
+    if (!transformations.empty() && transformations.front().isa<Const::DequantizeAttr>() &&
+        input.getElementType().isa<mlir::quant::UniformQuantizedType>()) {
+        ++length;
+        ++numDataSteps;
+    }
+
+    for (; length < transformations.size() && isElementWiseTransformation(transformations[length]); ++length) {
+        // ConvertElemType doesn't touch the data, the conversion is performed on the fly
+        if (!transformations[length].isa<Const::ConvertElemTypeAttr>()) {
+            ++numDataSteps;
+        }
+    }
+
+    // The fusion makes sense only if it saves at least one temporary buffer
+    return numDataSteps >= 2 ? length : 0;
+}
+
+Const::Content applyElementWiseChain(Const::Content& input, ArrayRef<Const::TransformAttrInterface> chain) {
+    enum class StepKind { Scale, Shift };
+    SmallVector<std::pair<StepKind, float>> steps;
+
+    Optional<mlir::quant::UniformQuantizedType> dequantizeType;
+
+    auto outType = input.getType();
+    for (const auto attr : chain) {
+        outType = attr.inferOutputType(outType);
+
+        if (attr.isa<Const::DequantizeAttr>()) {
+            dequantizeType = input.getElementType().cast<mlir::quant::UniformQuantizedType>();
+        } else if (const auto rescaleAttr = attr.dyn_cast<Const::RescaleAttr>()) {
+            const auto scale = static_cast<float>(rescaleAttr.getScale().getValue().convertToDouble());
+            steps.emplace_back(StepKind::Scale, scale);
+        } else if (const auto addAttr = attr.dyn_cast<Const::AddAttr>()) {
+            const auto bias = static_cast<float>(addAttr.getBias().getValue().convertToDouble());
+            steps.emplace_back(StepKind::Shift, bias);
+        }
+    }
+
+    auto output = Const::Content::allocTempBuffer(outType, mlir::Float32Type::get(chain.front().getContext()),
+                                                  input.isSplat());
+    auto outVals = output.getTempBuf<float>();
+
+    // Each step is evaluated in FP32 in the same order as in the step-by-step execution
+    const auto applySteps = [&](float val) {
+        for (const auto& step : steps) {
+            val = step.first == StepKind::Scale ? val * step.second : val + step.second;
+        }
+        return val;
+    };
+
+    if (dequantizeType.hasValue()) {
+        const auto scale = dequantizeType->getScale();
+        const auto zeroPoint = dequantizeType->getZeroPoint();
+        const auto qVals = input.getValues<int64_t>();
+
+        loop_1d_chunked(LoopExecPolicy::Parallel, checked_cast<int64_t>(outVals.size()),
+                        [&](int64_t begin, int64_t end) {
+                            for (int64_t i = begin; i < end; ++i) {
+                                outVals[i] = applySteps(dequantize(qVals[i], scale, zeroPoint));
+                            }
+                        });
+    } else {
+        const auto values = input.getValues<float>();
+
+        loop_1d_chunked(LoopExecPolicy::Parallel, checked_cast<int64_t>(outVals.size()),
+                        [&](int64_t begin, int64_t end) {
+                            for (int64_t i = begin; i < end; ++i) {
+                                outVals[i] = applySteps(values[i]);
+                            }
+                        });
+    }
+
+    return output;
+}
+
+}  // namespace
+
+//
+// Index remapping chain
+//
+
+namespace {
+
+bool isIndexRemappingTransformation(Const::TransformAttrInterface attr) {
+    return attr.isa<Const::SubViewAttr, Const::ReorderAttr, Const::PadWithZeroAttr>();
+}
+
+size_t getIndexRemappingChainLength(const Const::Content& input,
+                                    ArrayRef<Const::TransformAttrInterface> transformations) {
+    const Bit storageElemSize = getElemTypeSize(input.getStorageElemType());
+    if (input.getRank() == 0 || storageElemSize.count() % CHAR_BIT != 0) {
+        return 0;
+    }
+
+    size_t length = 0;
+    while (length < transformations.size() && isIndexRemappingTransformation(transformations[length])) {
+        ++length;
+    }
+
+    // The fusion makes sense only if it saves at least one temporary buffer
+    return length >= 2 ? length : 0;
+}
+
+Const::Content applyIndexRemappingChain(Const::Content& input, ArrayRef<Const::TransformAttrInterface> chain) {
+    const auto inType = input.getType();
+    const auto rank = checked_cast<size_t>(inType.getRank());
+
+    // All index remapping transformations are translations in logical coordinates.
+    // The whole chain is described by the shift from the output to the input coordinates
+    // and by the output region, which is not filled by padding.
+    SmallVector<int64_t> shift(rank, 0);
+    SmallVector<int64_t> validBegin(rank, 0);
+    auto validEnd = to_small_vector(inType.getShape().raw());
+    bool hasPadding = false;
+
+    auto outType = inType;
+    for (const auto attr : chain) {
+        outType = attr.inferOutputType(outType);
+
+        if (const auto subViewAttr = attr.dyn_cast<Const::SubViewAttr>()) {
+            const auto offset = parseIntArrayAttr<int64_t>(subViewAttr.getOffset());
+
+            for (auto d : irange(rank)) {
+                shift[d] += offset[d];
+                validBegin[d] -= offset[d];
+                validEnd[d] -= offset[d];
+            }
+        } else if (const auto padAttr = attr.dyn_cast<Const::PadWithZeroAttr>()) {
+            const auto padBefore = parseIntArrayAttr<int64_t>(padAttr.getPadBefore());
+
+            for (auto d : irange(rank)) {
+                shift[d] -= padBefore[d];
+                validBegin[d] += padBefore[d];
+                validEnd[d] += padBefore[d];
+            }
+
+            hasPadding = true;
+        }
+
+        // ReorderAttr changes only the memory layout and keeps logical coordinates as is
+
+        const auto curShape = outType.getShape();
+        for (auto d : irange(rank)) {
+            validBegin[d] = std::max<int64_t>(validBegin[d], 0);
+            validEnd[d] = std::min<int64_t>(validEnd[d], curShape[Dim(d)]);
+        }
+    }
+
+    if (input.isSplat() && !hasPadding) {
+        return Const::Content::moveBuffer(outType, std::move(input));
+    }
+
+    auto output = Const::Content::allocTempBuffer(outType, input.getStorageElemType(), false);
+    if (hasPadding) {
+        output.fillWithZero();
+    }
+
+    const Byte elemSize = getElemTypeSize(input.getStorageElemType());
+    const auto elemByteSize = checked_cast<size_t>(elemSize.count());
+
+    const auto inBuf = input.getRawStorageBuf();
+    auto outBuf = output.getRawTempBuf();
+
+    // Input strides in elements for each logical dimension, splat input is always read from the single element
+    SmallVector<int64_t> inStrides(rank, 0);
+    if (!input.isSplat()) {
+        const auto inOrder = inType.getDimsOrder();
+        const auto inMemShape = inOrder.toMemoryOrder(inType.getShape());
+
+        int64_t stride = 1;
+        for (auto md = checked_cast<int64_t>(rank) - 1; md >= 0; --md) {
+            inStrides[inOrder.toDim(MemDim(md)).ind()] = stride;
+            stride *= inMemShape[MemDim(md)];
+        }
+    }
+
+    const auto outOrder = outType.getDimsOrder();
+    const auto outMemShape = outOrder.toMemoryOrder(outType.getShape());
+
+    const auto innerMemDim = MemDim(rank - 1);
+    const auto innerDim = outOrder.toDim(innerMemDim).ind();
+    const auto innerSize = outMemShape[innerMemDim];
+    const auto innerBegin = validBegin[innerDim];
+    const auto innerEnd = validEnd[innerDim];
+
+    if (innerSize == 0 || innerBegin >= innerEnd) {
+        return output;
+    }
+
+    const auto numLines = outType.getNumElements() / innerSize;
+
+    loop_1d(LoopExecPolicy::Parallel, numLines, [&](int64_t line) {
+        const auto outMemIndND = getMemIndexND(line * innerSize, outMemShape);
+
+        int64_t inLineInd = 0;
+        for (auto md : irange(rank - 1)) {
+            const auto d = outOrder.toDim(MemDim(md)).ind();
+            const auto outInd = outMemIndND[MemDim(md)];
+
+            if (outInd < validBegin[d] || outInd >= validEnd[d]) {
+                return;
+            }
+
+            inLineInd += (outInd + shift[d]) * inStrides[d];
+        }
+
+        const auto inBeginInd = inLineInd + (innerBegin + shift[innerDim]) * inStrides[innerDim];
+        const auto outBeginInd = line * innerSize + innerBegin;
+
+        VPUX_THROW_UNLESS(checked_cast<size_t>(outBeginInd + innerEnd - innerBegin) * elemByteSize <= outBuf.size(),
+                          "Out-of-bound access in 'applyIndexRemappingChain'");
+
+        if (inStrides[innerDim] == 1) {
+            std::copy_n(inBuf.data() + checked_cast<size_t>(inBeginInd) * elemByteSize,
+                        checked_cast<size_t>(innerEnd - innerBegin) * elemByteSize,
+                        outBuf.data() + checked_cast<size_t>(outBeginInd) * elemByteSize);
+            return;
+        }
+
+        for (auto i : irange(innerEnd - innerBegin)) {
+            const auto inInd = checked_cast<size_t>(inBeginInd + i * inStrides[innerDim]);
+            const auto outInd = checked_cast<size_t>(outBeginInd + i);
+
+            std::copy_n(inBuf.data() + inInd * elemByteSize, elemByteSize, outBuf.data() + outInd * elemByteSize);
+        }
+    });
+
+    return output;
+}
+
+}  // namespace
+
+//
+// applyTransformations
+//
+
+Const::Content Const::details::applyTransformations(Const::Content& input,
+                                                    ArrayRef<Const::TransformAttrInterface> transformations) {
+    auto res = Const::Content::moveBuffer(input.getType(), std::move(input));
+
+    while (!transformations.empty()) {
+        const auto elemWiseLength = getElementWiseChainLength(res, transformations);
+        if (elemWiseLength != 0) {
+            res = applyElementWiseChain(res, transformations.take_front(elemWiseLength));
+            transformations = transformations.drop_front(elemWiseLength);
+            continue;
+        }
+
+        const auto indexRemappingLength = getIndexRemappingChainLength(res, transformations);
+        if (indexRemappingLength != 0) {
+            res = applyIndexRemappingChain(res, transformations.take_front(indexRemappingLength));
+            transformations = transformations.drop_front(indexRemappingLength);
+            continue;
+        }
+
+        res = transformations.front().transform(res);
+        transformations = transformations.drop_front();
+    }
+
+    return res;
+}
@@ -97,7 +97,7 @@ void vpux::buildReferenceSWModePipeline(mlir::OpPassManager& pm, const Reference
 
     IERT::buildAsyncSchedulingPipeline(pm, log);
 
-    pm.addPass(IERT::createStaticAllocationPass(getMemKind<VPU::MemoryKind::DDR>, log));
+    pm.addPass(IERT::createStaticAllocationPass(getMemKind<VPU::MemoryKind::DDR>, options.enableOfflinePacking, log));
     pm.addPass(IERT::createLinearizationPass(log));
     pm.addPass(IERT::createOptimizeAsyncDepsPass(log));
 
@@ -226,8 +226,9 @@ void vpux::buildReferenceHWModePipeline(mlir::OpPassManager& pm, const Reference
         pm.addPass(IERT::createDMATaskProfilingPass(getMemKind<VPU::MemoryKind::CMX_NN>, log));
     }
 
-    pm.addPass(IERT::createStaticAllocationPass(getMemKind<VPU::MemoryKind::CMX_NN>, log));
-    pm.addPass(IERT::createStaticAllocationPass(getMemKind<VPU::MemoryKind::DDR>, log));
+    // Offline packing is meant for the DDR scratch area, CMX keeps the linear scan
+    pm.addPass(IERT::createStaticAllocationPass(getMemKind<VPU::MemoryKind::CMX_NN>, /*offlinePacking*/ false, log));
+    pm.addPass(IERT::createStaticAllocationPass(getMemKind<VPU::MemoryKind::DDR>, options.enableOfflinePacking, log));
     pm.addPass(IERT::createLinearizationPass(log));
     pm.addPass(IERT::createOptimizeAsyncDepsPass(log));
 
@@ -324,7 +325,8 @@ void vpux::buildDefaultHWModePipeline(mlir::OpPassManager& pm, const DefaultHWOp
     pm.addPass(mlir::createCanonicalizerPass(grc));
 
     pm.addPass(createConvertIEToVPUNCEPass(log));
-    pm.addPass(VPU::createMultiClusterStrategyAssignmentPass(log));
+    pm.addPass(VPU::createMultiClusterStrategyAssignmentPass(options.enableStrategyGraphOptimization,
+                                                             options.strategySearchTimeBudget, log));
 
     // manual strategy debug configuration
     bool writeStrategyToJSON = false;
@@ -338,6 +340,9 @@ void vpux::buildDefaultHWModePipeline(mlir::OpPassManager& pm, const DefaultHWOp
     pm.addPass(VPU::createWrapVPUOpsInNCEClusterTilingPass(log));
 
     pm.addPass(IE::createManualTilingPass(log));
+    if (options.enableVerticalFusion) {
+        pm.addPass(IE::createVerticalFusionTilingPass(log));
+    }
     pm.addPass(IE::createPrefetchTilingPass(log));
     pm.addPass(mlir::createCanonicalizerPass(grc));
 
@@ -352,6 +357,10 @@ void vpux::buildDefaultHWModePipeline(mlir::OpPassManager& pm, const DefaultHWOp
 
     pm.addPass(VPU::createSplitNCEOpsOntoWorkloadsPass(log));
 
+    if (options.enableEstimateWeightsSparsity) {
+        pm.addPass(VPU::createEstimateWeightsSparsityPass(options.weightsSparsityThreshold, log));
+    }
+
     // Lowering
 
     buildLowerIE2IERTPipeline(pm, log);
@@ -392,7 +401,7 @@ void vpux::buildDefaultHWModePipeline(mlir::OpPassManager& pm, const DefaultHWOp
         pm.addPass(IERT::createGroupAsyncExecuteOpsPass(log));
     }
 
-    pm.addPass(IERT::createStaticAllocationPass(getMemKind<VPU::MemoryKind::DDR>, log));
+    pm.addPass(IERT::createStaticAllocationPass(getMemKind<VPU::MemoryKind::DDR>, options.enableOfflinePacking, log));
     pm.addPass(IERT::createOptimizeAsyncDepsPass(log));
 
     pm.addPass(IERT::createBreakDataFlowPass(log));
@@ -0,0 +1,211 @@
+//
+// Copyright (C) 2022 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+//
+
+#include "vpux/compiler/utils/offline_packing.hpp"
+
+#include "vpux/utils/core/error.hpp"
+#include "vpux/utils/core/numeric.hpp"
+#include "vpux/utils/core/range.hpp"
+
+#include <llvm/ADT/STLExtras.h>
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+using namespace vpux;
+
+namespace {
+
+using AddressRange = std::pair<AddressType, AddressType>;
+
+bool interferes(const PackingBuffer& first, const PackingBuffer& second) {
+    return first.firstUse <= second.lastUse && second.firstUse <= first.lastUse;
+}
+
+uint64_t getPackingPriority(const PackingBuffer& buf) {
+    return buf.size * (buf.lastUse - buf.firstUse + 1);
+}
+
+// Finds the smallest gap between the occupied ranges, which fits the buffer.
+// If there is none, the buffer goes right above the occupied ranges.
+AddressType getBestFitAddress(const PackingBuffer& buf, SmallVector<AddressRange>& occupied) {
+    llvm::sort(occupied);
+
+    auto bestAddr = InvalidAddress;
+    auto bestGapSize = std::numeric_limits<AddressType>::max();
+
+    AddressType gapBegin = 0;
+    for (const auto& range : occupied) {
+        if (range.first > gapBegin) {
+            const auto addr = alignVal(gapBegin, buf.alignment);
+            const auto gapSize = range.first - gapBegin;
+
+            if (addr + buf.size <= range.first && gapSize < bestGapSize) {
+                bestAddr = addr;
+                bestGapSize = gapSize;
+            }
+        }
+
+        gapBegin = std::max(gapBegin, range.second);
+    }
+
+    if (bestAddr != InvalidAddress) {
+        return bestAddr;
+    }
+
+    return alignVal(gapBegin, buf.alignment);
+}
+
+}  // namespace
+
+//
+// getPackingLowerBound
+//
+
+AddressType vpux::getPackingLowerBound(ArrayRef<PackingBuffer> buffers) {
+    struct Event final {
+        size_t time;
+        bool isEnd;
+        AddressType size;
+    };
+
+    SmallVector<Event> events;
+    events.reserve(2 * buffers.size());
+
+    AddressType fixedEnd = 0;
+    for (const auto& buf : buffers) {
+        VPUX_THROW_UNLESS(buf.firstUse <= buf.lastUse, "Buffer live range [{0}, {1}] is empty", buf.firstUse,
+                          buf.lastUse);
+
+        events.push_back({buf.firstUse, false, buf.size});
+        events.push_back({buf.lastUse + 1, true, buf.size});
+
+        if (buf.fixedAddress != InvalidAddress) {
+            fixedEnd = std::max(fixedEnd, buf.fixedAddress + buf.size);
+        }
+    }
+
+    // The buffers dying at the time step are released before the new ones are taken
+    llvm::sort(events, [](const Event& lhs, const Event& rhs) {
+        return std::make_pair(lhs.time, !lhs.isEnd) < std::make_pair(rhs.time, !rhs.isEnd);
+    });
+
+    AddressType liveSize = 0;
+    AddressType peakLiveSize = 0;
+    for (const auto& event : events) {
+        if (event.isEnd) {
+            liveSize -= event.size;
+        } else {
+            liveSize += event.size;
+            peakLiveSize = std::max(peakLiveSize, liveSize);
+        }
+    }
+
+    return std::max(peakLiveSize, fixedEnd);
+}
+
+//
+// packBuffers
+//
+
+namespace {
+
+// Places the buffers in the given order, each one into the best fitting gap among the interfering placed ones
+SmallVector<AddressType> placeBuffers(ArrayRef<PackingBuffer> buffers, ArrayRef<size_t> order) {
+    SmallVector<AddressType> addresses(buffers.size(), InvalidAddress);
+
+    SmallVector<size_t> placed;
+    placed.reserve(buffers.size());
+
+    for (auto ind : irange(buffers.size())) {
+        if (buffers[ind].fixedAddress != InvalidAddress) {
+            addresses[ind] = buffers[ind].fixedAddress;
+            placed.push_back(ind);
+        }
+    }
+
+    SmallVector<AddressRange> occupied;
+    for (auto ind : order) {
+        const auto& buf = buffers[ind];
+
+        occupied.clear();
+        for (auto placedInd : placed) {
+            if (interferes(buf, buffers[placedInd])) {
+                const auto addr = addresses[placedInd];
+                occupied.push_back({addr, addr + buffers[placedInd].size});
+            }
+        }
+
+        addresses[ind] = getBestFitAddress(buf, occupied);
+        placed.push_back(ind);
+    }
+
+    return addresses;
+}
+
+AddressType getFootprint(ArrayRef<PackingBuffer> buffers, ArrayRef<AddressType> addresses) {
+    AddressType footprint = 0;
+    for (auto ind : irange(buffers.size())) {
+        const auto endAddr = alignVal(addresses[ind] + buffers[ind].size, buffers[ind].alignment);
+        footprint = std::max(footprint, endAddr);
+    }
+    return footprint;
+}
+
+}  // namespace
+
+PackingResult vpux::packBuffers(ArrayRef<PackingBuffer> buffers) {
+    PackingResult result;
+    result.lowerBound = getPackingLowerBound(buffers);
+    result.footprint = std::numeric_limits<AddressType>::max();
+
+    SmallVector<size_t> order;
+    order.reserve(buffers.size());
+    for (auto ind : irange(buffers.size())) {
+        if (buffers[ind].fixedAddress == InvalidAddress) {
+            order.push_back(ind);
+        }
+    }
+
+    // Large long living buffers first, they are the hardest to fit once the space gets fragmented.
+    // Neither size x lifetime nor size alone wins on every network, so both orders are tried.
+    // The stable sort keeps the placement deterministic for equal priorities.
+    using PriorityFunc = uint64_t (*)(const PackingBuffer&);
+    const PriorityFunc priorities[] = {
+            getPackingPriority,
+            [](const PackingBuffer& buf) -> uint64_t {
+                return buf.size;
+            },
+    };
+
+    for (auto priority : priorities) {
+        std::stable_sort(order.begin(), order.end(), [&](size_t lhs, size_t rhs) {
+            const auto lhsPriority = priority(buffers[lhs]);
+            const auto rhsPriority = priority(buffers[rhs]);
+            if (lhsPriority != rhsPriority) {
+                return lhsPriority > rhsPriority;
+            }
+            return std::make_pair(buffers[lhs].size, buffers[rhs].firstUse) >
+                   std::make_pair(buffers[rhs].size, buffers[lhs].firstUse);
+        });
+
+        auto addresses = placeBuffers(buffers, order);
+        const auto footprint = getFootprint(buffers, addresses);
+
+        if (footprint < result.footprint) {
+            result.addresses = std::move(addresses);
+            result.footprint = footprint;
+        }
+
+        if (result.footprint == result.lowerBound) {
+            break;
+        }
+    }
+
+    return result;
+}
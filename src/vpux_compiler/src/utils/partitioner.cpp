@@ -11,8 +11,8 @@
 #include "vpux/utils/core/numeric.hpp"
 
 #include <algorithm>
+#include <iterator>
 #include <limits>
-#include <numeric>
 #include <vector>
 
 #include <cassert>
@@ -33,7 +33,9 @@ public:
 
     void validate() const {
 #ifndef NDEBUG
-        const auto& gaps = _p.gaps();
+        const auto gaps = _p.gaps();
+        AddressType totalFreeSize = 0;
+        AddressType maxFreeSize = 0;
         for (size_t i = 0; i < gaps.size(); ++i) {
             auto& g = gaps[i];
 
@@ -44,7 +46,14 @@ public:
             if (i != 0) {
                 assert(g.begin >= gaps[i - 1].end);
             }
+
+            totalFreeSize += g.size();
+            maxFreeSize = std::max(maxFreeSize, g.size());
         }
+
+        // The size ordered index and the counters must describe the same gaps
+        assert(totalFreeSize == _p.totalFreeSize());
+        assert(maxFreeSize == _p.maxFreeSize());
 #endif
     }
 
@@ -67,7 +76,7 @@ private:
 
 vpux::Partitioner::Partitioner(AddressType totalSize): _totalSize(totalSize) {
     assert(_totalSize > 0);
-    _gaps.push_back({0, _totalSize});
+    addGap(0, _totalSize);
 }
 
 AddressType vpux::Partitioner::alloc(AddressType size, AddressType alignment, Direction dir) {
@@ -83,47 +92,19 @@ void vpux::Partitioner::allocFixed(AddressType addr, AddressType size) {
     assert(addr != InvalidAddress);
     assert(size > 0);
     assert(addr + size <= _totalSize);
-    assert(!_gaps.empty());
+    assert(!_gapsByAddr.empty());
 
     const PartitionerValidator v(*this);
 
-    auto it = std::lower_bound(_gaps.begin(), _gaps.end(), Gap{addr, 0}, [](const Gap& g1, const Gap& g2) {
-        return g1.begin < g2.begin;
-    });
-
-    const bool hasEq = (it != _gaps.end() && it->begin == addr);
-
-    if (hasEq) {
-        auto& elem = *it;
-        assert(elem.size() >= size);  // client is aware of this demand
-
-        if (elem.size() == size) {
-            _gaps.erase(it);
-        } else {
-            elem.begin += size;
-        }
-    } else {
-        assert(it != _gaps.begin());
-        --it;
+    // The last gap starting at or before the address
+    auto gapIt = _gapsByAddr.upper_bound(addr);
+    assert(gapIt != _gapsByAddr.begin());  // client is aware of this demand
+    --gapIt;
 
-        auto& elem = *it;
-        const auto end = addr + size;
+    assert(gapIt->first <= addr);
+    assert(gapIt->second >= addr + size);
 
-        assert(elem.begin < addr);
-        assert(elem.end >= end);
-
-        if (elem.end == end) {
-            elem.end = addr;
-        } else {
-            assert(elem.end >= end);
-
-            const auto tailSize = elem.end - end;
-            assert(tailSize > 0);
-
-            elem.end = addr;
-            _gaps.insert(it + 1, Gap{end, end + tailSize});
-        }
-    }
+    useGap(gapIt, addr, size);
 }
 
 void vpux::Partitioner::free(AddressType addr, AddressType size) {
@@ -134,88 +115,62 @@ void vpux::Partitioner::free(AddressType addr, AddressType size) {
 
     v.checkNewGap(addr, size);
 
-    const auto end = addr + size;
-    if (_gaps.empty()) {
-        _gaps.push_back(Gap{addr, end});
-        return;
-    }
+    auto begin = addr;
+    auto end = addr + size;
 
-    const auto prepend = [](Gap& gap, AddressType addr, AddressType size) {
-        VPUX_UNUSED(addr);
-
-        assert((addr + size) == gap.begin);
-        assert(gap.begin >= size);
-
-        gap.begin -= size;
-    };
-    const auto append = [](Gap& gap, AddressType addr, AddressType size) {
-        VPUX_UNUSED(addr);
-
-        assert(addr == gap.end);
-
-        gap.end += size;
-    };
+    // Coalesce with the adjacent gaps
+    auto nextIt = _gapsByAddr.lower_bound(addr);
+    if (nextIt != _gapsByAddr.begin()) {
+        const auto prevIt = std::prev(nextIt);
+        assert(prevIt->second <= addr);
 
-    auto& firstGap = _gaps.front();
-    if (end == firstGap.begin) {
-        prepend(firstGap, addr, size);
-        return;
-    } else if (end < firstGap.begin) {
-        _gaps.insert(_gaps.begin(), Gap{addr, end});
-        return;
+        if (prevIt->second == addr) {
+            begin = prevIt->first;
+            removeGap(prevIt);
+        }
     }
+    if (nextIt != _gapsByAddr.end()) {
+        assert(nextIt->first >= end);
 
-    for (size_t i = 0; i < _gaps.size() - 1; ++i) {
-        auto& gap = _gaps[i];
-        auto& nextGap = _gaps[i + 1];
-
-        if (addr >= gap.end) {
-            if (end <= nextGap.begin) {
-                if (addr == gap.end) {
-                    if (end == nextGap.begin) {
-                        append(gap, addr, size + nextGap.size());
-                        _gaps.erase(_gaps.begin() + static_cast<ptrdiff_t>(i + 1));
-                    } else {
-                        append(gap, addr, size);
-                    }
-                } else if (end == nextGap.begin) {
-                    prepend(nextGap, addr, size);
-                } else {
-                    _gaps.insert(_gaps.begin() + static_cast<ptrdiff_t>(i + 1), Gap{addr, end});
-                }
-
-                return;
-            }
+        if (nextIt->first == end) {
+            end = nextIt->second;
+            removeGap(nextIt);
         }
     }
 
-    auto& lastGap = _gaps.back();
-    if (end < lastGap.begin) {
-        _gaps.insert(_gaps.begin() + static_cast<ptrdiff_t>(_gaps.size() - 1), Gap{addr, end});
-    } else if (end == lastGap.begin) {
-        prepend(lastGap, addr, size);
-    } else if (addr == lastGap.end) {
-        append(lastGap, addr, size);
-    } else {
-        _gaps.push_back(Gap{addr, end});
-    }
+    addGap(begin, end);
 }
 
-AddressType vpux::Partitioner::totalFreeSize() const {
-    return std::accumulate(_gaps.begin(), _gaps.end(), AddressType{0}, [](AddressType res, const Gap& g) {
-        return res + g.size();
-    });
+AddressType vpux::Partitioner::maxFreeSize() const {
+    return _gapsBySize.empty() ? 0 : _gapsBySize.rbegin()->first;
 }
 
-AddressType vpux::Partitioner::maxFreeSize() const {
-    return std::accumulate(_gaps.begin(), _gaps.end(), AddressType{0}, [](AddressType res, const Gap& g) {
-        return std::max(res, g.size());
-    });
+std::vector<Partitioner::Gap> vpux::Partitioner::gaps() const {
+    std::vector<Gap> gaps;
+    gaps.reserve(_gapsByAddr.size());
+    for (const auto& gap : _gapsByAddr) {
+        gaps.push_back(Gap{gap.first, gap.second});
+    }
+    return gaps;
 }
 
-AddressType vpux::Partitioner::getAddrFromGap(size_t pos, AddressType size, AddressType alignment, Direction dir) {
-    const auto& g = _gaps[pos];
+void vpux::Partitioner::addGap(AddressType begin, AddressType end) {
+    assert(end > begin);
+
+    _gapsByAddr.emplace(begin, end);
+    _gapsBySize.emplace(end - begin, begin);
+    _totalFreeSize += end - begin;
+}
+
+Partitioner::GapsByAddr::iterator vpux::Partitioner::removeGap(GapsByAddr::iterator gapIt) {
+    const auto size = gapIt->second - gapIt->first;
+
+    _gapsBySize.erase({size, gapIt->first});
+    _totalFreeSize -= size;
+    return _gapsByAddr.erase(gapIt);
+}
 
+AddressType vpux::Partitioner::getAddrFromGap(const Gap& g, AddressType size, AddressType alignment, Direction dir) {
     if (g.size() < size) {
         return InvalidAddress;
     }
@@ -247,82 +202,79 @@ AddressType vpux::Partitioner::getAddrFromGap(size_t pos, AddressType size, Addr
     }
 }
 
-AddressType vpux::Partitioner::useGap(size_t pos, AddressType alignedBegin, AddressType size) {
-    auto& g = _gaps[pos];
+AddressType vpux::Partitioner::useGap(GapsByAddr::iterator gapIt, AddressType alignedBegin, AddressType size) {
+    const Gap g{gapIt->first, gapIt->second};
 
     assert(alignedBegin >= g.begin);
     assert(alignedBegin + size <= g.end);
 
-    const auto newGapLeft = alignedBegin - g.begin;
-    const auto newGapRight = g.end - (alignedBegin + size);
+    removeGap(gapIt);
 
-    if (newGapLeft == 0 && newGapRight == 0) {
-        _gaps.erase(_gaps.begin() + static_cast<ptrdiff_t>(pos));
-    } else if (newGapLeft > 0 && newGapRight == 0) {
-        g.end = alignedBegin;
-    } else if (newGapLeft == 0 && newGapRight > 0) {
-        g.begin = alignedBegin + size;
-    } else {
-        const auto origBegin = g.begin;
-        g.begin = alignedBegin + size;
-        _gaps.insert(_gaps.begin() + static_cast<ptrdiff_t>(pos), Gap{origBegin, alignedBegin});
+    if (alignedBegin > g.begin) {
+        addGap(g.begin, alignedBegin);
+    }
+    if (alignedBegin + size < g.end) {
+        addGap(alignedBegin + size, g.end);
     }
 
     return alignedBegin;
 }
 
 AddressType vpux::Partitioner::chooseMinimalGap(AddressType size, AddressType alignment, Direction dir) {
-    if (_gaps.empty()) {
+    if (_gapsByAddr.empty()) {
         return InvalidAddress;
     }
 
-    const auto numGaps = _gaps.size();
-
-    int minGapInd = -1;
-    auto minGapSize = std::numeric_limits<AddressType>::max();
-
     // The last gap in current direction has the lowest priority,
     // it is checked only if there is no other suitable gap.
+    const auto lastGapIt = dir == Direction::Up ? std::prev(_gapsByAddr.end()) : _gapsByAddr.begin();
+
+    // The smallest suitable gap is chosen, among the gaps of equal size the first one in current direction.
+    // The gaps are visited in the order of size and address, the gaps of the same size are visited in
+    // current direction. Every gap of at least (size + alignment - 1) bytes is suitable, so only the gaps
+    // rejected due to the alignment are skipped before the result is found.
+    const auto tryGap = [&](AddressType gapBegin) {
+        if (gapBegin == lastGapIt->first) {
+            return InvalidAddress;
+        }
 
-    if (dir == Direction::Up) {
-        for (size_t i = 0; i < numGaps - 1; ++i) {
-            const auto alignedBegin = getAddrFromGap(i, size, alignment, dir);
-            if (alignedBegin != InvalidAddress) {
-                if (_gaps[i].size() < minGapSize) {
-                    minGapInd = static_cast<int>(i);
-                    minGapSize = _gaps[i].size();
-                }
-            }
+        const auto gapIt = _gapsByAddr.find(gapBegin);
+        assert(gapIt != _gapsByAddr.end());
+
+        const auto alignedBegin = getAddrFromGap(Gap{gapIt->first, gapIt->second}, size, alignment, dir);
+        if (alignedBegin == InvalidAddress) {
+            return InvalidAddress;
         }
 
-        if (minGapInd == -1) {
-            const auto alignedBegin = getAddrFromGap(numGaps - 1, size, alignment, dir);
-            if (alignedBegin != InvalidAddress) {
-                minGapInd = static_cast<int>(numGaps - 1);
+        return useGap(gapIt, alignedBegin, size);
+    };
+
+    auto sizeGroupBegin = _gapsBySize.lower_bound({size, 0});
+    while (sizeGroupBegin != _gapsBySize.end()) {
+        const auto sizeGroupEnd = _gapsBySize.upper_bound({sizeGroupBegin->first, InvalidAddress});
+
+        if (dir == Direction::Up) {
+            for (auto it = sizeGroupBegin; it != sizeGroupEnd; ++it) {
+                const auto addr = tryGap(it->second);
+                if (addr != InvalidAddress) {
+                    return addr;
+                }
             }
-        }
-    } else {
-        for (size_t i = numGaps - 1; i >= 1; --i) {
-            const auto alignedBegin = getAddrFromGap(i, size, alignment, dir);
-            if (alignedBegin != InvalidAddress) {
-                if (_gaps[i].size() < minGapSize) {
-                    minGapInd = static_cast<int>(i);
-                    minGapSize = _gaps[i].size();
+        } else {
+            for (auto it = sizeGroupEnd; it != sizeGroupBegin;) {
+                const auto addr = tryGap((--it)->second);
+                if (addr != InvalidAddress) {
+                    return addr;
                 }
             }
         }
 
-        if (minGapInd == -1) {
-            const auto alignedBegin = getAddrFromGap(0, size, alignment, dir);
-            if (alignedBegin != InvalidAddress) {
-                minGapInd = 0;
-            }
-        }
+        sizeGroupBegin = sizeGroupEnd;
     }
 
-    if (minGapInd != -1) {
-        const auto alignedBegin = getAddrFromGap(static_cast<size_t>(minGapInd), size, alignment, dir);
-        return useGap(static_cast<size_t>(minGapInd), alignedBegin, size);
+    const auto alignedBegin = getAddrFromGap(Gap{lastGapIt->first, lastGapIt->second}, size, alignment, dir);
+    if (alignedBegin != InvalidAddress) {
+        return useGap(lastGapIt, alignedBegin, size);
     }
 
     return InvalidAddress;
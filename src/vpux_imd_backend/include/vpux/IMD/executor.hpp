@@ -12,6 +12,7 @@
 #include "vpux/utils/core/string_ref.hpp"
 #include "vpux_private_config.hpp"
 
+#include <memory>
 #include <string>
 
 namespace vpux {
@@ -46,13 +47,34 @@ private:
         int64_t timeoutSec;
         std::string chipsetArg;
         std::string imdElfArg;
+        bool sessionMode;
+    };
+
+    // Temporary working directory, removed together with its content on destruction
+    class WorkDir final {
+    public:
+        explicit WorkDir(Logger log);
+        ~WorkDir();
+
+        WorkDir(const WorkDir&) = delete;
+        WorkDir& operator=(const WorkDir&) = delete;
+
+    public:
+        StringRef path() const {
+            return _path.str();
+        }
+
+    private:
+        Logger _log;
+        SmallString _path;
     };
 
     void parseAppConfig(InferenceEngine::VPUXConfigParams::VPUXPlatform platform, const Config& config);
 
-    SmallString createTempWorkDir();
+    std::shared_ptr<WorkDir> getSessionWorkDir();
     void storeNetworkBlob(StringRef workDir);
     void storeNetworkInputs(StringRef workDir, const InferenceEngine::BlobMap& inputs);
+    void removeNetworkOutputs(StringRef workDir, const InferenceEngine::BlobMap& outputs);
     void runApp(StringRef workDir);
     void loadNetworkOutputs(StringRef workDir, const InferenceEngine::BlobMap& outputs);
 
@@ -63,6 +85,9 @@ private:
     InferenceManagerDemo _app;
 
     InferenceEngine::BlobMap _inputs;
+
+    // Working directory with the stored network blob, reused by all inferences in session mode
+    std::shared_ptr<WorkDir> _sessionWorkDir;
 };
 
 }  // namespace IMD
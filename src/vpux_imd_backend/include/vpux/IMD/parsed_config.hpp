@@ -90,5 +90,31 @@ struct MV_RUN_TIMEOUT final : OptionBase<MV_RUN_TIMEOUT, std::chrono::seconds> {
     }
 };
 
+//
+// SESSION_MODE
+//
+
+struct SESSION_MODE final : OptionBase<SESSION_MODE, bool> {
+    static StringRef key() {
+        return VPUX_IMD_CONFIG_KEY(SESSION_MODE);
+    }
+
+    static StringRef envVar() {
+        return "IE_VPUX_IMD_SESSION_MODE";
+    }
+
+    static bool defaultValue() {
+        return false;
+    }
+
+    static bool isPublic() {
+        return false;
+    }
+
+    static OptionMode mode() {
+        return OptionMode::RunTime;
+    }
+};
+
 }  // namespace IMD
 }  // namespace vpux
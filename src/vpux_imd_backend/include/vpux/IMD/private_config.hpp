@@ -26,5 +26,8 @@ DECLARE_VPUX_IMD_CONFIG_KEY(LAUNCH_MODE);
 DECLARE_VPUX_IMD_CONFIG_VALUE(MOVI_SIM);
 DECLARE_VPUX_IMD_CONFIG_KEY(MV_RUN_TIMEOUT);
 
+// Keep the working directory and the network blob between inferences of the same executor
+DECLARE_VPUX_IMD_CONFIG_KEY(SESSION_MODE);
+
 }  // namespace VPUXConfigParams
 }  // namespace InferenceEngine
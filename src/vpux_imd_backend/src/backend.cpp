@@ -40,6 +40,7 @@ void vpux::IMD::BackendImpl::registerOptions(OptionsDesc& options) const {
     options.add<IMD::MV_TOOLS_PATH>();
     options.add<IMD::LAUNCH_MODE>();
     options.add<IMD::MV_RUN_TIMEOUT>();
+    options.add<IMD::SESSION_MODE>();
 }
 
 INFERENCE_PLUGIN_API(void) CreateVPUXEngineBackend(std::shared_ptr<vpux::IEngineBackend>& obj) {
@@ -84,22 +84,46 @@ void vpux::IMD::ExecutorImpl::parseAppConfig(VPUXPlatform platform, const Config
     }
 
     _app.timeoutSec = config.get<IMD::MV_RUN_TIMEOUT>().count();
+    _app.sessionMode = config.get<IMD::SESSION_MODE>();
 }
 
 //
-// createTempWorkDir
+// WorkDir
 //
 
-SmallString vpux::IMD::ExecutorImpl::createTempWorkDir() {
+vpux::IMD::ExecutorImpl::WorkDir::WorkDir(Logger log): _log(log) {
     _log.trace("Create unique temporary working directory...");
 
-    SmallString workDir;
-    const auto errc = llvm::sys::fs::createUniqueDirectory("vpux-IMD", workDir);
+    const auto errc = llvm::sys::fs::createUniqueDirectory("vpux-IMD", _path);
     VPUX_THROW_WHEN(errc, "Failed to create temporary working directory : {0}", errc.message());
 
-    _log.nest().trace("{0}", workDir);
+    _log.nest().trace("{0}", _path);
+}
+
+vpux::IMD::ExecutorImpl::WorkDir::~WorkDir() {
+    _log.trace("Remove the temporary working directory '{0}'...", _path);
+    const auto errc = llvm::sys::fs::remove_directories(_path);
 
-    return workDir;
+    if (errc) {
+        _log.error("Failed to remove temporary working directory : {0}", errc.message());
+    }
+}
+
+//
+// getSessionWorkDir
+//
+
+std::shared_ptr<IMD::ExecutorImpl::WorkDir> vpux::IMD::ExecutorImpl::getSessionWorkDir() {
+    if (_sessionWorkDir == nullptr) {
+        _log.trace("Start new session...");
+
+        // The network blob doesn't change between inferences, store it only once per session
+        auto workDir = std::make_shared<WorkDir>(_log.nest());
+        storeNetworkBlob(workDir->path());
+        _sessionWorkDir = std::move(workDir);
+    }
+
+    return _sessionWorkDir;
 }
 
 //
@@ -109,12 +133,10 @@ SmallString vpux::IMD::ExecutorImpl::createTempWorkDir() {
 void vpux::IMD::ExecutorImpl::storeNetworkBlob(StringRef workDir) {
     _log.trace("Store the network blob...");
 
-    const auto& compiledBlob = _network->getCompiledNetwork();
-
     const auto modelFilePath = printToString("{0}/test.blob", workDir);
     std::ofstream file(modelFilePath, std::ios::binary);
     VPUX_THROW_UNLESS(file.is_open(), "Can't open file '{0}' for write", modelFilePath);
-    file.write(compiledBlob.data(), compiledBlob.size());
+    file.write(static_cast<const char*>(_network->getNetworkModel()), _network->getNetworkModelSize());
 
     _log.nest().trace("{0}", modelFilePath);
 }
@@ -152,6 +174,20 @@ void vpux::IMD::ExecutorImpl::storeNetworkInputs(StringRef workDir, const BlobMa
     }
 }
 
+//
+// removeNetworkOutputs
+//
+
+void vpux::IMD::ExecutorImpl::removeNetworkOutputs(StringRef workDir, const BlobMap& outputs) {
+    _log.trace("Remove the network outputs of the previous inference...");
+
+    for (auto ind : irange(outputs.size())) {
+        const auto outputFilePath = printToString("{0}/output-{1}.bin", workDir, ind);
+        const auto errc = llvm::sys::fs::remove(outputFilePath);
+        VPUX_THROW_WHEN(errc, "Failed to remove file '{0}' : {1}", outputFilePath, errc.message());
+    }
+}
+
 //
 // runApp
 //
@@ -159,27 +195,19 @@ void vpux::IMD::ExecutorImpl::storeNetworkInputs(StringRef workDir, const BlobMa
 void vpux::IMD::ExecutorImpl::runApp(StringRef workDir) {
     _log.trace("Run the application...");
 
-    SmallString curPath;
-    auto errc = llvm::sys::fs::current_path(curPath);
-    VPUX_THROW_WHEN(errc, "Failed to get current path : {0}", errc.message());
+    // The application works with the files in its current directory. Launch it through the shell, which changes
+    // the directory for the child process only, so the plugin process and parallel inferences are not affected.
+    const auto shell = llvm::sys::findProgramByName("sh");
+    VPUX_THROW_UNLESS(shell, "Failed to locate shell : {0}", shell.getError().message());
 
-    VPUX_SCOPE_EXIT {
-        _log.nest().trace("Restore current working directory '{0}'...", curPath);
-        errc = llvm::sys::fs::set_current_path(curPath);
-
-        if (errc) {
-            _log.error("Failed to restore current path : {0}", errc.message());
-        }
-    };
-
-    _log.nest().trace("Change current working directory to the new temporary folder '{0}'...", workDir);
-    errc = llvm::sys::fs::set_current_path(workDir);
-    VPUX_THROW_WHEN(errc, "Failed to change current path : {0}", errc.message());
+    SmallVector<StringRef> runArgs = {shell.get(), "-c", "cd \"$0\" && exec \"$@\"", workDir};
+    runArgs.append(_app.runArgs.begin(), _app.runArgs.end());
 
+    _log.nest().trace("Working directory '{0}'", workDir);
     _log.nest().trace("{0}", _app.runArgs);
 
     std::string errMsg;
-    const auto procErr = llvm::sys::ExecuteAndWait(_app.runProgram, makeArrayRef(_app.runArgs), /*Env=*/None,
+    const auto procErr = llvm::sys::ExecuteAndWait(shell.get(), makeArrayRef(runArgs), /*Env=*/None,
                                                    /*Redirects=*/{}, checked_cast<uint32_t>(_app.timeoutSec),
                                                    /*MemoryLimit=*/0, &errMsg);
     VPUX_THROW_WHEN(procErr != 0, "Failed to run InferenceManagerDemo : {0}", errMsg);
@@ -242,7 +270,10 @@ void vpux::IMD::ExecutorImpl::setup(const ParamMap&) {
 }
 
 Executor::Ptr vpux::IMD::ExecutorImpl::clone() const {
-    return std::make_shared<IMD::ExecutorImpl>(*this);
+    auto executor = std::make_shared<IMD::ExecutorImpl>(*this);
+    // Clones might run inferences in parallel, each of them has to work in its own session directory
+    executor->_sessionWorkDir.reset();
+    return executor;
 }
 
 void vpux::IMD::ExecutorImpl::push(const BlobMap& inputs) {
@@ -261,20 +292,20 @@ void vpux::IMD::ExecutorImpl::pull(BlobMap& outputs) {
         _log = _log.unnest();
     };
 
-    const auto workDir = createTempWorkDir();
-    VPUX_SCOPE_EXIT {
-        _log.trace("Remove the temporary working directory '{0}'...", workDir);
-        const auto errc = llvm::sys::fs::remove_directories(workDir);
+    std::shared_ptr<WorkDir> workDir;
 
-        if (errc) {
-            _log.error("Failed to remove temporary working directory : {0}", errc.message());
-        }
-    };
+    if (_app.sessionMode) {
+        workDir = getSessionWorkDir();
+        // Stale outputs must not be read back if the application fails to produce the new ones
+        removeNetworkOutputs(workDir->path(), outputs);
+    } else {
+        workDir = std::make_shared<WorkDir>(_log);
+        storeNetworkBlob(workDir->path());
+    }
 
-    storeNetworkBlob(workDir.str());
-    storeNetworkInputs(workDir.str(), _inputs);
-    runApp(workDir.str());
-    loadNetworkOutputs(workDir.str(), outputs);
+    storeNetworkInputs(workDir->path(), _inputs);
+    runApp(workDir->path());
+    loadNetworkOutputs(workDir->path(), outputs);
 }
 
 bool vpux::IMD::ExecutorImpl::isPreProcessingSupported(const PreprocMap&) const {
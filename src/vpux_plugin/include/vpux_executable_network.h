@@ -47,6 +47,14 @@ public:
      */
     explicit ExecutableNetwork(std::istream& networkModel, const Device::Ptr& device, const Config& config);
 
+    /**
+     * @brief Executable network constructor, imports network from memory-mapped file
+     * @param networkModel read-only mapping of the compiled network, shared with the network description
+     * @param device pointer to device object
+     * @param config config object connecting configuration with which network is imported
+     */
+    explicit ExecutableNetwork(const MappedBlob::Ptr& networkModel, const Device::Ptr& device, const Config& config);
+
     InferenceEngine::IInferRequestInternal::Ptr CreateInferRequestImpl(
             const InferenceEngine::InputsDataMap networkInputs,
             const InferenceEngine::OutputsDataMap networkOutputs) override;
@@ -68,6 +76,7 @@ private:
                                  const Device::Ptr& device);
 
 private:
+    void initImported(const std::string& networkName, const Device::Ptr& device);
     void ConfigureStreamsExecutor(const std::string& networkName);
     InferenceEngine::ITaskExecutor::Ptr getNextTaskExecutor();
 
@@ -73,6 +73,9 @@ private:
                                                                     std::shared_ptr<Device>& device,
                                                                     const Config& networkConfig);
 
+    InferenceEngine::IExecutableNetworkInternal::Ptr ImportMappedNetwork(const std::string& modelFileName,
+                                                                         const Config& config);
+
 private:
     std::shared_ptr<OptionsDesc> _options;
     Config _globalConfig;
@@ -115,15 +115,8 @@ ExecutableNetwork::ExecutableNetwork(std::istream& networkModel, const Device::P
                           "ExecutableNetwork::ExecutableNetwork[Import]", "Parse");
         const std::string networkName = "net" + std::to_string(loadBlobCounter);
         _networkPtr = _compiler->parse(networkModel, _config, networkName);
-        OV_ITT_TASK_NEXT(EXECUTABLE_NETWORK_IMPORT, "createExecutor");
-        _executorPtr = createExecutor(_networkPtr, _config, device);
-        OV_ITT_TASK_NEXT(EXECUTABLE_NETWORK_IMPORT, "Init");
-        _networkInputs = helpers::dataMapIntoInputsDataMap(_networkPtr->getInputsInfo());
-        _networkOutputs = helpers::dataMapIntoOutputsDataMap(_networkPtr->getOutputsInfo());
-        setInputs(helpers::ovRawNodesIntoOVNodes(_networkPtr->getOVParameters(), false));
-        setOutputs(helpers::ovRawNodesIntoOVNodes(_networkPtr->getOVResults(), true));
-        ConfigureStreamsExecutor(networkName);
         OV_ITT_TASK_SKIP(EXECUTABLE_NETWORK_IMPORT);
+        initImported(networkName, device);
     } catch (const std::exception& ex) {
         IE_THROW() << ex.what();
     } catch (...) {
@@ -132,6 +125,35 @@ ExecutableNetwork::ExecutableNetwork(std::istream& networkModel, const Device::P
     }
 }
 
+ExecutableNetwork::ExecutableNetwork(const MappedBlob::Ptr& networkModel, const Device::Ptr& device,
+                                     const Config& config)
+        : ExecutableNetwork(config, device) {
+    OV_ITT_SCOPED_TASK(itt::domains::VPUXPlugin, "ExecutableNetwork::ExecutableNetwork[ImportMapped]");
+    try {
+        const std::string networkName = "net" + std::to_string(loadBlobCounter);
+        _networkPtr = _compiler->parse(networkModel, _config, networkName);
+        initImported(networkName, device);
+    } catch (const std::exception& ex) {
+        IE_THROW() << ex.what();
+    } catch (...) {
+        _logger.error("Unexpected exception");
+        IE_THROW() << "VPUX ExecutableNetwork got unexpected exception from compiler";
+    }
+}
+
+void ExecutableNetwork::initImported(const std::string& networkName, const Device::Ptr& device) {
+    OV_ITT_TASK_CHAIN(EXECUTABLE_NETWORK_IMPORT, itt::domains::VPUXPlugin, "ExecutableNetwork::initImported",
+                      "createExecutor");
+    _executorPtr = createExecutor(_networkPtr, _config, device);
+    OV_ITT_TASK_NEXT(EXECUTABLE_NETWORK_IMPORT, "Init");
+    _networkInputs = helpers::dataMapIntoInputsDataMap(_networkPtr->getInputsInfo());
+    _networkOutputs = helpers::dataMapIntoOutputsDataMap(_networkPtr->getOutputsInfo());
+    setInputs(helpers::ovRawNodesIntoOVNodes(_networkPtr->getOVParameters(), false));
+    setOutputs(helpers::ovRawNodesIntoOVNodes(_networkPtr->getOVResults(), true));
+    ConfigureStreamsExecutor(networkName);
+    OV_ITT_TASK_SKIP(EXECUTABLE_NETWORK_IMPORT);
+}
+
 void ExecutableNetwork::ConfigureStreamsExecutor(const std::string& networkName) {
     size_t maxTaskExecutorGetResultCount = 1;
     if (_config.get<EXCLUSIVE_ASYNC_REQUESTS>()) {
@@ -199,20 +221,21 @@ InferenceEngine::IInferRequestInternal::Ptr ExecutableNetwork::CreateInferReques
 //------------------------------------------------------------------------------
 
 namespace {
-std::uint32_t hash(const std::vector<char>& data) {
+std::uint32_t hash(const char* data, std::size_t size) {
     std::uint32_t result = 1171117u;
-    for (const char& c : data)
-        result = ((result << 7) + result) + static_cast<uint32_t>(c);
+    for (const char* c = data; c != data + size; ++c)
+        result = ((result << 7) + result) + static_cast<uint32_t>(*c);
     return result;
 }
 
 }  // namespace
 
 void ExecutableNetwork::Export(std::ostream& model) {
-    auto graphBlob = _networkPtr->getCompiledNetwork();
-    model.write(graphBlob.data(), graphBlob.size());
+    const auto* graphBlob = static_cast<const char*>(_networkPtr->getNetworkModel());
+    const auto graphBlobSize = _networkPtr->getNetworkModelSize();
+    model.write(graphBlob, graphBlobSize);
     std::stringstream str;
-    str << "Blob hash: " << std::hex << hash(graphBlob);
+    str << "Blob hash: " << std::hex << hash(graphBlob, graphBlobSize);
     _logger.info("{0}", str.str());
 }
 
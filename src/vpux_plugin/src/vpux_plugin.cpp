@@ -165,9 +165,30 @@ IE::IExecutableNetworkInternal::Ptr Engine::ImportNetwork(const std::string& mod
     }
 #endif
     OV_ITT_TASK_SKIP(IMPORT_NETWORK);
+    auto localConfig = mergeConfigs(_globalConfig, config, OptionMode::RunTime);
+    if (localConfig.get<IMPORT_BLOB_MMAP>()) {
+        blobStream.close();
+        return ImportMappedNetwork(modelFileName, localConfig);
+    }
     return ImportNetwork(vpu::KmbPlugin::utils::skipMagic(blobStream), config);
 }
 
+IE::IExecutableNetworkInternal::Ptr Engine::ImportMappedNetwork(const std::string& modelFileName,
+                                                                const Config& config) {
+    OV_ITT_SCOPED_TASK(itt::domains::VPUXPlugin, "Engine::ImportMappedNetwork");
+    try {
+        const auto blob = MappedBlob::open(modelFileName);
+        auto device = _backends->getDevice(config.get<DEVICE_ID>());
+        const auto executableNetwork = std::make_shared<ExecutableNetwork>(blob, device, config);
+        executableNetwork->SetPointerToPlugin(shared_from_this());
+        return executableNetwork;
+    } catch (const std::exception&) {
+        throw;
+    } catch (...) {
+        IE_THROW() << "VPUX ImportNetwork got unexpected exception from ExecutableNetwork";
+    }
+}
+
 IE::IExecutableNetworkInternal::Ptr Engine::ImportNetwork(std::istream& networkModel,
                                                           const std::map<std::string, std::string>& config) {
     OV_ITT_SCOPED_TASK(itt::domains::VPUXPlugin, "Engine::ImportNetwork");
@@ -263,6 +284,12 @@ IE::Parameter Engine::GetConfig(const std::string& name,
             return _globalConfig.get<MCM_ELTWISE_SCALES_ALIGNMENT>();
         } else if (name == ov::intel_vpux::executor_streams) {
             return _globalConfig.get<EXECUTOR_STREAMS>();
+        } else if (name == ov::intel_vpux::compilation_cache_dir) {
+            return _globalConfig.get<COMPILATION_CACHE_DIR>();
+        } else if (name == ov::intel_vpux::compilation_cache_size) {
+            return _globalConfig.get<COMPILATION_CACHE_SIZE>();
+        } else if (name == ov::intel_vpux::const_folding_cache_size) {
+            return _globalConfig.get<CONST_FOLDING_CACHE_SIZE>();
         } else if (name == ov::intel_vpux::compilation_descriptor) {
             return _globalConfig.get<MCM_COMPILATION_DESCRIPTOR>();
         } else if (name == ov::intel_vpux::compilation_descriptor_path) {
@@ -279,6 +306,8 @@ IE::Parameter Engine::GetConfig(const std::string& name,
             return _globalConfig.get<MCM_CONCAT_SCALES_ALIGNMENT>();
         } else if (name == ov::intel_vpux::graph_color_format) {
             return _globalConfig.get<GRAPH_COLOR_FORMAT>();
+        } else if (name == ov::intel_vpux::import_blob_mmap) {
+            return _globalConfig.get<IMPORT_BLOB_MMAP>();
         } else if (name == ov::intel_vpux::inference_shaves) {
             return _globalConfig.get<INFERENCE_SHAVES>();
         } else if (name == ov::intel_vpux::inference_timeout) {
@@ -369,6 +398,8 @@ IE::Parameter Engine::GetMetric(const std::string& name, const std::map<std::str
                     RW_property(ov::hint::performance_mode.name()),  //
                     RW_property(ov::log::level.name()),              //
                     RW_property(ov::device::id.name()),              //
+                    RW_property(ov::intel_vpux::compilation_cache_dir.name()),              //
+                    RW_property(ov::intel_vpux::compilation_cache_size.name()),              //
                     RW_property(ov::intel_vpux::compilation_descriptor.name()),              //
                     RW_property(ov::intel_vpux::compilation_descriptor_path.name()),              //
                     RW_property(ov::intel_vpux::compilation_mode.name()),              //
@@ -376,12 +407,14 @@ IE::Parameter Engine::GetMetric(const std::string& name, const std::map<std::str
                     RW_property(ov::intel_vpux::compilation_pass_ban_list.name()),              //
                     RW_property(ov::intel_vpux::compiler_type.name()),              //
                     RW_property(ov::intel_vpux::concat_scales_alignment.name()),              //
+                    RW_property(ov::intel_vpux::const_folding_cache_size.name()),              //
                     RW_property(ov::intel_vpux::csram_size.name()),              //
                     RW_property(ov::intel_vpux::custom_layers.name()),              //
                     RW_property(ov::intel_vpux::dpu_groups.name()),              //
                     RW_property(ov::intel_vpux::eltwise_scales_alignment.name()),              //
                     RW_property(ov::intel_vpux::executor_streams.name()),              //
                     RW_property(ov::intel_vpux::graph_color_format.name()),              //
+                    RW_property(ov::intel_vpux::import_blob_mmap.name()),              //
                     RW_property(ov::intel_vpux::inference_shaves.name()),              //
                     RW_property(ov::intel_vpux::inference_timeout.name()),              //
                     RW_property(ov::intel_vpux::preprocessing_lpi.name()),              //
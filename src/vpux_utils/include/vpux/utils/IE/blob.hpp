@@ -91,6 +91,20 @@ InferenceEngine::MemoryBlob::Ptr toDefLayout(const InferenceEngine::MemoryBlob::
                                              const std::shared_ptr<InferenceEngine::IAllocator>& allocator = nullptr,
                                              void* ptr = nullptr);
 
+//
+// cvtBlobPrecisionAndLayout
+//
+
+// Converts both precision and layout in a single pass over memory when possible,
+// instead of toPrecision followed by toLayout with an intermediate blob.
+void cvtBlobPrecisionAndLayout(const InferenceEngine::MemoryBlob::Ptr& in, const InferenceEngine::MemoryBlob::Ptr& out,
+                               const Optional<QuantizationParam>& outQuantParams = None);
+
+InferenceEngine::MemoryBlob::Ptr toPrecisionAndLayout(
+        const InferenceEngine::MemoryBlob::Ptr& in, const InferenceEngine::Precision& precision,
+        InferenceEngine::Layout layout, const Optional<QuantizationParam>& outQuantParams = None,
+        const std::shared_ptr<InferenceEngine::IAllocator>& allocator = nullptr, void* ptr = nullptr);
+
 //
 // dumpBlobs
 //
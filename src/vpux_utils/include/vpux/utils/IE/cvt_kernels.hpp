@@ -0,0 +1,51 @@
+//
+// Copyright (C) 2022 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+//
+
+#pragma once
+
+#include "vpux/utils/core/quant_params.hpp"
+#include "vpux/utils/core/string_ref.hpp"
+
+#include <ie_precision.hpp>
+
+#include <cstdint>
+
+namespace vpux {
+
+//
+// CvtKernelIsa
+//
+
+enum class CvtKernelIsa {
+    Scalar,
+    SSE42,
+    AVX2,
+    AVX512,
+};
+
+StringLiteral stringifyEnum(CvtKernelIsa val);
+
+// The widest instruction set supported both by the host CPU and by the build.
+CvtKernelIsa getHostCvtKernelIsa();
+
+//
+// CvtKernel
+//
+
+// Converts `count` contiguous elements, `quantParams` is used only by the kernels with quantization.
+using CvtKernel = void (*)(const void* in, void* out, int64_t count, const QuantizationParam* quantParams);
+
+// Returns the vectorized kernel for the precisions pair, restricted to the `isa` instruction set,
+// or nullptr if there is no such kernel and the generic scalar conversion should be used.
+// FP32 -> FP16 and FP32 -> BF16 use round to nearest even and might differ from the scalar conversion in the last
+// mantissa bit. NaN stays a quiet NaN, the quantization saturates it to 255. Narrowing integers is range checked.
+// All the elements, including the tail of the range, are converted by the same vector code,
+// so the results don't depend on how the range is split between the threads.
+CvtKernel getCvtKernel(const InferenceEngine::Precision& inPrecision, const InferenceEngine::Precision& outPrecision,
+                       bool withQuantization, CvtKernelIsa isa = getHostCvtKernelIsa());
+
+}  // namespace vpux
@@ -22,6 +22,22 @@ StringLiteral stringifyEnum(LoopExecPolicy val);
 
 void loop_1d(LoopExecPolicy policy, int64_t dim0, FuncRef<void(int64_t)> proc);
 
+//
+// Range based loops
+//
+
+// Default minimal number of elements processed by one call of the range based loop body.
+constexpr int64_t LOOP_DEFAULT_GRAIN = 4096;
+
+// Splits [0, dim0) into contiguous chunks of at least `grain` elements and calls `proc(begin, end)` once per chunk.
+// The callback is dispatched per chunk instead of per element, so the inner loop over [begin, end) can be inlined and
+// vectorized by the compiler. The sequential policy processes the whole range in a single call.
+void loop_1d_chunked(LoopExecPolicy policy, int64_t dim0, int64_t grain, FuncRef<void(int64_t, int64_t)> proc);
+
+inline void loop_1d_chunked(LoopExecPolicy policy, int64_t dim0, FuncRef<void(int64_t, int64_t)> proc) {
+    loop_1d_chunked(policy, dim0, LOOP_DEFAULT_GRAIN, proc);
+}
+
 void loop_2d(LoopExecPolicy policy, int64_t dim0, int64_t dim1, FuncRef<void(int64_t, int64_t)> proc);
 
 void loop_3d(LoopExecPolicy policy, int64_t dim0, int64_t dim1, int64_t dim2,
@@ -0,0 +1,29 @@
+//
+// Copyright (C) 2022 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+//
+
+#pragma once
+
+#include "vpux/utils/IE/cvt_kernels.hpp"
+#include "vpux/utils/core/quant_params.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace vpux {
+
+//
+// transposePlanes
+//
+
+// Transposes `numPlanes` consecutive row-major planes of `rows` x `cols` elements: out[p][c][r] = in[p][r][c].
+// The planes are processed by cache sized tiles in parallel, with the tile loops specialized for 1, 2, 4 and 8 byte
+// elements. If `cvtKernel` is provided, the elements are converted by it on the way, so the precision and the layout
+// change in a single pass over memory. Otherwise the element sizes must match and the elements are copied as is.
+void transposePlanes(const void* in, void* out, int64_t numPlanes, int64_t rows, int64_t cols, size_t inElemSize,
+                     size_t outElemSize, CvtKernel cvtKernel = nullptr, const QuantizationParam* quantParams = nullptr);
+
+}  // namespace vpux
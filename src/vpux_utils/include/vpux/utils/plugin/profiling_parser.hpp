@@ -8,6 +8,7 @@
 #ifndef PROFILING_PARSER_HPP
 #define PROFILING_PARSER_HPP
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -58,6 +59,47 @@ struct TaskInfo {
     uint32_t parent_layer_id;  ///< Not used
 };
 
+/**
+ * @class ProfilingDecoder
+ * @brief Decodes raw profiling outputs of one compiled network.
+ * Blob metadata (task lists, layout of profiling sections, timer frequency) is parsed once on construction,
+ * so successive profiling buffers of the same blob are decoded without re-reading it.
+ * The blob must outlive the decoder. Decoding methods are const and can be called concurrently.
+ */
+class ProfilingDecoder final {
+public:
+    /**
+     * @param blob_data pointer to the buffer with blob binary
+     * @param blob_size blob size in bytes
+     */
+    ProfilingDecoder(const uint8_t* blobData, size_t blobSize);
+    ~ProfilingDecoder();
+
+    ProfilingDecoder(const ProfilingDecoder&) = delete;
+    ProfilingDecoder& operator=(const ProfilingDecoder&) = delete;
+
+    /**
+     * @brief Parse raw profiling output to get per-tasks info.
+     * @param prof_data pointer to the buffer with raw profiling data
+     * @param prof_size raw profiling data size
+     * @param type type of tasks to be profiled
+     * @return std::vector of TaskInfo structures
+     */
+    std::vector<TaskInfo> getTaskInfo(const uint8_t* profData, size_t profSize, TaskType type) const;
+
+    /**
+     * @brief Parse raw profiling output to get per-layer info.
+     * @param prof_data pointer to the buffer with raw profiling data
+     * @param prof_size raw profiling data size
+     * @return std::vector of LayerInfo structures
+     */
+    std::vector<LayerInfo> getLayerInfo(const uint8_t* profData, size_t profSize) const;
+
+private:
+    struct Impl;
+    std::unique_ptr<const Impl> _impl;
+};
+
 /**
  * @fn getTaskInfo
  * @brief Parse raw profiling output to get per-tasks info.
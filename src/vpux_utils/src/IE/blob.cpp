@@ -7,8 +7,10 @@
 
 #include "vpux/utils/IE/blob.hpp"
 
+#include "vpux/utils/IE/cvt_kernels.hpp"
 #include "vpux/utils/IE/float16.hpp"
 #include "vpux/utils/IE/loop.hpp"
+#include "vpux/utils/IE/transposition.hpp"
 #include "vpux/utils/core/checked_cast.hpp"
 #include "vpux/utils/core/format.hpp"
 #include "vpux/utils/core/logger.hpp"
@@ -19,6 +21,7 @@
 #include <blob_factory.hpp>
 #include <blob_transform.hpp>
 
+#include <algorithm>
 #include <fstream>
 
 using namespace vpux;
@@ -34,8 +37,8 @@ template <typename T>
 void fillN(T* ptr, size_t size, T val) {
     VPUX_THROW_UNLESS(ptr != nullptr, "NULL pointer");
 
-    loop_1d(LoopExecPolicy::Parallel, size, [ptr, val](size_t i) {
-        ptr[i] = val;
+    loop_1d_chunked(LoopExecPolicy::Parallel, checked_cast<int64_t>(size), [ptr, val](int64_t begin, int64_t end) {
+        std::fill(ptr + begin, ptr + end, val);
     });
 }
 
@@ -200,70 +203,33 @@ MemoryBlob::Ptr vpux::copyBlob(const MemoryBlob::Ptr& in, void* ptr) {
 namespace {
 
 template <typename InT, typename OutT>
-void cvtBlobPrecisionImpl(const MemoryBlob::Ptr& in, const MemoryBlob::Ptr& out,
-                          const vpux::Optional<vpux::QuantizationParam>& outQuantParams) {
-    const auto& inPrecision = in->getTensorDesc().getPrecision();
-    const auto& outPrecision = out->getTensorDesc().getPrecision();
-
-    VPUX_THROW_UNLESS(inPrecision.size() == sizeof(InT), "Wrong blob precision : {0}", inPrecision);
-    VPUX_THROW_UNLESS(outPrecision.size() == sizeof(OutT), "Wrong blob precision : {0}", outPrecision);
-
-    const auto inMem = in->rmap();
-    const auto outMem = out->wmap();
-
-    const auto inPtr = inMem.as<const InT*>();
-    VPUX_THROW_UNLESS(inPtr != nullptr, "Blob was not allocated");
-
-    const auto outPtr = outMem.as<OutT*>();
-    VPUX_THROW_UNLESS(outPtr != nullptr, "Blob was not allocated");
+void cvtScalar(const void* in, void* out, int64_t count, const QuantizationParam* quantParams) {
+    const auto inPtr = static_cast<const InT*>(in);
+    const auto outPtr = static_cast<OutT*>(out);
 
-    const auto pluginQuantization = outQuantParams.hasValue();
-    if (pluginQuantization) {
-        const auto isSupportedTypes =
-                (inPrecision == Precision::FP32 || inPrecision == Precision::FP16) && outPrecision == Precision::U8;
-        VPUX_THROW_UNLESS(isSupportedTypes, "VPUX Plugin quantization is supported only for FP32/FP16 to U8 cases");
-    }
-
-    if (!pluginQuantization) {
-        loop_1d(LoopExecPolicy::Parallel, in->size(), [inPtr, outPtr](int64_t index) {
+    if (quantParams == nullptr) {
+        for (int64_t index = 0; index < count; ++index) {
             outPtr[index] = checked_cast<OutT>(inPtr[index]);
-        });
+        }
     } else {
-        const auto& quantP = outQuantParams.getValue();
         const float minU8 = static_cast<float>(std::numeric_limits<uint8_t>().lowest());
         const float maxU8 = static_cast<float>(std::numeric_limits<uint8_t>().max());
-        loop_1d(LoopExecPolicy::Parallel, in->size(), [inPtr, outPtr, &quantP, minU8, maxU8](int64_t index) {
+        const float zeroPoint = static_cast<float>(quantParams->_zeroPoint);
+        const float reverseScale = static_cast<float>(quantParams->_reverseScale);
+        for (int64_t index = 0; index < count; ++index) {
             const float fp32InValue = static_cast<float>(inPtr[index]);
-            const float inValueQuant =
-                    static_cast<float>(quantP._zeroPoint + quantP._reverseScale * fp32InValue + 0.5f);
+            const float inValueQuant = zeroPoint + reverseScale * fp32InValue + 0.5f;
             outPtr[index] =
                     static_cast<OutT>(inValueQuant < minU8 ? minU8 : (inValueQuant > maxU8 ? maxU8 : inValueQuant));
-        });
+        }
     }
 }
 
-}  // namespace
-
-void vpux::cvtBlobPrecision(const MemoryBlob::Ptr& in, const MemoryBlob::Ptr& out,
-                            const vpux::Optional<vpux::QuantizationParam>& outQuantParams) {
-    VPUX_THROW_UNLESS(in != nullptr && out != nullptr, "Got NULL pointer");
-    VPUX_THROW_UNLESS(isCompact(in) && isCompact(out), "Got non-compact blobs");
-
-    const auto& inDesc = in->getTensorDesc();
-    const auto& outDesc = out->getTensorDesc();
-    VPUX_THROW_UNLESS(inDesc.getDims() == outDesc.getDims(), "Mismatch in Dims");
-    VPUX_THROW_UNLESS(inDesc.getLayout() == outDesc.getLayout(), "Mismatch in Layout");
-
-    const auto& inPrecision = inDesc.getPrecision();
-    const auto& outPrecision = outDesc.getPrecision();
+CvtKernel getScalarCvtKernel(const Precision& inPrecision, const Precision& outPrecision) {
+    CvtKernel kernel = nullptr;
 
-    if (inPrecision == outPrecision) {
-        copyBlob(in, out);
-        return;
-    }
-
-#define CASE(InT, OutT)                                       \
-    cvtBlobPrecisionImpl<InT, OutT>(in, out, outQuantParams); \
+#define CASE(InT, OutT)            \
+    kernel = cvtScalar<InT, OutT>; \
     break
 
     switch (inPrecision) {
@@ -620,6 +586,64 @@ void vpux::cvtBlobPrecision(const MemoryBlob::Ptr& in, const MemoryBlob::Ptr& ou
     }
 
 #undef CASE
+
+    return kernel;
+}
+
+CvtKernel selectCvtKernel(const Precision& inPrecision, const Precision& outPrecision,
+                          const vpux::Optional<vpux::QuantizationParam>& outQuantParams) {
+    const auto pluginQuantization = outQuantParams.hasValue();
+    if (pluginQuantization) {
+        const auto isSupportedTypes =
+                (inPrecision == Precision::FP32 || inPrecision == Precision::FP16) && outPrecision == Precision::U8;
+        VPUX_THROW_UNLESS(isSupportedTypes, "VPUX Plugin quantization is supported only for FP32/FP16 to U8 cases");
+    }
+
+    if (const auto kernel = getCvtKernel(inPrecision, outPrecision, pluginQuantization)) {
+        return kernel;
+    }
+
+    return getScalarCvtKernel(inPrecision, outPrecision);
+}
+
+}  // namespace
+
+void vpux::cvtBlobPrecision(const MemoryBlob::Ptr& in, const MemoryBlob::Ptr& out,
+                            const vpux::Optional<vpux::QuantizationParam>& outQuantParams) {
+    VPUX_THROW_UNLESS(in != nullptr && out != nullptr, "Got NULL pointer");
+    VPUX_THROW_UNLESS(isCompact(in) && isCompact(out), "Got non-compact blobs");
+
+    const auto& inDesc = in->getTensorDesc();
+    const auto& outDesc = out->getTensorDesc();
+    VPUX_THROW_UNLESS(inDesc.getDims() == outDesc.getDims(), "Mismatch in Dims");
+    VPUX_THROW_UNLESS(inDesc.getLayout() == outDesc.getLayout(), "Mismatch in Layout");
+
+    const auto& inPrecision = inDesc.getPrecision();
+    const auto& outPrecision = outDesc.getPrecision();
+
+    if (inPrecision == outPrecision) {
+        copyBlob(in, out);
+        return;
+    }
+
+    const auto kernel = selectCvtKernel(inPrecision, outPrecision, outQuantParams);
+
+    const auto inMem = in->rmap();
+    const auto outMem = out->wmap();
+
+    const auto inPtr = inMem.as<const uint8_t*>();
+    VPUX_THROW_UNLESS(inPtr != nullptr, "Blob was not allocated");
+
+    const auto outPtr = outMem.as<uint8_t*>();
+    VPUX_THROW_UNLESS(outPtr != nullptr, "Blob was not allocated");
+
+    const auto inElemSize = checked_cast<int64_t>(inPrecision.size());
+    const auto outElemSize = checked_cast<int64_t>(outPrecision.size());
+    const auto* quantParams = outQuantParams.hasValue() ? &outQuantParams.getValue() : nullptr;
+
+    loop_1d_chunked(LoopExecPolicy::Parallel, checked_cast<int64_t>(in->size()), [&](int64_t begin, int64_t end) {
+        kernel(inPtr + begin * inElemSize, outPtr + begin * outElemSize, end - begin, quantParams);
+    });
 }
 
 MemoryBlob::Ptr vpux::toPrecision(const MemoryBlob::Ptr& in, const Precision& precision,
@@ -662,6 +686,71 @@ MemoryBlob::Ptr vpux::toDefPrecision(const MemoryBlob::Ptr& in, const std::share
 // cvtBlobLayout
 //
 
+namespace {
+
+// Layout change expressed as a transposition of consecutive [rows x cols] planes
+struct PlanesTransposition {
+    int64_t numPlanes;
+    int64_t rows;
+    int64_t cols;
+};
+
+// Channel major <-> channel minor layout changes, the other ones are handled by the generic blob_copy
+Optional<PlanesTransposition> getPlanesTransposition(const MemoryBlob::Ptr& in, const MemoryBlob::Ptr& out) {
+    if (!isCompact(in) || !isCompact(out)) {
+        return None;
+    }
+
+    const auto& dims = in->getTensorDesc().getDims();
+    const auto inLayout = in->getTensorDesc().getLayout();
+    const auto outLayout = out->getTensorDesc().getLayout();
+
+    const auto isPair = [&](Layout channelMajor, Layout channelMinor) {
+        return (inLayout == channelMajor && outLayout == channelMinor) ||
+               (inLayout == channelMinor && outLayout == channelMajor);
+    };
+
+    int64_t numPlanes = 1;
+    int64_t channels = 0;
+    int64_t spatialSize = 1;
+    if (isPair(Layout::NCHW, Layout::NHWC) || isPair(Layout::NCDHW, Layout::NDHWC)) {
+        numPlanes = checked_cast<int64_t>(dims[0]);
+        channels = checked_cast<int64_t>(dims[1]);
+        for (size_t i = 2; i < dims.size(); ++i) {
+            spatialSize *= checked_cast<int64_t>(dims[i]);
+        }
+    } else if (isPair(Layout::CHW, Layout::HWC)) {
+        channels = checked_cast<int64_t>(dims[0]);
+        spatialSize = checked_cast<int64_t>(dims[1] * dims[2]);
+    } else {
+        return None;
+    }
+
+    const auto isChannelMajorInput = inLayout == Layout::NCHW || inLayout == Layout::NCDHW || inLayout == Layout::CHW;
+    if (isChannelMajorInput) {
+        return PlanesTransposition{numPlanes, channels, spatialSize};
+    }
+    return PlanesTransposition{numPlanes, spatialSize, channels};
+}
+
+void transposeBlob(const MemoryBlob::Ptr& in, const MemoryBlob::Ptr& out, const PlanesTransposition& transposition,
+                   CvtKernel cvtKernel, const QuantizationParam* quantParams) {
+    const auto inMem = in->rmap();
+    const auto outMem = out->wmap();
+
+    const auto inPtr = inMem.as<const uint8_t*>();
+    VPUX_THROW_UNLESS(inPtr != nullptr, "Blob was not allocated");
+
+    const auto outPtr = outMem.as<uint8_t*>();
+    VPUX_THROW_UNLESS(outPtr != nullptr, "Blob was not allocated");
+
+    transposePlanes(inPtr, outPtr, transposition.numPlanes, transposition.rows, transposition.cols,
+                    in->getTensorDesc().getPrecision().size(), out->getTensorDesc().getPrecision().size(), cvtKernel,
+                    quantParams);
+}
+
+}  // namespace
+
 void vpux::cvtBlobLayout(const MemoryBlob::Ptr& in, const MemoryBlob::Ptr& out) {
     VPUX_THROW_UNLESS(in != nullptr && out != nullptr, "Got NULL pointer");
 
@@ -678,6 +767,11 @@ void vpux::cvtBlobLayout(const MemoryBlob::Ptr& in, const MemoryBlob::Ptr& out)
         return;
     }
 
+    if (const auto transposition = getPlanesTransposition(in, out)) {
+        transposeBlob(in, out, transposition.getValue(), nullptr, nullptr);
+        return;
+    }
+
     blob_copy(in, out);
 }
 
@@ -706,6 +800,58 @@ MemoryBlob::Ptr vpux::toDefLayout(const MemoryBlob::Ptr& in, const std::shared_p
     return toLayout(in, defLayout, allocator, ptr);
 }
 
+//
+// cvtBlobPrecisionAndLayout
+//
+
+void vpux::cvtBlobPrecisionAndLayout(const MemoryBlob::Ptr& in, const MemoryBlob::Ptr& out,
+                                     const vpux::Optional<vpux::QuantizationParam>& outQuantParams) {
+    VPUX_THROW_UNLESS(in != nullptr && out != nullptr, "Got NULL pointer");
+
+    const auto& inDesc = in->getTensorDesc();
+    const auto& outDesc = out->getTensorDesc();
+    VPUX_THROW_UNLESS(inDesc.getDims() == outDesc.getDims(), "Mismatch in Dims");
+
+    if (inDesc.getLayout() == outDesc.getLayout()) {
+        cvtBlobPrecision(in, out, outQuantParams);
+        return;
+    }
+    if (inDesc.getPrecision() == outDesc.getPrecision()) {
+        cvtBlobLayout(in, out);
+        return;
+    }
+
+    if (const auto transposition = getPlanesTransposition(in, out)) {
+        const auto kernel = selectCvtKernel(inDesc.getPrecision(), outDesc.getPrecision(), outQuantParams);
+        const auto* quantParams = outQuantParams.hasValue() ? &outQuantParams.getValue() : nullptr;
+        transposeBlob(in, out, transposition.getValue(), kernel, quantParams);
+        return;
+    }
+
+    const auto converted = toPrecision(in, outDesc.getPrecision(), outQuantParams);
+    cvtBlobLayout(converted, out);
+}
+
+MemoryBlob::Ptr vpux::toPrecisionAndLayout(const MemoryBlob::Ptr& in, const Precision& precision, Layout layout,
+                                           const vpux::Optional<vpux::QuantizationParam>& outQuantParams,
+                                           const std::shared_ptr<IAllocator>& allocator, void* ptr) {
+    VPUX_THROW_UNLESS(in != nullptr, "Got NULL pointer");
+
+    const auto& inDesc = in->getTensorDesc();
+
+    if (inDesc.getPrecision() == precision && inDesc.getLayout() == layout && allocator == nullptr &&
+        ptr == nullptr) {
+        return in;
+    }
+
+    const auto outDesc = TensorDesc(precision, inDesc.getDims(), layout);
+    const auto out = makeBlob(outDesc, allocator, ptr);
+
+    cvtBlobPrecisionAndLayout(in, out, outQuantParams);
+
+    return out;
+}
+
 //
 // dumpBlobs
 //
@@ -0,0 +1,661 @@
+//
+// Copyright (C) 2022 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+//
+
+#include "vpux/utils/IE/cvt_kernels.hpp"
+
+#include "vpux/utils/IE/float16.hpp"
+#include "vpux/utils/core/checked_cast.hpp"
+
+#include <ie_system_conf.h>
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <tuple>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define VPUX_CVT_KERNELS_X86
+#include <immintrin.h>
+#endif
+
+// GCC and Clang need the instruction set to be enabled per function, MSVC accepts the intrinsics as is
+#if defined(VPUX_CVT_KERNELS_X86) && (defined(__GNUC__) || defined(__clang__))
+#define VPUX_CVT_TARGET(isa) __attribute__((target(isa)))
+#else
+#define VPUX_CVT_TARGET(isa)
+#endif
+
+using namespace vpux;
+using namespace InferenceEngine;
+
+StringLiteral vpux::stringifyEnum(CvtKernelIsa val) {
+    switch (val) {
+    case CvtKernelIsa::Scalar:
+        return "Scalar";
+    case CvtKernelIsa::SSE42:
+        return "SSE42";
+    case CvtKernelIsa::AVX2:
+        return "AVX2";
+    case CvtKernelIsa::AVX512:
+        return "AVX512";
+    default:
+        return "<UNKNOWN>";
+    }
+}
+
+CvtKernelIsa vpux::getHostCvtKernelIsa() {
+#ifdef VPUX_CVT_KERNELS_X86
+    static const auto isa = []() {
+        // Every AVX2 capable CPU also supports F16C, which is used for the FP16 conversions
+        if (with_cpu_x86_avx512f()) {
+            return CvtKernelIsa::AVX512;
+        }
+        if (with_cpu_x86_avx2()) {
+            return CvtKernelIsa::AVX2;
+        }
+        if (with_cpu_x86_sse42()) {
+            return CvtKernelIsa::SSE42;
+        }
+        return CvtKernelIsa::Scalar;
+    }();
+    return isa;
+#else
+    return CvtKernelIsa::Scalar;
+#endif
+}
+
+namespace {
+
+#ifdef VPUX_CVT_KERNELS_X86
+
+//
+// Tails
+//
+
+// The tail is converted by one more vector iteration on a zero-padded copy, so every element goes through
+// the same instructions regardless of how the range is split between the threads.
+template <int64_t STEP, typename InT, typename OutT, class Block, typename... Args>
+void cvtTail(Block block, const InT* in, OutT* out, int64_t count, const Args&... args) {
+    if (count <= 0) {
+        return;
+    }
+
+    std::array<InT, STEP> inBuf = {};
+    std::array<OutT, STEP> outBuf;
+    std::copy_n(in, count, inBuf.data());
+    block(inBuf.data(), outBuf.data(), args...);
+    std::copy_n(outBuf.data(), count, out);
+}
+
+// Integer narrowing is exact, the scalar path is kept for its range checks
+template <typename InT, typename OutT>
+void cvtScalar(const InT* in, OutT* out, int64_t count) {
+    for (int64_t i = 0; i < count; ++i) {
+        out[i] = checked_cast<OutT>(in[i]);
+    }
+}
+
+//
+// SSE4.2
+//
+
+VPUX_CVT_TARGET("sse4.2")
+__m128i roundToBF16(__m128 vals) {
+    // Round to nearest even, NaN is kept quiet
+    const auto bits = _mm_castps_si128(vals);
+    const auto lsb = _mm_and_si128(_mm_srli_epi32(bits, 16), _mm_set1_epi32(1));
+    const auto rounded = _mm_add_epi32(bits, _mm_add_epi32(lsb, _mm_set1_epi32(0x7FFF)));
+    const auto nan = _mm_or_si128(bits, _mm_set1_epi32(0x00400000));
+    const auto isNan = _mm_castps_si128(_mm_cmpunord_ps(vals, vals));
+    return _mm_srli_epi32(_mm_blendv_epi8(rounded, nan, isNan), 16);
+}
+
+VPUX_CVT_TARGET("sse4.2")
+void cvtFP32toBF16Block_SSE42(const float* src, bfloat16* dst) {
+    const auto lo = roundToBF16(_mm_loadu_ps(src));
+    const auto hi = roundToBF16(_mm_loadu_ps(src + 4));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_packus_epi32(lo, hi));
+}
+
+VPUX_CVT_TARGET("sse4.2")
+void cvtFP32toBF16_SSE42(const void* in, void* out, int64_t count, const QuantizationParam*) {
+    const auto* src = static_cast<const float*>(in);
+    auto* dst = static_cast<bfloat16*>(out);
+
+    int64_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        cvtFP32toBF16Block_SSE42(src + i, dst + i);
+    }
+    cvtTail<8>(cvtFP32toBF16Block_SSE42, src + i, dst + i, count - i);
+}
+
+VPUX_CVT_TARGET("sse4.2")
+void cvtBF16toFP32Block_SSE42(const bfloat16* src, float* dst) {
+    const auto zero = _mm_setzero_si128();
+    const auto vals = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+    _mm_storeu_ps(dst, _mm_castsi128_ps(_mm_unpacklo_epi16(zero, vals)));
+    _mm_storeu_ps(dst + 4, _mm_castsi128_ps(_mm_unpackhi_epi16(zero, vals)));
+}
+
+VPUX_CVT_TARGET("sse4.2")
+void cvtBF16toFP32_SSE42(const void* in, void* out, int64_t count, const QuantizationParam*) {
+    const auto* src = static_cast<const bfloat16*>(in);
+    auto* dst = static_cast<float*>(out);
+
+    int64_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        cvtBF16toFP32Block_SSE42(src + i, dst + i);
+    }
+    cvtTail<8>(cvtBF16toFP32Block_SSE42, src + i, dst + i, count - i);
+}
+
+VPUX_CVT_TARGET("sse4.2")
+void cvtU8toFP32Block_SSE42(const uint8_t* src, float* dst) {
+    const auto vals = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+    _mm_storeu_ps(dst, _mm_cvtepi32_ps(_mm_cvtepu8_epi32(vals)));
+    _mm_storeu_ps(dst + 4, _mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_srli_si128(vals, 4))));
+    _mm_storeu_ps(dst + 8, _mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_srli_si128(vals, 8))));
+    _mm_storeu_ps(dst + 12, _mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_srli_si128(vals, 12))));
+}
+
+VPUX_CVT_TARGET("sse4.2")
+void cvtU8toFP32_SSE42(const void* in, void* out, int64_t count, const QuantizationParam*) {
+    const auto* src = static_cast<const uint8_t*>(in);
+    auto* dst = static_cast<float*>(out);
+
+    int64_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        cvtU8toFP32Block_SSE42(src + i, dst + i);
+    }
+    cvtTail<16>(cvtU8toFP32Block_SSE42, src + i, dst + i, count - i);
+}
+
+VPUX_CVT_TARGET("sse4.2")
+__m128i quantize_SSE42(__m128 vals, const QuantizationParam& quantParams) {
+    const auto zeroPoint = _mm_set1_ps(static_cast<float>(quantParams._zeroPoint));
+    const auto reverseScale = _mm_set1_ps(quantParams._reverseScale);
+    const auto minU8 = _mm_set1_ps(static_cast<float>(std::numeric_limits<uint8_t>::lowest()));
+    const auto maxU8 = _mm_set1_ps(static_cast<float>(std::numeric_limits<uint8_t>::max()));
+
+    // Keep the scalar order of operations to get bit exact results.
+    // MINPS returns its second operand for NaN, so NaN is saturated to the maximum.
+    const auto quant = _mm_add_ps(_mm_add_ps(zeroPoint, _mm_mul_ps(reverseScale, vals)), _mm_set1_ps(0.5f));
+    return _mm_cvttps_epi32(_mm_max_ps(_mm_min_ps(quant, maxU8), minU8));
+}
+
+VPUX_CVT_TARGET("sse4.2")
+void quantizeFP32toU8Block_SSE42(const float* src, uint8_t* dst, const QuantizationParam& quantParams) {
+    const auto q0 = quantize_SSE42(_mm_loadu_ps(src), quantParams);
+    const auto q1 = quantize_SSE42(_mm_loadu_ps(src + 4), quantParams);
+    const auto q2 = quantize_SSE42(_mm_loadu_ps(src + 8), quantParams);
+    const auto q3 = quantize_SSE42(_mm_loadu_ps(src + 12), quantParams);
+    const auto packed = _mm_packus_epi16(_mm_packus_epi32(q0, q1), _mm_packus_epi32(q2, q3));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), packed);
+}
+
+VPUX_CVT_TARGET("sse4.2")
+void quantizeFP32toU8_SSE42(const void* in, void* out, int64_t count, const QuantizationParam* quantParams) {
+    const auto* src = static_cast<const float*>(in);
+    auto* dst = static_cast<uint8_t*>(out);
+
+    int64_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        quantizeFP32toU8Block_SSE42(src + i, dst + i, *quantParams);
+    }
+    cvtTail<16>(quantizeFP32toU8Block_SSE42, src + i, dst + i, count - i, *quantParams);
+}
+
+VPUX_CVT_TARGET("sse4.2")
+void cvtI64toI32_SSE42(const void* in, void* out, int64_t count, const QuantizationParam*) {
+    const auto* src = static_cast<const int64_t*>(in);
+    auto* dst = static_cast<int32_t*>(out);
+
+    int64_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const auto v0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        const auto v1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 2));
+        const auto lo = _mm_unpacklo_epi64(_mm_shuffle_epi32(v0, _MM_SHUFFLE(2, 0, 2, 0)),
+                                           _mm_shuffle_epi32(v1, _MM_SHUFFLE(2, 0, 2, 0)));
+
+        // Out of range values are not sign extensions of their low halves, let the scalar path report them
+        const auto eq0 = _mm_cmpeq_epi64(_mm_cvtepi32_epi64(lo), v0);
+        const auto eq1 = _mm_cmpeq_epi64(_mm_cvtepi32_epi64(_mm_srli_si128(lo, 8)), v1);
+        if (_mm_movemask_epi8(_mm_and_si128(eq0, eq1)) != 0xFFFF) {
+            cvtScalar(src + i, dst + i, 4);
+            continue;
+        }
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), lo);
+    }
+    cvtScalar(src + i, dst + i, count - i);
+}
+
+//
+// AVX2
+//
+
+VPUX_CVT_TARGET("avx2,f16c")
+void cvtFP32toFP16Block_AVX2(const float* src, float16* dst) {
+    const auto lo = _mm256_cvtps_ph(_mm256_loadu_ps(src), _MM_FROUND_TO_NEAREST_INT);
+    const auto hi = _mm256_cvtps_ph(_mm256_loadu_ps(src + 8), _MM_FROUND_TO_NEAREST_INT);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), lo);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 8), hi);
+}
+
+VPUX_CVT_TARGET("avx2,f16c")
+void cvtFP32toFP16_AVX2(const void* in, void* out, int64_t count, const QuantizationParam*) {
+    const auto* src = static_cast<const float*>(in);
+    auto* dst = static_cast<float16*>(out);
+
+    int64_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        cvtFP32toFP16Block_AVX2(src + i, dst + i);
+    }
+    cvtTail<16>(cvtFP32toFP16Block_AVX2, src + i, dst + i, count - i);
+}
+
+VPUX_CVT_TARGET("avx2,f16c")
+void cvtFP16toFP32Block_AVX2(const float16* src, float* dst) {
+    const auto lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+    const auto hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 8));
+    _mm256_storeu_ps(dst, _mm256_cvtph_ps(lo));
+    _mm256_storeu_ps(dst + 8, _mm256_cvtph_ps(hi));
+}
+
+VPUX_CVT_TARGET("avx2,f16c")
+void cvtFP16toFP32_AVX2(const void* in, void* out, int64_t count, const QuantizationParam*) {
+    const auto* src = static_cast<const float16*>(in);
+    auto* dst = static_cast<float*>(out);
+
+    int64_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        cvtFP16toFP32Block_AVX2(src + i, dst + i);
+    }
+    cvtTail<16>(cvtFP16toFP32Block_AVX2, src + i, dst + i, count - i);
+}
+
+VPUX_CVT_TARGET("avx2")
+__m256i roundToBF16_AVX2(__m256 vals) {
+    const auto bits = _mm256_castps_si256(vals);
+    const auto lsb = _mm256_and_si256(_mm256_srli_epi32(bits, 16), _mm256_set1_epi32(1));
+    const auto rounded = _mm256_add_epi32(bits, _mm256_add_epi32(lsb, _mm256_set1_epi32(0x7FFF)));
+    const auto nan = _mm256_or_si256(bits, _mm256_set1_epi32(0x00400000));
+    const auto isNan = _mm256_castps_si256(_mm256_cmp_ps(vals, vals, _CMP_UNORD_Q));
+    return _mm256_srli_epi32(_mm256_blendv_epi8(rounded, nan, isNan), 16);
+}
+
+VPUX_CVT_TARGET("avx2")
+void cvtFP32toBF16Block_AVX2(const float* src, bfloat16* dst) {
+    const auto lo = roundToBF16_AVX2(_mm256_loadu_ps(src));
+    const auto hi = roundToBF16_AVX2(_mm256_loadu_ps(src + 8));
+    // Packing works within 128-bit lanes, restore the element order afterwards
+    const auto packed = _mm256_permute4x64_epi64(_mm256_packus_epi32(lo, hi), _MM_SHUFFLE(3, 1, 2, 0));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), packed);
+}
+
+VPUX_CVT_TARGET("avx2")
+void cvtFP32toBF16_AVX2(const void* in, void* out, int64_t count, const QuantizationParam*) {
+    const auto* src = static_cast<const float*>(in);
+    auto* dst = static_cast<bfloat16*>(out);
+
+    int64_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        cvtFP32toBF16Block_AVX2(src + i, dst + i);
+    }
+    cvtTail<16>(cvtFP32toBF16Block_AVX2, src + i, dst + i, count - i);
+}
+
+VPUX_CVT_TARGET("avx2")
+void cvtBF16toFP32Block_AVX2(const bfloat16* src, float* dst) {
+    const auto lo = _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src)));
+    const auto hi = _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 8)));
+    _mm256_storeu_ps(dst, _mm256_castsi256_ps(_mm256_slli_epi32(lo, 16)));
+    _mm256_storeu_ps(dst + 8, _mm256_castsi256_ps(_mm256_slli_epi32(hi, 16)));
+}
+
+VPUX_CVT_TARGET("avx2")
+void cvtBF16toFP32_AVX2(const void* in, void* out, int64_t count, const QuantizationParam*) {
+    const auto* src = static_cast<const bfloat16*>(in);
+    auto* dst = static_cast<float*>(out);
+
+    int64_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        cvtBF16toFP32Block_AVX2(src + i, dst + i);
+    }
+    cvtTail<16>(cvtBF16toFP32Block_AVX2, src + i, dst + i, count - i);
+}
+
+VPUX_CVT_TARGET("avx2")
+void cvtU8toFP32Block_AVX2(const uint8_t* src, float* dst) {
+    const auto vals = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+    _mm256_storeu_ps(dst, _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(vals)));
+    _mm256_storeu_ps(dst + 8, _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_srli_si128(vals, 8))));
+}
+
+VPUX_CVT_TARGET("avx2")
+void cvtU8toFP32_AVX2(const void* in, void* out, int64_t count, const QuantizationParam*) {
+    const auto* src = static_cast<const uint8_t*>(in);
+    auto* dst = static_cast<float*>(out);
+
+    int64_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        cvtU8toFP32Block_AVX2(src + i, dst + i);
+    }
+    cvtTail<16>(cvtU8toFP32Block_AVX2, src + i, dst + i, count - i);
+}
+
+VPUX_CVT_TARGET("avx2,f16c")
+void cvtU8toFP16Block_AVX2(const uint8_t* src, float16* dst) {
+    const auto vals = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+    const auto lo = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(vals));
+    const auto hi = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_srli_si128(vals, 8)));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm256_cvtps_ph(lo, _MM_FROUND_TO_NEAREST_INT));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 8), _mm256_cvtps_ph(hi, _MM_FROUND_TO_NEAREST_INT));
+}
+
+VPUX_CVT_TARGET("avx2,f16c")
+void cvtU8toFP16_AVX2(const void* in, void* out, int64_t count, const QuantizationParam*) {
+    const auto* src = static_cast<const uint8_t*>(in);
+    auto* dst = static_cast<float16*>(out);
+
+    int64_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        cvtU8toFP16Block_AVX2(src + i, dst + i);
+    }
+    cvtTail<16>(cvtU8toFP16Block_AVX2, src + i, dst + i, count - i);
+}
+
+VPUX_CVT_TARGET("avx2")
+__m256i quantize_AVX2(__m256 vals, const QuantizationParam& quantParams) {
+    const auto zeroPoint = _mm256_set1_ps(static_cast<float>(quantParams._zeroPoint));
+    const auto reverseScale = _mm256_set1_ps(quantParams._reverseScale);
+    const auto minU8 = _mm256_set1_ps(static_cast<float>(std::numeric_limits<uint8_t>::lowest()));
+    const auto maxU8 = _mm256_set1_ps(static_cast<float>(std::numeric_limits<uint8_t>::max()));
+
+    const auto quant = _mm256_add_ps(_mm256_add_ps(zeroPoint, _mm256_mul_ps(reverseScale, vals)), _mm256_set1_ps(0.5f));
+    return _mm256_cvttps_epi32(_mm256_max_ps(_mm256_min_ps(quant, maxU8), minU8));
+}
+
+VPUX_CVT_TARGET("avx2")
+void quantizeFP32toU8Block_AVX2(const float* src, uint8_t* dst, const QuantizationParam& quantParams) {
+    const auto lo = quantize_AVX2(_mm256_loadu_ps(src), quantParams);
+    const auto hi = quantize_AVX2(_mm256_loadu_ps(src + 8), quantParams);
+    const auto words = _mm256_permute4x64_epi64(_mm256_packus_epi32(lo, hi), _MM_SHUFFLE(3, 1, 2, 0));
+    const auto bytes = _mm_packus_epi16(_mm256_castsi256_si128(words), _mm256_extracti128_si256(words, 1));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), bytes);
+}
+
+VPUX_CVT_TARGET("avx2")
+void quantizeFP32toU8_AVX2(const void* in, void* out, int64_t count, const QuantizationParam* quantParams) {
+    const auto* src = static_cast<const float*>(in);
+    auto* dst = static_cast<uint8_t*>(out);
+
+    int64_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        quantizeFP32toU8Block_AVX2(src + i, dst + i, *quantParams);
+    }
+    cvtTail<16>(quantizeFP32toU8Block_AVX2, src + i, dst + i, count - i, *quantParams);
+}
+
+VPUX_CVT_TARGET("avx2")
+void cvtI64toI32_AVX2(const void* in, void* out, int64_t count, const QuantizationParam*) {
+    const auto* src = static_cast<const int64_t*>(in);
+    auto* dst = static_cast<int32_t*>(out);
+
+    const auto lowHalves = _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6);
+    int64_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const auto vals = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        const auto lo = _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(vals, lowHalves));
+
+        // Out of range values are not sign extensions of their low halves, let the scalar path report them
+        if (_mm256_movemask_epi8(_mm256_cmpeq_epi64(_mm256_cvtepi32_epi64(lo), vals)) != -1) {
+            cvtScalar(src + i, dst + i, 4);
+            continue;
+        }
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), lo);
+    }
+    cvtScalar(src + i, dst + i, count - i);
+}
+
+//
+// AVX-512
+//
+
+// The AVX-512 intrinsics of some GCC versions trigger false positive maybe-uninitialized warnings in their own headers
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+VPUX_CVT_TARGET("avx512f")
+void cvtFP32toFP16Block_AVX512(const float* src, float16* dst) {
+    const auto vals = _mm512_cvtps_ph(_mm512_loadu_ps(src), _MM_FROUND_TO_NEAREST_INT);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), vals);
+}
+
+VPUX_CVT_TARGET("avx512f")
+void cvtFP32toFP16_AVX512(const void* in, void* out, int64_t count, const QuantizationParam*) {
+    const auto* src = static_cast<const float*>(in);
+    auto* dst = static_cast<float16*>(out);
+
+    int64_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        cvtFP32toFP16Block_AVX512(src + i, dst + i);
+    }
+    cvtTail<16>(cvtFP32toFP16Block_AVX512, src + i, dst + i, count - i);
+}
+
+VPUX_CVT_TARGET("avx512f")
+void cvtFP16toFP32Block_AVX512(const float16* src, float* dst) {
+    const auto vals = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src));
+    _mm512_storeu_ps(dst, _mm512_cvtph_ps(vals));
+}
+
+VPUX_CVT_TARGET("avx512f")
+void cvtFP16toFP32_AVX512(const void* in, void* out, int64_t count, const QuantizationParam*) {
+    const auto* src = static_cast<const float16*>(in);
+    auto* dst = static_cast<float*>(out);
+
+    int64_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        cvtFP16toFP32Block_AVX512(src + i, dst + i);
+    }
+    cvtTail<16>(cvtFP16toFP32Block_AVX512, src + i, dst + i, count - i);
+}
+
+VPUX_CVT_TARGET("avx512f")
+void cvtU8toFP32Block_AVX512(const uint8_t* src, float* dst) {
+    const auto vals = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+    _mm512_storeu_ps(dst, _mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(vals)));
+}
+
+VPUX_CVT_TARGET("avx512f")
+void cvtU8toFP32_AVX512(const void* in, void* out, int64_t count, const QuantizationParam*) {
+    const auto* src = static_cast<const uint8_t*>(in);
+    auto* dst = static_cast<float*>(out);
+
+    int64_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        cvtU8toFP32Block_AVX512(src + i, dst + i);
+    }
+    cvtTail<16>(cvtU8toFP32Block_AVX512, src + i, dst + i, count - i);
+}
+
+VPUX_CVT_TARGET("avx512f")
+void cvtU8toFP16Block_AVX512(const uint8_t* src, float16* dst) {
+    const auto bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+    const auto vals = _mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(bytes));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), _mm512_cvtps_ph(vals, _MM_FROUND_TO_NEAREST_INT));
+}
+
+VPUX_CVT_TARGET("avx512f")
+void cvtU8toFP16_AVX512(const void* in, void* out, int64_t count, const QuantizationParam*) {
+    const auto* src = static_cast<const uint8_t*>(in);
+    auto* dst = static_cast<float16*>(out);
+
+    int64_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        cvtU8toFP16Block_AVX512(src + i, dst + i);
+    }
+    cvtTail<16>(cvtU8toFP16Block_AVX512, src + i, dst + i, count - i);
+}
+
+VPUX_CVT_TARGET("avx512f")
+void quantizeFP32toU8Block_AVX512(const float* src, uint8_t* dst, const QuantizationParam& quantParams) {
+    const auto zeroPoint = _mm512_set1_ps(static_cast<float>(quantParams._zeroPoint));
+    const auto reverseScale = _mm512_set1_ps(quantParams._reverseScale);
+    const auto minU8 = _mm512_set1_ps(static_cast<float>(std::numeric_limits<uint8_t>::lowest()));
+    const auto maxU8 = _mm512_set1_ps(static_cast<float>(std::numeric_limits<uint8_t>::max()));
+
+    const auto vals = _mm512_loadu_ps(src);
+    const auto quant = _mm512_add_ps(_mm512_add_ps(zeroPoint, _mm512_mul_ps(reverseScale, vals)), _mm512_set1_ps(0.5f));
+    const auto clamped = _mm512_cvttps_epi32(_mm512_max_ps(_mm512_min_ps(quant, maxU8), minU8));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm512_cvtepi32_epi8(clamped));
+}
+
+VPUX_CVT_TARGET("avx512f")
+void quantizeFP32toU8_AVX512(const void* in, void* out, int64_t count, const QuantizationParam* quantParams) {
+    const auto* src = static_cast<const float*>(in);
+    auto* dst = static_cast<uint8_t*>(out);
+
+    int64_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        quantizeFP32toU8Block_AVX512(src + i, dst + i, *quantParams);
+    }
+    cvtTail<16>(quantizeFP32toU8Block_AVX512, src + i, dst + i, count - i, *quantParams);
+}
+
+VPUX_CVT_TARGET("avx512f")
+void cvtI64toI32_AVX512(const void* in, void* out, int64_t count, const QuantizationParam*) {
+    const auto* src = static_cast<const int64_t*>(in);
+    auto* dst = static_cast<int32_t*>(out);
+
+    int64_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const auto vals = _mm512_loadu_si512(src + i);
+        const auto lo = _mm512_cvtepi64_epi32(vals);
+
+        // Out of range values are not sign extensions of their low halves, let the scalar path report them
+        if (_mm512_cmpeq_epi64_mask(_mm512_cvtepi32_epi64(lo), vals) != 0xFF) {
+            cvtScalar(src + i, dst + i, 8);
+            continue;
+        }
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), lo);
+    }
+    cvtScalar(src + i, dst + i, count - i);
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+#endif
+
+}  // namespace
+
+//
+// getCvtKernel
+//
+
+CvtKernel vpux::getCvtKernel(const Precision& inPrecision, const Precision& outPrecision, bool withQuantization,
+                             CvtKernelIsa isa) {
+#ifdef VPUX_CVT_KERNELS_X86
+    const auto isPair = [&](Precision in, Precision out) {
+        return inPrecision == in && outPrecision == out;
+    };
+
+    if (withQuantization) {
+        if (!isPair(Precision::FP32, Precision::U8)) {
+            return nullptr;
+        }
+
+        switch (isa) {
+        case CvtKernelIsa::AVX512:
+            return quantizeFP32toU8_AVX512;
+        case CvtKernelIsa::AVX2:
+            return quantizeFP32toU8_AVX2;
+        case CvtKernelIsa::SSE42:
+            return quantizeFP32toU8_SSE42;
+        default:
+            return nullptr;
+        }
+    }
+
+    if (isa == CvtKernelIsa::AVX512) {
+        if (isPair(Precision::FP32, Precision::FP16)) {
+            return cvtFP32toFP16_AVX512;
+        }
+        if (isPair(Precision::FP16, Precision::FP32)) {
+            return cvtFP16toFP32_AVX512;
+        }
+        if (isPair(Precision::U8, Precision::FP32)) {
+            return cvtU8toFP32_AVX512;
+        }
+        if (isPair(Precision::U8, Precision::FP16)) {
+            return cvtU8toFP16_AVX512;
+        }
+        if (isPair(Precision::I64, Precision::I32)) {
+            return cvtI64toI32_AVX512;
+        }
+        // BF16 conversions are memory bound already with AVX2
+        isa = CvtKernelIsa::AVX2;
+    }
+
+    if (isa == CvtKernelIsa::AVX2) {
+        if (isPair(Precision::FP32, Precision::FP16)) {
+            return cvtFP32toFP16_AVX2;
+        }
+        if (isPair(Precision::FP16, Precision::FP32)) {
+            return cvtFP16toFP32_AVX2;
+        }
+        if (isPair(Precision::FP32, Precision::BF16)) {
+            return cvtFP32toBF16_AVX2;
+        }
+        if (isPair(Precision::BF16, Precision::FP32)) {
+            return cvtBF16toFP32_AVX2;
+        }
+        if (isPair(Precision::U8, Precision::FP32)) {
+            return cvtU8toFP32_AVX2;
+        }
+        if (isPair(Precision::U8, Precision::FP16)) {
+            return cvtU8toFP16_AVX2;
+        }
+        if (isPair(Precision::I64, Precision::I32)) {
+            return cvtI64toI32_AVX2;
+        }
+        return nullptr;
+    }
+
+    if (isa == CvtKernelIsa::SSE42) {
+        // FP16 conversions need F16C, which is not a part of SSE4.2
+        if (isPair(Precision::FP32, Precision::BF16)) {
+            return cvtFP32toBF16_SSE42;
+        }
+        if (isPair(Precision::BF16, Precision::FP32)) {
+            return cvtBF16toFP32_SSE42;
+        }
+        if (isPair(Precision::U8, Precision::FP32)) {
+            return cvtU8toFP32_SSE42;
+        }
+        if (isPair(Precision::I64, Precision::I32)) {
+            return cvtI64toI32_SSE42;
+        }
+        return nullptr;
+    }
+
+    return nullptr;
+#else
+    std::ignore = inPrecision;
+    std::ignore = outPrecision;
+    std::ignore = withQuantization;
+    std::ignore = isa;
+    return nullptr;
+#endif
+}
@@ -7,9 +7,14 @@
 
 #include "vpux/utils/IE/loop.hpp"
 
+#include "vpux/utils/core/error.hpp"
+#include "vpux/utils/core/numeric.hpp"
+
 #include <ie_common.h>
 #include <ie_parallel.hpp>
 
+#include <algorithm>
+
 using namespace vpux;
 
 StringLiteral vpux::stringifyEnum(LoopExecPolicy val) {
@@ -33,6 +38,32 @@ void vpux::loop_1d(LoopExecPolicy policy, int64_t dim0, FuncRef<void(int64_t)> p
     }
 }
 
+void vpux::loop_1d_chunked(LoopExecPolicy policy, int64_t dim0, int64_t grain, FuncRef<void(int64_t, int64_t)> proc) {
+    VPUX_THROW_UNLESS(grain > 0, "Loop grain must be positive, got '{0}'", grain);
+
+    if (dim0 <= 0) {
+        return;
+    }
+
+    const int64_t maxChunks = divUp(dim0, grain);
+    const int64_t numChunks =
+            policy == LoopExecPolicy::Parallel
+                    ? std::min(maxChunks, static_cast<int64_t>(InferenceEngine::parallel_get_max_threads()))
+                    : 1;
+
+    if (numChunks <= 1) {
+        proc(0, dim0);
+        return;
+    }
+
+    InferenceEngine::parallel_for(numChunks, [&](int64_t chunk) {
+        int64_t begin = 0;
+        int64_t end = 0;
+        InferenceEngine::splitter(dim0, numChunks, chunk, begin, end);
+        proc(begin, end);
+    });
+}
+
 void vpux::loop_2d(LoopExecPolicy policy, int64_t dim0, int64_t dim1, FuncRef<void(int64_t, int64_t)> proc) {
     if (policy == LoopExecPolicy::Parallel) {
         InferenceEngine::parallel_for2d(dim0, dim1, proc);
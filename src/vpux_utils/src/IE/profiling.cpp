@@ -141,7 +141,7 @@ static void printProfilingAsTraceEvent(const uint8_t* blobData, size_t blobSize,
         out_stream << ted;
     }
 
-    std::vector<LayerInfo> layerProfiling = getLayerInfo(blobData, blobSize, profData, profSize);
+    std::vector<LayerInfo> layerProfiling = getLayerInfo(taskProfiling);
     ted.category = "Layer";
     for (auto& layer : layerProfiling) {
         ted.name = layer.name;
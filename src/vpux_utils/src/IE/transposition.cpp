@@ -0,0 +1,110 @@
+//
+// Copyright (C) 2022 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+//
+
+#include "vpux/utils/IE/transposition.hpp"
+
+#include "vpux/utils/IE/loop.hpp"
+#include "vpux/utils/core/error.hpp"
+#include "vpux/utils/core/numeric.hpp"
+
+#include <algorithm>
+
+using namespace vpux;
+
+namespace {
+
+// 32 x 32 tile of 8 byte elements takes 8 KB, so both the source and the destination tiles stay in L1 cache
+constexpr int64_t TILE_SIZE = 32;
+constexpr size_t MAX_ELEM_SIZE = 8;
+
+// Minimal number of tiles processed by one thread
+constexpr int64_t TILES_GRAIN = 16;
+
+using TransposeTileFunc = void (*)(const uint8_t* in, int64_t inStride, uint8_t* out, int64_t outStride,
+                                   int64_t tileRows, int64_t tileCols);
+
+// Strides are in elements
+template <typename T>
+void transposeTile(const uint8_t* in, int64_t inStride, uint8_t* out, int64_t outStride, int64_t tileRows,
+                   int64_t tileCols) {
+    const auto inPtr = reinterpret_cast<const T*>(in);
+    const auto outPtr = reinterpret_cast<T*>(out);
+
+    for (int64_t c = 0; c < tileCols; ++c) {
+        for (int64_t r = 0; r < tileRows; ++r) {
+            outPtr[c * outStride + r] = inPtr[r * inStride + c];
+        }
+    }
+}
+
+TransposeTileFunc getTransposeTileFunc(size_t elemSize) {
+    switch (elemSize) {
+    case 1:
+        return transposeTile<uint8_t>;
+    case 2:
+        return transposeTile<uint16_t>;
+    case 4:
+        return transposeTile<uint32_t>;
+    case 8:
+        return transposeTile<uint64_t>;
+    default:
+        VPUX_THROW("Unsupported element size '{0}' for transposition", elemSize);
+    }
+}
+
+}  // namespace
+
+void vpux::transposePlanes(const void* in, void* out, int64_t numPlanes, int64_t rows, int64_t cols,
+                           size_t inElemSize, size_t outElemSize, CvtKernel cvtKernel,
+                           const QuantizationParam* quantParams) {
+    VPUX_THROW_UNLESS(in != nullptr && out != nullptr, "Got NULL pointer");
+    VPUX_THROW_UNLESS(cvtKernel != nullptr || inElemSize == outElemSize,
+                      "Element sizes '{0}' and '{1}' mismatch without conversion", inElemSize, outElemSize);
+
+    if (numPlanes == 0 || rows == 0 || cols == 0) {
+        return;
+    }
+
+    const auto transposeTileFunc = getTransposeTileFunc(outElemSize);
+
+    const auto inBytes = static_cast<const uint8_t*>(in);
+    const auto outBytes = static_cast<uint8_t*>(out);
+    const auto inElemBytes = static_cast<int64_t>(inElemSize);
+    const auto outElemBytes = static_cast<int64_t>(outElemSize);
+    const auto planeSize = rows * cols;
+
+    const auto rowTiles = divUp(rows, TILE_SIZE);
+    const auto colTiles = divUp(cols, TILE_SIZE);
+    const auto tilesPerPlane = rowTiles * colTiles;
+
+    loop_1d_chunked(LoopExecPolicy::Parallel, numPlanes * tilesPerPlane, TILES_GRAIN, [&](int64_t begin, int64_t end) {
+        // Converted source tile, stored with TILE_SIZE row stride
+        alignas(64) uint8_t tileBuf[TILE_SIZE * TILE_SIZE * MAX_ELEM_SIZE];
+
+        for (int64_t tile = begin; tile < end; ++tile) {
+            const auto plane = tile / tilesPerPlane;
+            const auto r0 = ((tile % tilesPerPlane) / colTiles) * TILE_SIZE;
+            const auto c0 = (tile % colTiles) * TILE_SIZE;
+            const auto tileRows = std::min(TILE_SIZE, rows - r0);
+            const auto tileCols = std::min(TILE_SIZE, cols - c0);
+
+            const auto src = inBytes + (plane * planeSize + r0 * cols + c0) * inElemBytes;
+            const auto dst = outBytes + (plane * planeSize + c0 * rows + r0) * outElemBytes;
+
+            if (cvtKernel == nullptr) {
+                transposeTileFunc(src, cols, dst, rows, tileRows, tileCols);
+                continue;
+            }
+
+            for (int64_t r = 0; r < tileRows; ++r) {
+                cvtKernel(src + r * cols * inElemBytes, tileBuf + r * TILE_SIZE * outElemBytes, tileCols,
+                          quantParams);
+            }
+            transposeTileFunc(tileBuf, TILE_SIZE, dst, rows, tileRows, tileCols);
+        }
+    });
+}
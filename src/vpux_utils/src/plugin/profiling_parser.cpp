@@ -6,10 +6,14 @@
 //
 
 #include "vpux/utils/plugin/profiling_parser.hpp"
+#include "vpux/utils/IE/loop.hpp"
 #include "vpux/utils/core/error.hpp"
 
-#include <map>
+#include <algorithm>
+#include <cstring>
+#include <limits>
 #include <string>
+#include <unordered_map>
 
 #include <flatbuffers/flatbuffers.h>
 #include <schema/graphfile_generated.h>
@@ -111,15 +115,27 @@ void getProfilingMeta(std::string& taskName, unsigned size, std::string* profili
     }
 }
 
-static void parseDMATaskProfiling(const flatbuffers::Vector<flatbuffers::Offset<MVCNN::Task>>* dma_taskList,
-                                  const void* output, size_t output_len, double frc_speed_mhz,
-                                  std::vector<TaskInfo>& profInfo) {
+using TaskList = flatbuffers::Vector<flatbuffers::Offset<MVCNN::Task>>;
+
+// Profiled task as described by the blob. The prototype has everything but the timings filled in,
+// pos and lastPos point to the task records in the profiling section
+struct ProfiledTask {
+    TaskInfo prototype;
+    unsigned pos;
+    unsigned lastPos;
+};
+
+static void setTaskName(TaskInfo& profInfoItem, const std::string& taskName) {
+    const auto nameLen = sizeof(profInfoItem.name) / sizeof(profInfoItem.name[0]);
+    const auto length = taskName.copy(profInfoItem.name, nameLen - 1, 0);
+    profInfoItem.name[length] = '\0';
+}
+
+static std::vector<ProfiledTask> collectDMATasks(const TaskList* dma_taskList) {
+    std::vector<ProfiledTask> tasks;
     if (dma_taskList == nullptr) {
-        return;
+        return tasks;
     }
-    auto output_bin = reinterpret_cast<const uint32_t*>(output);
-    uint64_t overflow_shift = 0;
-    uint32_t last_time = 0;
 
     for (unsigned dma_taskListId = 0; dma_taskListId < (*dma_taskList).size(); dma_taskListId++) {
         auto task = (*dma_taskList)[dma_taskListId];
@@ -131,59 +147,33 @@ static void parseDMATaskProfiling(const flatbuffers::Vector<flatbuffers::Offset<
             getProfilingMeta(taskName, 3, profiling_meta);
 
             if ((profiling_meta[2] != "PROFTASKBEGIN") && (profiling_meta[2] != "PROFBEGIN")) {
-                unsigned layerNumber = 0;
-                TaskInfo profInfoItem = TaskInfo();
+                ProfiledTask profiledTask = ProfiledTask();
+                auto& profInfoItem = profiledTask.prototype;
                 profInfoItem.layer_type[0] = '\0';
                 profInfoItem.exec_type = TaskInfo::ExecType::DMA;
-
-                layerNumber = stoi(profiling_meta[2]);
-                unsigned lastDMAid = stoi(profiling_meta[1]);
-                auto currentDMAid = layerNumber * 2 - 1;
-
-                if ((currentDMAid >= output_len / sizeof(uint32_t)) || (lastDMAid >= output_len / sizeof(uint32_t))) {
-                    continue;
-                }
-                // Use unsigned 32-bit arithmetic to automatically avoid overflow
-                uint32_t diff = output_bin[currentDMAid] - output_bin[lastDMAid];
-                // Catch otherflow and increase otherflow shift for absolute start time
-                if (last_time > 0x7F000000 && output_bin[lastDMAid] < 0x7F000000) {
-                    overflow_shift += 0x100000000;
-                }
-                last_time = output_bin[lastDMAid];
-
-                taskName = taskName.substr(0, taskName.find("_PROF"));
-                auto typeLen = sizeof(profInfoItem.name) / sizeof(profInfoItem.name[0]);
-                auto length = taskName.copy(profInfoItem.name, typeLen, 0);
-                profInfoItem.name[length] = '\0';
-                // Convert to us //
-                profInfoItem.start_time_ns =
-                        (uint64_t)(((uint64_t)output_bin[lastDMAid] + overflow_shift) * 1000 / frc_speed_mhz);
-                profInfoItem.duration_ns = (uint64_t)((uint64_t)diff * 1000 / frc_speed_mhz);
                 profInfoItem.task_id = dma_taskListId;
 
-                profInfo.push_back(profInfoItem);
+                unsigned layerNumber = stoi(profiling_meta[2]);
+                profiledTask.lastPos = stoi(profiling_meta[1]);
+                profiledTask.pos = layerNumber * 2 - 1;
+
+                setTaskName(profInfoItem, taskName.substr(0, taskName.find("_PROF")));
+                tasks.push_back(profiledTask);
             }
         }
     }
-}
 
-static void parseUPATaskProfiling(const flatbuffers::Vector<flatbuffers::Offset<MVCNN::Task>>* upa_taskList,
-                                  const void* output, size_t output_len, double frc_speed_mhz,
-                                  std::vector<TaskInfo>& profInfo) {
-    struct upa_data_t {
-        uint64_t begin;
-        uint64_t end;
-        uint32_t stall_cycles;
-        uint32_t active_cycles;
-    };
+    return tasks;
+}
 
-    if (upa_taskList == nullptr) {
-        return;
+static std::vector<ProfiledTask> collectComputeTasks(const TaskList* taskList, TaskInfo::ExecType execType) {
+    std::vector<ProfiledTask> tasks;
+    if (taskList == nullptr) {
+        return tasks;
     }
-    auto output_upa = reinterpret_cast<const upa_data_t*>(output);
 
-    for (unsigned upa_taskListId = 0; upa_taskListId < (*upa_taskList).size(); upa_taskListId++) {
-        auto task = (*upa_taskList)[upa_taskListId];
+    for (unsigned taskListId = 0; taskListId < (*taskList).size(); taskListId++) {
+        auto task = (*taskList)[taskListId];
         auto taskName = task->name()->str();
         std::string profiling_meta[2];
         getProfilingMeta(taskName, 2, profiling_meta);
@@ -193,142 +183,237 @@ static void parseUPATaskProfiling(const flatbuffers::Vector<flatbuffers::Offset<
             if (!taskName.empty() && taskName[taskName.length() - 1] == '/') {
                 taskName.pop_back();
             }
-            unsigned currentPos = stoi(profiling_meta[1]);
 
-            if (currentPos >= output_len / sizeof(upa_data_t) ||
-                (output_upa[currentPos].begin == 0 && output_upa[currentPos].end == 0)) {
-                continue;
-            }
+            ProfiledTask profiledTask = ProfiledTask();
+            profiledTask.pos = stoi(profiling_meta[1]);
 
-            TaskInfo profInfoItem = TaskInfo();
-            auto softLayer = task->task_as_UPALayerTask();
-            if (softLayer != nullptr) {
-                const auto typeLen = sizeof(profInfoItem.layer_type);
-                const char* typeName = EnumNameSoftwareLayerParams(softLayer->softLayerParams_type());
-                if (typeName != nullptr) {
-                    strncpy(profInfoItem.layer_type, typeName, typeLen - 1);
+            auto& profInfoItem = profiledTask.prototype;
+            profInfoItem.layer_type[0] = '\0';
+            if (execType == TaskInfo::ExecType::SW) {
+                auto softLayer = task->task_as_UPALayerTask();
+                if (softLayer != nullptr) {
+                    const auto typeLen = sizeof(profInfoItem.layer_type);
+                    const char* typeName = EnumNameSoftwareLayerParams(softLayer->softLayerParams_type());
+                    if (typeName != nullptr) {
+                        strncpy(profInfoItem.layer_type, typeName, typeLen - 1);
+                    }
                 }
-            } else {
-                profInfoItem.layer_type[0] = '\0';
             }
-            profInfoItem.exec_type = TaskInfo::ExecType::SW;
-            uint64_t diff = output_upa[currentPos].end - output_upa[currentPos].begin;
-            profInfoItem.start_time_ns = (uint64_t)(output_upa[currentPos].begin * 1000 / frc_speed_mhz);
-            profInfoItem.duration_ns = (uint64_t)(diff * 1000 / frc_speed_mhz);
-            profInfoItem.active_cycles = output_upa[currentPos].active_cycles;
-            profInfoItem.stall_cycles = output_upa[currentPos].stall_cycles;
-            profInfoItem.task_id = upa_taskListId;
-
-            const auto nameLen = sizeof(profInfoItem.name) / sizeof(profInfoItem.name[0]);
-            const auto length = taskName.copy(profInfoItem.name, nameLen, 0);
-            profInfoItem.name[length] = '\0';
-            profInfo.push_back(profInfoItem);
+            profInfoItem.exec_type = execType;
+            profInfoItem.task_id = taskListId;
+            setTaskName(profInfoItem, taskName);
+
+            tasks.push_back(profiledTask);
         }
     }
+
+    return tasks;
 }
 
-static void parseDPUTaskProfiling(const flatbuffers::Vector<flatbuffers::Offset<MVCNN::Task>>* dpu_taskList,
-                                  const void* output, size_t output_len, double frc_speed_mhz,
-                                  std::vector<TaskInfo>& profInfo) {
-    struct dpu_data_t {
+static void parseDMATaskProfiling(const std::vector<ProfiledTask>& dmaTasks, const void* output, size_t output_len,
+                                  double frc_speed_mhz, std::vector<TaskInfo>& profInfo) {
+    auto output_bin = reinterpret_cast<const uint32_t*>(output);
+    uint64_t overflow_shift = 0;
+    uint32_t last_time = 0;
+
+    for (const auto& dmaTask : dmaTasks) {
+        const auto currentDMAid = dmaTask.pos;
+        const auto lastDMAid = dmaTask.lastPos;
+
+        if ((currentDMAid >= output_len / sizeof(uint32_t)) || (lastDMAid >= output_len / sizeof(uint32_t))) {
+            continue;
+        }
+        // Use unsigned 32-bit arithmetic to automatically avoid overflow
+        uint32_t diff = output_bin[currentDMAid] - output_bin[lastDMAid];
+        // Catch otherflow and increase otherflow shift for absolute start time
+        if (last_time > 0x7F000000 && output_bin[lastDMAid] < 0x7F000000) {
+            overflow_shift += 0x100000000;
+        }
+        last_time = output_bin[lastDMAid];
+
+        TaskInfo profInfoItem = dmaTask.prototype;
+        // Convert to us //
+        profInfoItem.start_time_ns =
+                (uint64_t)(((uint64_t)output_bin[lastDMAid] + overflow_shift) * 1000 / frc_speed_mhz);
+        profInfoItem.duration_ns = (uint64_t)((uint64_t)diff * 1000 / frc_speed_mhz);
+
+        profInfo.push_back(profInfoItem);
+    }
+}
+
+static void parseUPATaskProfiling(const std::vector<ProfiledTask>& upaTasks, const void* output, size_t output_len,
+                                  double frc_speed_mhz, std::vector<TaskInfo>& profInfo) {
+    struct upa_data_t {
         uint64_t begin;
         uint64_t end;
+        uint32_t stall_cycles;
+        uint32_t active_cycles;
     };
 
-    if (dpu_taskList == nullptr) {
-        return;
+    auto output_upa = reinterpret_cast<const upa_data_t*>(output);
+
+    for (const auto& upaTask : upaTasks) {
+        const auto currentPos = upaTask.pos;
+
+        if (currentPos >= output_len / sizeof(upa_data_t) ||
+            (output_upa[currentPos].begin == 0 && output_upa[currentPos].end == 0)) {
+            continue;
+        }
+
+        TaskInfo profInfoItem = upaTask.prototype;
+        uint64_t diff = output_upa[currentPos].end - output_upa[currentPos].begin;
+        profInfoItem.start_time_ns = (uint64_t)(output_upa[currentPos].begin * 1000 / frc_speed_mhz);
+        profInfoItem.duration_ns = (uint64_t)(diff * 1000 / frc_speed_mhz);
+        profInfoItem.active_cycles = output_upa[currentPos].active_cycles;
+        profInfoItem.stall_cycles = output_upa[currentPos].stall_cycles;
+
+        profInfo.push_back(profInfoItem);
     }
-    auto output_dpu = reinterpret_cast<const dpu_data_t*>(output);
+}
 
-    for (unsigned dpu_taskListId = 0; dpu_taskListId < (*dpu_taskList).size(); dpu_taskListId++) {
-        auto task = (*dpu_taskList)[dpu_taskListId];
-        auto taskName = task->name()->str();
-        std::string profiling_meta[2];
-        getProfilingMeta(taskName, 2, profiling_meta);
+static void parseDPUTaskProfiling(const std::vector<ProfiledTask>& dpuTasks, const void* output, size_t output_len,
+                                  double frc_speed_mhz, std::vector<TaskInfo>& profInfo) {
+    struct dpu_data_t {
+        uint64_t begin;
+        uint64_t end;
+    };
 
-        if (profiling_meta[0] == "PROF") {
-            taskName = taskName.substr(0, taskName.find("_PROF"));
-            if (!taskName.empty() && taskName[taskName.length() - 1] == '/') {
-                taskName.pop_back();
-            }
-            unsigned currentPos = stoi(profiling_meta[1]);
+    auto output_dpu = reinterpret_cast<const dpu_data_t*>(output);
 
-            if (currentPos >= output_len / sizeof(dpu_data_t) ||
-                (output_dpu[currentPos].begin == 0 && output_dpu[currentPos].end == 0)) {
-                continue;
-            }
+    for (const auto& dpuTask : dpuTasks) {
+        const auto currentPos = dpuTask.pos;
 
-            TaskInfo profInfoItem = TaskInfo();
-            profInfoItem.layer_type[0] = '\0';
-            profInfoItem.exec_type = TaskInfo::ExecType::DPU;
-            uint64_t diff = output_dpu[currentPos].end - output_dpu[currentPos].begin;
-            profInfoItem.start_time_ns = (uint64_t)(output_dpu[currentPos].begin * 1000 / frc_speed_mhz);
-            profInfoItem.duration_ns = (uint64_t)(diff * 1000 / frc_speed_mhz);
-            profInfoItem.active_cycles = 0;
-            profInfoItem.stall_cycles = 0;
-            profInfoItem.task_id = dpu_taskListId;
-
-            auto typeLen = sizeof(profInfoItem.name) / sizeof(profInfoItem.name[0]);
-            auto length = taskName.copy(profInfoItem.name, typeLen, 0);
-            profInfoItem.name[length] = '\0';
-            profInfo.push_back(profInfoItem);
+        if (currentPos >= output_len / sizeof(dpu_data_t) ||
+            (output_dpu[currentPos].begin == 0 && output_dpu[currentPos].end == 0)) {
+            continue;
         }
+
+        TaskInfo profInfoItem = dpuTask.prototype;
+        uint64_t diff = output_dpu[currentPos].end - output_dpu[currentPos].begin;
+        profInfoItem.start_time_ns = (uint64_t)(output_dpu[currentPos].begin * 1000 / frc_speed_mhz);
+        profInfoItem.duration_ns = (uint64_t)(diff * 1000 / frc_speed_mhz);
+        profInfoItem.active_cycles = 0;
+        profInfoItem.stall_cycles = 0;
+
+        profInfo.push_back(profInfoItem);
     }
 }
 
-std::vector<TaskInfo> vpux::profiling::getTaskInfo(const uint8_t* blobData, size_t blobSize, const uint8_t* profData,
-                                                   size_t profSize, TaskType type) {
+static std::string getLayerName(const TaskInfo& task) {
+    std::string taskName = std::string(task.name);
+    const auto outputPos = taskName.rfind("/output tile");
+    const auto inputPos = taskName.rfind("/input");
+    const auto tilePos = taskName.rfind("tile [");
+    if (outputPos != std::string::npos) {
+        taskName.erase(outputPos);
+    } else if (inputPos != std::string::npos && tilePos != std::string::npos) {
+        taskName.erase(inputPos);
+    }
+    return taskName;
+}
+
+//
+// ProfilingDecoder
+//
+
+struct vpux::profiling::ProfilingDecoder::Impl {
+    double frc_speed_mhz = 0;
+
+    const TaskList* dma_taskList = nullptr;
+    const TaskList* dpu_taskList = nullptr;
+    const TaskList* upa_taskList = nullptr;
+
+    // Offsets of different profiling types in the profiling output
+    std::vector<std::pair<TaskInfo::ExecType, uint32_t>> offsets;
+
+    std::vector<ProfiledTask> dmaTasks;
+    std::vector<ProfiledTask> upaTasks;
+    std::vector<ProfiledTask> dpuTasks;
+};
+
+vpux::profiling::ProfilingDecoder::ProfilingDecoder(const uint8_t* blobData, size_t blobSize) {
     (void)blobSize;
 
-    if ((nullptr == blobData) || (nullptr == profData)) {
+    if (nullptr == blobData) {
         VPUX_THROW("Empty input data");
     }
 
+    auto impl = std::make_unique<Impl>();
+
     const auto* graphFile = MVCNN::GetGraphFile(blobData);
     // Obtaining FRC speed from blob //
-    auto frc_speed_mhz = get_frc_speed(graphFile);
+    impl->frc_speed_mhz = get_frc_speed(graphFile);
 
     // Finding of corresponding task list //
-    const flatbuffers::Vector<flatbuffers::Offset<MVCNN::Task>>* dma_taskList = nullptr;
-    const flatbuffers::Vector<flatbuffers::Offset<MVCNN::Task>>* dpu_taskList = nullptr;
-    const flatbuffers::Vector<flatbuffers::Offset<MVCNN::Task>>* upa_taskList = nullptr;
     auto task_lists = graphFile->task_lists();
     VPUX_THROW_UNLESS(task_lists, "Blob contains no task_lists");
     for (auto task_list_item : *task_lists) {
         auto task0_type = task_list_item->content()->Get(0)->task_type();
         if (task0_type == MVCNN::SpecificTask_NNDMATask) {
-            dma_taskList = task_list_item->content();
+            impl->dma_taskList = task_list_item->content();
         }
         if (task0_type == MVCNN::SpecificTask_NCE2Task) {
-            dpu_taskList = task_list_item->content();
+            impl->dpu_taskList = task_list_item->content();
         }
         if (task0_type == MVCNN::SpecificTask_UPALayerTask) {
-            upa_taskList = task_list_item->content();
+            impl->upa_taskList = task_list_item->content();
         }
     }
 
-    std::vector<TaskInfo> taskInfo;
+    impl->offsets = get_profilings_offets(graphFile);
 
-    // Finding offsets of different profiling type in the profiling output //
-    const auto offsets = get_profilings_offets(graphFile);
-    for (size_t i = 0; i < offsets.size(); i++) {
-        auto offset = offsets[i];
+    impl->dmaTasks = collectDMATasks(impl->dma_taskList);
+    impl->upaTasks = collectComputeTasks(impl->upa_taskList, TaskInfo::ExecType::SW);
+    impl->dpuTasks = collectComputeTasks(impl->dpu_taskList, TaskInfo::ExecType::DPU);
+
+    _impl = std::move(impl);
+}
+
+vpux::profiling::ProfilingDecoder::~ProfilingDecoder() = default;
+
+std::vector<TaskInfo> vpux::profiling::ProfilingDecoder::getTaskInfo(const uint8_t* profData, size_t profSize,
+                                                                     TaskType type) const {
+    if (nullptr == profData) {
+        VPUX_THROW("Empty input data");
+    }
+
+    const auto& offsets = _impl->offsets;
+    const auto frc_speed_mhz = _impl->frc_speed_mhz;
+    const auto* dma_taskList = _impl->dma_taskList;
+    const auto* dpu_taskList = _impl->dpu_taskList;
+    const auto* upa_taskList = _impl->upa_taskList;
+
+    // Sections are independent, decode them in parallel and concatenate in the order of the profiling output
+    std::vector<std::vector<TaskInfo>> sectionsInfo(offsets.size());
+    loop_1d(LoopExecPolicy::Parallel, static_cast<int64_t>(offsets.size()), [&](int64_t i) {
+        const auto& offset = offsets[i];
         size_t len;
-        if (i < offsets.size() - 1) {
+        if (static_cast<size_t>(i) < offsets.size() - 1) {
             len = offsets[i + 1].second - offset.second;
         } else {
             len = profSize - offset.second;
         }
 
+        auto& sectionInfo = sectionsInfo[i];
         if (offset.first == TaskInfo::ExecType::DMA && (type == TaskType::ALL || type == TaskType::DMA)) {
-            parseDMATaskProfiling(dma_taskList, profData + offset.second, len, frc_speed_mhz, taskInfo);
+            parseDMATaskProfiling(_impl->dmaTasks, profData + offset.second, len, frc_speed_mhz, sectionInfo);
         }
         if (offset.first == TaskInfo::ExecType::SW && (type == TaskType::ALL || type == TaskType::DPU_SW)) {
-            parseUPATaskProfiling(upa_taskList, profData + offset.second, len, frc_speed_mhz, taskInfo);
+            parseUPATaskProfiling(_impl->upaTasks, profData + offset.second, len, frc_speed_mhz, sectionInfo);
         }
         if (offset.first == TaskInfo::ExecType::DPU && (type == TaskType::ALL || type == TaskType::DPU_SW)) {
-            parseDPUTaskProfiling(dpu_taskList, profData + offset.second, len, frc_speed_mhz, taskInfo);
+            parseDPUTaskProfiling(_impl->dpuTasks, profData + offset.second, len, frc_speed_mhz, sectionInfo);
         }
+    });
+
+    std::vector<TaskInfo> taskInfo;
+    size_t numTasks = 0;
+    for (const auto& sectionInfo : sectionsInfo) {
+        numTasks += sectionInfo.size();
+    }
+    taskInfo.reserve(numTasks);
+    for (const auto& sectionInfo : sectionsInfo) {
+        taskInfo.insert(taskInfo.end(), sectionInfo.begin(), sectionInfo.end());
     }
 
     struct LayerTimes {
@@ -341,26 +426,19 @@ std::vector<TaskInfo> vpux::profiling::getTaskInfo(const uint8_t* blobData, size
         uint64_t task_start_ns;
         const flatbuffers::Vector<uint32_t>* task_wait_barriers_list;
     };
-    std::map<std::string, LayerTimes> layerInfoTimes;
+    std::unordered_map<std::string, LayerTimes> layerInfoTimes;
 
     for (auto& task : taskInfo) {
         if (task.exec_type == TaskInfo::ExecType::DMA) {
             continue;
         }
 
-        LayerTimes* layer;
-        auto name = std::string(task.name);
+        auto& layer = layerInfoTimes[task.name];
 
-        auto it = layerInfoTimes.find(name);
-        if (it == layerInfoTimes.end()) {
-            layerInfoTimes[name] = LayerTimes();
-        }
-        layer = &layerInfoTimes[name];
-
-        if (task.start_time_ns < layer->task_start_ns) {
-            layer->task_start_ns = task.start_time_ns;
+        if (task.start_time_ns < layer.task_start_ns) {
+            layer.task_start_ns = task.start_time_ns;
             auto taskList = (task.exec_type == TaskInfo::ExecType::DPU) ? dpu_taskList : upa_taskList;
-            layer->task_wait_barriers_list = (*taskList)[task.task_id]->associated_barriers()->wait_barriers();
+            layer.task_wait_barriers_list = (*taskList)[task.task_id]->associated_barriers()->wait_barriers();
         }
     }
 
@@ -383,27 +461,25 @@ std::vector<TaskInfo> vpux::profiling::getTaskInfo(const uint8_t* blobData, size
         // Finding DMA to DPU/SW timers synchronisation points.
         // DMA task should update and DPU task should wait for the same barrier within one layer
         auto task_end_ns = task.start_time_ns + task.duration_ns;
-        LayerTimes* layer;
-        auto name = std::string(task.name);
 
-        auto it = layerInfoTimes.find(name);
+        auto it = layerInfoTimes.find(task.name);
         if (it == layerInfoTimes.end()) {
             continue;
         }
-        layer = &layerInfoTimes[name];
+        auto& layer = it->second;
 
         if (dma_taskList == nullptr) {
             continue;
         }
 
         auto barriersList = (*dma_taskList)[task.task_id]->associated_barriers()->update_barriers();
-        if (barriersList == nullptr || layer->task_wait_barriers_list == nullptr) {
+        if (barriersList == nullptr || layer.task_wait_barriers_list == nullptr) {
             continue;
         }
-        for (auto barrier : *layer->task_wait_barriers_list) {
+        for (auto barrier : *layer.task_wait_barriers_list) {
             if (std::find((*barriersList).cbegin(), (*barriersList).cend(), barrier) != (*barriersList).cend()) {
-                if (task_end_ns > layer->dma_end_ns) {
-                    layer->dma_end_ns = task_end_ns;
+                if (task_end_ns > layer.dma_end_ns) {
+                    layer.dma_end_ns = task_end_ns;
                 }
             }
         }
@@ -444,6 +520,24 @@ std::vector<TaskInfo> vpux::profiling::getTaskInfo(const uint8_t* blobData, size
     return taskInfo;
 }
 
+std::vector<LayerInfo> vpux::profiling::ProfilingDecoder::getLayerInfo(const uint8_t* profData,
+                                                                       size_t profSize) const {
+    return vpux::profiling::getLayerInfo(getTaskInfo(profData, profSize, TaskType::ALL));
+}
+
+//
+// Free functions
+//
+
+std::vector<TaskInfo> vpux::profiling::getTaskInfo(const uint8_t* blobData, size_t blobSize, const uint8_t* profData,
+                                                   size_t profSize, TaskType type) {
+    if ((nullptr == blobData) || (nullptr == profData)) {
+        VPUX_THROW("Empty input data");
+    }
+
+    return ProfilingDecoder(blobData, blobSize).getTaskInfo(profData, profSize, type);
+}
+
 std::vector<LayerInfo> vpux::profiling::getLayerInfo(const uint8_t* blobData, size_t blobSize, const uint8_t* profData,
                                                      size_t profSize) {
     std::vector<TaskInfo> taskInfo = getTaskInfo(blobData, blobSize, profData, profSize, TaskType::ALL);
@@ -453,22 +547,15 @@ std::vector<LayerInfo> vpux::profiling::getLayerInfo(const uint8_t* blobData, si
 
 std::vector<LayerInfo> vpux::profiling::getLayerInfo(const std::vector<TaskInfo>& taskInfo) {
     std::vector<LayerInfo> layerInfo;
+    // Index of the layer in layerInfo by its name
+    std::unordered_map<std::string, size_t> layerIndex;
+
     for (auto& task : taskInfo) {
+        const auto taskName = getLayerName(task);
+
         LayerInfo* layer;
-        std::string taskName = std::string(task.name);
-        const auto outputPos = taskName.rfind("/output tile");
-        const auto inputPos = taskName.rfind("/input");
-        const auto tilePos = taskName.rfind("tile [");
-        if (outputPos != std::string::npos) {
-            taskName.erase(outputPos);
-        } else if (inputPos != std::string::npos && tilePos != std::string::npos) {
-            taskName.erase(inputPos);
-        }
-
-        auto result = std::find_if(begin(layerInfo), end(layerInfo), [&](LayerInfo item) {
-            return taskName == item.name;
-        });
-        if (result == end(layerInfo)) {
+        const auto result = layerIndex.emplace(taskName, layerInfo.size());
+        if (result.second) {
             LayerInfo info = LayerInfo();
             taskName.copy(info.name, sizeof(info.name) - 1);
             info.name[sizeof(info.name) - 1] = '\0';
@@ -478,7 +565,7 @@ std::vector<LayerInfo> vpux::profiling::getLayerInfo(const std::vector<TaskInfo>
             layerInfo.push_back(info);
             layer = &layerInfo.back();
         } else {
-            layer = &(*result);
+            layer = &layerInfo[result.first->second];
         }
         if (task.start_time_ns < layer->start_time_ns) {
             layer->duration_ns += layer->start_time_ns - task.start_time_ns;
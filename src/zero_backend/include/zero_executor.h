@@ -10,12 +10,14 @@
 #include <cstring>  // std::memcpy for pointer-only args
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "vpux.hpp"
 #include "vpux/utils/core/logger.hpp"
+#include "vpux/utils/plugin/profiling_parser.hpp"
 #include "zero_memory.h"
 #include "zero_profiling.h"
 #include "zero_utils.h"
@@ -163,7 +165,8 @@ public:
         ~Graph();
         ze_graph_handle_t _handle = nullptr;
         ze_context_handle_t _context = nullptr;
-        const std::vector<char>& _blob;
+        const void* _blob = nullptr;
+        std::size_t _blobSize = 0;
         ze_graph_properties_t _props{};
         std::map<std::string, ArgumentDescriptor> _inputs_desc_map;
         std::map<std::string, ArgumentDescriptor> _outputs_desc_map;
@@ -171,6 +174,10 @@ public:
         CommandList _command_list;
         std::shared_ptr<Fence> _fence;
 
+        // Blob metadata for the raw profiling output, parsed on the first request and shared by all executors
+        std::once_flag _profilingDecoderFlag;
+        std::unique_ptr<vpux::profiling::ProfilingDecoder> _profilingDecoder;
+
         ze_graph_dditable_ext_t* _graph_ddi_table_ext = nullptr;
     };
 
@@ -142,10 +142,10 @@ void prepareInputForInference(const IE::Blob::Ptr& userInput, const IE::TensorDe
         logger.info("Different precisions of user and device input blobs. Conversion required from {0} to {1}",
                     userPrecision, devicePrecision);
         if (!isLayoutMatched) {
-            IE::Blob::Ptr expectedInput = toPrecision(IE::as<IE::MemoryBlob>(userInput), devicePrecision, quantParam);
             logger.info("Different layouts of user and device input blobs. Conversion required from {0} to {1}",
                         userLayout, deviceLayout);
-            toLayout(IE::as<IE::MemoryBlob>(expectedInput), deviceLayout, nullptr, destData);
+            toPrecisionAndLayout(IE::as<IE::MemoryBlob>(userInput), devicePrecision, deviceLayout, quantParam, nullptr,
+                                 destData);
         } else {
             toPrecision(IE::as<IE::MemoryBlob>(userInput), devicePrecision, quantParam, nullptr, destData);
         }
@@ -173,14 +173,7 @@ void getOutputAfterInference(IE::Blob::Ptr& userOutput, const IE::TensorDesc& de
     const auto deviceNumDims = deviceTensorDesc.getDims().size();
 
     // [OV design flaw] OV API make_blob_with_precision doesn't have any version with const source data
-    IE::Blob::Ptr expectedOutput = makeBlob(deviceTensorDesc, nullptr, const_cast<void*>(srcData));
-    if (userPrecision != devicePrecision) {
-        logger.info("Different precisions of pull blobs. Conversion required");
-        expectedOutput = toPrecision(IE::as<IE::MemoryBlob>(expectedOutput), userPrecision);
-        if (expectedOutput == nullptr) {
-            IE_THROW() << "Blob data null pointer";
-        }
-    }
+    const auto memDevice = makeBlob(deviceTensorDesc, nullptr, const_cast<void*>(srcData));
     // Default state - only memory copying is required
     auto destLayout = IE::Layout::ANY;
     if (userLayout != deviceLayout && userNumDims == deviceNumDims) {
@@ -193,28 +186,37 @@ void getOutputAfterInference(IE::Blob::Ptr& userOutput, const IE::TensorDesc& de
         // Special case - NCHW to NHWC layout conversion and memory copying
         destLayout = IE::Layout::NHWC;
     }
-    if (destLayout != IE::Layout::ANY) {
+
+    const bool isPrecisionMatched = userPrecision == devicePrecision;
+    const bool isLayoutMatched = destLayout == IE::Layout::ANY;
+    if (!isPrecisionMatched) {
+        logger.info("Different precisions of pull blobs. Conversion required");
+    }
+    if (!isLayoutMatched) {
         logger.info("Different layouts of pull blobs. Conversion required");
-        expectedOutput = toLayout(IE::as<IE::MemoryBlob>(expectedOutput), destLayout);
-        if (expectedOutput == nullptr) {
-            IE_THROW() << "Blob data null pointer";
-        }
     }
 
-    const auto memExpected = IE::as<IE::MemoryBlob>(expectedOutput);
     auto memUser = IE::as<IE::MemoryBlob>(userOutput);
-    if (memExpected == nullptr || memUser == nullptr) {
+    if (memUser == nullptr) {
         IE_THROW() << "Blob to MemoryBlob conversion error";
     }
-    auto memExpectedLock = memExpected->rmap();
+    if (memDevice->size() * userPrecision.size() != memUser->byteSize()) {
+        IE_THROW() << "Different size of pull and auxiliary blobs";
+    }
     auto memUserLock = memUser->wmap();
-    if (memExpectedLock == nullptr || memUserLock == nullptr) {
+    const auto destData = memUserLock.as<void*>();
+    if (destData == nullptr) {
         IE_THROW() << "Locking memory error";
     }
-    if (memExpected->byteSize() != memUser->byteSize()) {
-        IE_THROW() << "Different size of pull and auxiliary blobs";
-    }
-    if (0 != ie_memcpy(memUserLock, memExpected->byteSize(), memExpectedLock, memUser->byteSize())) {
+
+    // The conversions write straight into the user blob memory, there is no auxiliary blob to copy from
+    if (!isPrecisionMatched && !isLayoutMatched) {
+        toPrecisionAndLayout(memDevice, userPrecision, destLayout, vpux::None, nullptr, destData);
+    } else if (!isPrecisionMatched) {
+        toPrecision(memDevice, userPrecision, vpux::None, nullptr, destData);
+    } else if (!isLayoutMatched) {
+        toLayout(memDevice, destLayout, nullptr, destData);
+    } else if (0 != ie_memcpy(destData, memUser->byteSize(), srcData, memDevice->byteSize())) {
         IE_THROW() << "memcpy error for pull blobs";
     }
 }
@@ -341,14 +343,15 @@ ZeroExecutor::CommandList::~CommandList() {
 ZeroExecutor::Graph::Graph(const ze_device_handle_t& device_handle, const ze_context_handle_t& context,
                            const NetworkDescription::CPtr networkDesc, ze_graph_dditable_ext_t* graph_ddi_table_ext)
         : _context(context),
-          _blob(networkDesc->getCompiledNetwork()),
+          _blob(networkDesc->getNetworkModel()),
+          _blobSize(networkDesc->getNetworkModelSize()),
           _command_queue(std::make_shared<CommandQueue>(device_handle, _context, ZE_COMMAND_QUEUE_PRIORITY_NORMAL)),
           _command_list(device_handle, _context, graph_ddi_table_ext),
           _fence(std::make_shared<Fence>(_command_queue)),
           _graph_ddi_table_ext(graph_ddi_table_ext) {
     OV_ITT_SCOPED_TASK(itt::domains::LevelZeroBackend, "Executor::Graph::Graph");
-    ze_graph_desc_t desc{ZE_STRUCTURE_TYPE_GRAPH_DESC_PROPERTIES,        nullptr, ZE_GRAPH_FORMAT_NATIVE, _blob.size(),
-                         reinterpret_cast<const uint8_t*>(_blob.data()), nullptr};
+    ze_graph_desc_t desc{ZE_STRUCTURE_TYPE_GRAPH_DESC_PROPERTIES, nullptr, ZE_GRAPH_FORMAT_NATIVE, _blobSize,
+                         reinterpret_cast<const uint8_t*>(_blob), nullptr};
     zeroUtils::throwOnFail("pfnCreate", _graph_ddi_table_ext->pfnCreate(_context, device_handle, &desc, &_handle));
 
     zeroUtils::throwOnFail("pfnGetProperties", _graph_ddi_table_ext->pfnGetProperties(_handle, &_props));
@@ -699,8 +702,12 @@ std::map<std::string, IE::InferenceEngineProfileInfo> ZeroExecutor::getLayerStat
         _pipeline->_profiling[0].queryGetData(ZE_GRAPH_PROFILING_RAW, &size, rawBytes.get());
 
         // Process raw profiling data on application side
-        std::vector<vpux::profiling::LayerInfo> layerProfiling = vpux::profiling::getLayerInfo(
-                reinterpret_cast<const uint8_t*>(_graph->_blob.data()), _graph->_blob.size(), rawBytes.get(), size);
+        std::call_once(_graph->_profilingDecoderFlag, [&]() {
+            _graph->_profilingDecoder = std::make_unique<vpux::profiling::ProfilingDecoder>(
+                    reinterpret_cast<const uint8_t*>(_graph->_blob), _graph->_blobSize);
+        });
+        std::vector<vpux::profiling::LayerInfo> layerProfiling =
+                _graph->_profilingDecoder->getLayerInfo(rawBytes.get(), size);
         return vpux::profiling::convertProfilingLayersToIEInfo(layerProfiling);
     }
 }
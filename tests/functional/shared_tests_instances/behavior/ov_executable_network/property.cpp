@@ -35,13 +35,17 @@ std::vector<std::pair<std::string, ov::Any>> expected_supported_properties_exe_n
 };
 
 std::vector<ov::AnyMap> expected_supported_properties_plugin = {
+    {ov::intel_vpux::compilation_cache_dir("some/cache/dir")},
+    {ov::intel_vpux::compilation_cache_size(1024)},
     {ov::intel_vpux::compilation_descriptor("some_arbitrary")},
     {ov::intel_vpux::compilation_descriptor_path("some/path/descriptor")},
     {ov::intel_vpux::compilation_pass_ban_list("group, pass")},
     {ov::intel_vpux::concat_scales_alignment("NO")},
+    {ov::intel_vpux::const_folding_cache_size(1024)},
     {ov::intel_vpux::csram_size("0")},
     {ov::intel_vpux::custom_layers("some/xml/file.xml")},
     {ov::intel_vpux::eltwise_scales_alignment("NO")},
+    {ov::intel_vpux::import_blob_mmap("YES")},
     {ov::intel_vpux::inference_shaves(2)},
     {ov::intel_vpux::remove_permute_noop("NO")},
     {ov::intel_vpux::scale_fuse_input("NO")},
@@ -0,0 +1,56 @@
+// RUN: vpux-opt --split-input-file --init-compiler="vpu-arch=VPUX30XX compilation-mode=DefaultHW" --vertical-fusion-tiling %s | FileCheck %s
+
+#NCHW = affine_map<(d0, d1, d2, d3) -> (d0, d1, d2, d3)>
+#NHWC = affine_map<(d0, d1, d2, d3) -> (d0, d2, d3, d1)>
+
+func @FuseNCEConvChain(%arg0: tensor<1x16x256x256xf16, {order = #NHWC}>) -> tensor<1x16x256x256xf16, {order = #NHWC}> {
+    %weights0 = const.Declare tensor<16x16x1x1xf16, {order = #NHWC}> = #const.Content<dense<1.000000e+00> : tensor<16x16x1x1xf16>, [#const.Reorder<#NHWC>]>
+    %weights_table0 = const.Declare tensor<16x1x1x4xsi32, {order = #NCHW}> = #const.Content<dense<10> : tensor<16x1x1x4xsi32>>
+    %weights1 = const.Declare tensor<16x16x1x1xf16, {order = #NHWC}> = #const.Content<dense<2.000000e+00> : tensor<16x16x1x1xf16>, [#const.Reorder<#NHWC>]>
+    %weights_table1 = const.Declare tensor<16x1x1x4xsi32, {order = #NCHW}> = #const.Content<dense<20> : tensor<16x1x1x4xsi32>>
+
+    %0 = VPU.NCE.Convolution(%arg0, %weights0, %weights_table0) {
+        pad = {bottom = 0 : i64, left = 0 : i64, right = 0 : i64, top = 0 : i64},
+        rawFilterShape = [16, 16, 1, 1],
+        strides = [1, 1]
+    } -> tensor<1x16x256x256xf16, {order = #NHWC}>
+
+    %1 = VPU.NCE.Convolution(%0, %weights1, %weights_table1) {
+        pad = {bottom = 0 : i64, left = 0 : i64, right = 0 : i64, top = 0 : i64},
+        rawFilterShape = [16, 16, 1, 1],
+        strides = [1, 1]
+    } -> tensor<1x16x256x256xf16, {order = #NHWC}>
+
+    return %1 : tensor<1x16x256x256xf16, {order = #NHWC}>
+}
+
+// CHECK-LABEL:   @FuseNCEConvChain
+// CHECK-SAME:          [[INPUT:%arg[0-9]]]: tensor<1x16x256x256xf16, {order = #NHWC}>
+
+// CHECK-DAG:   [[WEIGHTS0:%.+]] = const.Declare tensor<16x16x1x1xf16, {order = #NHWC}> = #const.Content<dense<1.000000e+00>
+// CHECK-DAG:   [[WEIGHTS_TABLE0:%.+]] = const.Declare tensor<16x1x1x4xsi32> = #const.Content<dense<10>
+// CHECK-DAG:   [[WEIGHTS1:%.+]] = const.Declare tensor<16x16x1x1xf16, {order = #NHWC}> = #const.Content<dense<2.000000e+00>
+// CHECK-DAG:   [[WEIGHTS_TABLE1:%.+]] = const.Declare tensor<16x1x1x4xsi32> = #const.Content<dense<20>
+
+// Tile 0
+
+// CHECK:       [[INPUT_TILE0:%.+]] = IE.Slice [[INPUT]] [0, 0, 0, 0]
+// CHECK:       [[CONV0_TILE0:%.+]] = VPU.NCE.Convolution([[INPUT_TILE0]], [[WEIGHTS0]], [[WEIGHTS_TABLE0]])
+// CHECK-SAME:          verticalFusionApplied = true
+// CHECK:       [[CONV1_TILE0:%.+]] = VPU.NCE.Convolution([[CONV0_TILE0]], [[WEIGHTS1]], [[WEIGHTS_TABLE1]])
+// CHECK-SAME:          verticalFusionApplied = true
+
+// Tile 1
+
+// CHECK:       [[INPUT_TILE1:%.+]] = IE.Slice [[INPUT]]
+// CHECK:       [[CONV0_TILE1:%.+]] = VPU.NCE.Convolution([[INPUT_TILE1]], [[WEIGHTS0]], [[WEIGHTS_TABLE0]])
+// CHECK-SAME:          verticalFusionApplied = true
+// CHECK:       [[CONV1_TILE1:%.+]] = VPU.NCE.Convolution([[CONV0_TILE1]], [[WEIGHTS1]], [[WEIGHTS_TABLE1]])
+// CHECK-SAME:          verticalFusionApplied = true
+
+// Concat
+
+// CHECK:       [[OUTPUT:%.+]] = IE.Concat([[CONV1_TILE0]], [[CONV1_TILE1]]
+// CHECK-SAME:          -> tensor<1x16x256x256xf16, {order = #NHWC}>
+
+// CHECK:       return [[OUTPUT]] : tensor<1x16x256x256xf16, {order = #NHWC}>
@@ -1,6 +1,8 @@
 // RUN: vpux-opt --split-input-file --init-compiler="vpu-arch=VPUX30XX" --static-allocation="memory-space=DDR" %s | FileCheck %s
+// RUN: vpux-opt --split-input-file --init-compiler="vpu-arch=VPUX30XX" --static-allocation="memory-space=DDR offline-packing=true" %s | FileCheck %s --check-prefix=PACK
 
 // CHECK-LABEL: @LinearGraph
+// PACK-LABEL: @LinearGraph
 module @LinearGraph {
 
 IE.CNNNetwork
@@ -15,6 +17,9 @@ IE.CNNNetwork
 // CHECK:   module @UsedMemory
 // CHECK:           IE.MemoryResource 4096 bytes of @DDR
 
+// The linear scan placement is already optimal, offline packing keeps it
+// PACK:            IE.MemoryResource 4096 bytes of @DDR
+
 func @main(%in: memref<1x1000xf16>, %out: memref<1x1000xf16>) -> memref<1x1000xf16> {
     %buf0 = memref.alloc() : memref<1x1000xf16, @DDR>
     %buf1 = memref.alloc() : memref<1x1000xf16, @DDR>
@@ -50,6 +55,10 @@ func @main(%in: memref<1x1000xf16>, %out: memref<1x1000xf16>) -> memref<1x1000xf
     // CHECK:       [[BUF1:%.*]] = IERT.StaticAlloc<2048> -> memref<1x1000xf16, @DDR>
     // CHECK:       [[BUF2:%.*]] = IERT.StaticAlloc<0> -> memref<1x1000xf16, @DDR>
 
+    // PACK:        IERT.StaticAlloc<0> -> memref<1x1000xf16, @DDR>
+    // PACK:        IERT.StaticAlloc<2048> -> memref<1x1000xf16, @DDR>
+    // PACK:        IERT.StaticAlloc<0> -> memref<1x1000xf16, @DDR>
+
     // CHECK:       IERT.ReLU
     // CHECK-SAME:      outputs([[BUF0]] : memref<1x1000xf16, @DDR>)
 
@@ -63,3 +72,78 @@ func @main(%in: memref<1x1000xf16>, %out: memref<1x1000xf16>) -> memref<1x1000xf
 }
 
 }
+
+// -----
+
+// CHECK-LABEL: @FragmentedGraph
+// PACK-LABEL: @FragmentedGraph
+module @FragmentedGraph {
+
+IE.CNNNetwork
+    entryPoint : @main
+    inputsInfo : {
+        DataInfo "data" : tensor<1x1000xf16>
+    }
+    outputsInfo : {
+        DataInfo "prob" : tensor<1x1000xf32>
+    }
+
+// The linear scan leaves the gap of the first buffer below the second one, the third buffer doesn't fit there.
+// Offline packing places the third buffer at the bottom and the second one above it.
+
+// CHECK:   module @UsedMemory
+// CHECK:           IE.MemoryResource 8128 bytes of @DDR
+
+// PACK:    module @UsedMemory
+// PACK:            IE.MemoryResource 6080 bytes of @DDR
+
+func @main(%in: memref<1x1000xf16>, %out: memref<1x1000xf32>) -> memref<1x1000xf32> {
+    %buf0 = memref.alloc() : memref<1x1000xf16, @DDR>
+    %buf1 = memref.alloc() : memref<1x1000xf16, @DDR>
+    %buf2 = memref.alloc() : memref<1x1000xf32, @DDR>
+
+    %t0, %f0 = async.execute -> !async.value<memref<1x1000xf16, @DDR>> {
+        %0 = IERT.ReLU inputs(%in : memref<1x1000xf16>) outputs(%buf0 : memref<1x1000xf16, @DDR>) -> memref<1x1000xf16, @DDR>
+        async.yield %0 : memref<1x1000xf16, @DDR>
+    }
+
+    %t1, %f1 = async.execute [%t0] (%f0 as %0 : !async.value<memref<1x1000xf16, @DDR>>)
+            -> !async.value<memref<1x1000xf16, @DDR>> {
+        %1 = IERT.ReLU inputs(%0: memref<1x1000xf16, @DDR>) outputs(%buf1 : memref<1x1000xf16, @DDR>) -> memref<1x1000xf16, @DDR>
+        async.yield %1 : memref<1x1000xf16, @DDR>
+    }
+
+    %t2, %f2 = async.execute [%t1] (%f1 as %1 : !async.value<memref<1x1000xf16, @DDR>>)
+            -> !async.value<memref<1x1000xf32, @DDR>> {
+        %2 = IERT.Convert inputs(%1: memref<1x1000xf16, @DDR>) outputs(%buf2 : memref<1x1000xf32, @DDR>) -> memref<1x1000xf32, @DDR>
+        async.yield %2 : memref<1x1000xf32, @DDR>
+    }
+
+    %t3, %f3 = async.execute [%t2] (%f2 as %2 : !async.value<memref<1x1000xf32, @DDR>>)
+            -> !async.value<memref<1x1000xf32>> {
+        %3 = IERT.Copy inputs(%2 : memref<1x1000xf32, @DDR>) outputs(%out : memref<1x1000xf32>) -> memref<1x1000xf32>
+        async.yield %3 : memref<1x1000xf32>
+    }
+
+    %3 = async.await %f3 : !async.value<memref<1x1000xf32>>
+    return %3 : memref<1x1000xf32>
+
+    // CHECK:       [[BUF0:%.*]] = IERT.StaticAlloc<0> -> memref<1x1000xf16, @DDR>
+    // CHECK:       [[BUF1:%.*]] = IERT.StaticAlloc<2048> -> memref<1x1000xf16, @DDR>
+    // CHECK:       [[BUF2:%.*]] = IERT.StaticAlloc<4096> -> memref<1x1000xf32, @DDR>
+
+    // PACK:        [[BUF0:%.*]] = IERT.StaticAlloc<0> -> memref<1x1000xf16, @DDR>
+    // PACK:        [[BUF1:%.*]] = IERT.StaticAlloc<4032> -> memref<1x1000xf16, @DDR>
+    // PACK:        [[BUF2:%.*]] = IERT.StaticAlloc<0> -> memref<1x1000xf32, @DDR>
+
+    // PACK:        IERT.ReLU
+    // PACK-SAME:       outputs([[BUF0]] : memref<1x1000xf16, @DDR>)
+
+    // PACK:        IERT.ReLU
+    // PACK-SAME:       outputs([[BUF1]] : memref<1x1000xf16, @DDR>)
+
+    // PACK:        IERT.Convert
+    // PACK-SAME:       outputs([[BUF2]] : memref<1x1000xf32, @DDR>)
+}
+
+}
@@ -0,0 +1,75 @@
+// RUN: vpux-opt --split-input-file --init-compiler="vpu-arch=VPUX30XX compilation-mode=DefaultHW" --estimate-weights-sparsity %s | FileCheck %s
+
+#NHWC = affine_map<(d0, d1, d2, d3) -> (d0, d2, d3, d1)>
+
+// CHECK-LABEL: @SparseWeights
+func @SparseWeights(%arg0: tensor<1x16x16x16xf16, {order = #NHWC}>) -> tensor<1x16x16x16xf16, {order = #NHWC}> {
+    %cst0 = const.Declare tensor<16x16x1x1xf16, {order = #NHWC}> =
+        #const.Content<dense<0.000000e+00> : tensor<16x16x1x1xf16>, [#const.Reorder<#NHWC>]>
+    %wt = const.Declare tensor<16x1x1x4xsi32, {order = #NHWC}> =
+        #const.Content<dense<10> : tensor<16x1x1x4xsi32>, [#const.Reorder<#NHWC>]>
+
+    %0 = IE.Copy(%arg0) {out_mem_space = @CMX_NN} : tensor<1x16x16x16xf16, {order = #NHWC}>
+        -> tensor<1x16x16x16xf16, {mem_space = @CMX_NN, order = #NHWC}>
+    %1 = IE.Copy(%cst0) {out_mem_space = @CMX_NN} : tensor<16x16x1x1xf16, {order = #NHWC}>
+        -> tensor<16x16x1x1xf16, {mem_space = @CMX_NN, order = #NHWC}>
+    %2 = IE.Copy(%wt) {out_mem_space = @CMX_NN} : tensor<16x1x1x4xsi32, {order = #NHWC}>
+        -> tensor<16x1x1x4xsi32, {mem_space = @CMX_NN, order = #NHWC}>
+    %3 = VPU.NCE.Convolution(%0, %1, %2) {
+            pad = {bottom = 0 : i64, left = 0 : i64, right = 0 : i64, top = 0 : i64},
+            rawFilterShape = [16, 16, 1, 1],
+            strides = [1, 1]
+        } : tensor<1x16x16x16xf16, {mem_space = @CMX_NN, order = #NHWC}>,
+            tensor<16x16x1x1xf16, {mem_space = @CMX_NN, order = #NHWC}>,
+            tensor<16x1x1x4xsi32, {mem_space = @CMX_NN, order = #NHWC}>
+        -> tensor<1x16x16x16xf16, {mem_space = @CMX_NN, order = #NHWC}>
+
+    %4 = IE.Copy(%3) : tensor<1x16x16x16xf16, {mem_space = @CMX_NN, order = #NHWC}>
+        -> tensor<1x16x16x16xf16, {order = #NHWC}>
+
+    return %4 : tensor<1x16x16x16xf16, {order = #NHWC}>
+
+    // The estimation doesn't change the IR
+
+    // CHECK:       VPU.NCE.Convolution
+    // CHECK-SAME:      rawFilterShape = [16, 16, 1, 1]
+    // CHECK-SAME:      strides = [1, 1]
+    // CHECK-SAME:      -> tensor<1x16x16x16xf16, {mem_space = @CMX_NN, order = #NHWC}>
+}
+
+// -----
+
+#NHWC = affine_map<(d0, d1, d2, d3) -> (d0, d2, d3, d1)>
+
+// CHECK-LABEL: @DenseWeights
+func @DenseWeights(%arg0: tensor<1x16x16x16xf16, {order = #NHWC}>) -> tensor<1x16x16x16xf16, {order = #NHWC}> {
+    %cst0 = const.Declare tensor<16x16x1x1xf16, {order = #NHWC}> =
+        #const.Content<dense<1.000000e+00> : tensor<16x16x1x1xf16>, [#const.Reorder<#NHWC>]>
+    %wt = const.Declare tensor<16x1x1x4xsi32, {order = #NHWC}> =
+        #const.Content<dense<10> : tensor<16x1x1x4xsi32>, [#const.Reorder<#NHWC>]>
+
+    %0 = IE.Copy(%arg0) {out_mem_space = @CMX_NN} : tensor<1x16x16x16xf16, {order = #NHWC}>
+        -> tensor<1x16x16x16xf16, {mem_space = @CMX_NN, order = #NHWC}>
+    %1 = IE.Copy(%cst0) {out_mem_space = @CMX_NN} : tensor<16x16x1x1xf16, {order = #NHWC}>
+        -> tensor<16x16x1x1xf16, {mem_space = @CMX_NN, order = #NHWC}>
+    %2 = IE.Copy(%wt) {out_mem_space = @CMX_NN} : tensor<16x1x1x4xsi32, {order = #NHWC}>
+        -> tensor<16x1x1x4xsi32, {mem_space = @CMX_NN, order = #NHWC}>
+    %3 = VPU.NCE.Convolution(%0, %1, %2) {
+            pad = {bottom = 0 : i64, left = 0 : i64, right = 0 : i64, top = 0 : i64},
+            rawFilterShape = [16, 16, 1, 1],
+            strides = [1, 1]
+        } : tensor<1x16x16x16xf16, {mem_space = @CMX_NN, order = #NHWC}>,
+            tensor<16x16x1x1xf16, {mem_space = @CMX_NN, order = #NHWC}>,
+            tensor<16x1x1x4xsi32, {mem_space = @CMX_NN, order = #NHWC}>
+        -> tensor<1x16x16x16xf16, {mem_space = @CMX_NN, order = #NHWC}>
+
+    %4 = IE.Copy(%3) : tensor<1x16x16x16xf16, {mem_space = @CMX_NN, order = #NHWC}>
+        -> tensor<1x16x16x16xf16, {order = #NHWC}>
+
+    return %4 : tensor<1x16x16x16xf16, {order = #NHWC}>
+
+    // CHECK:       VPU.NCE.Convolution
+    // CHECK-SAME:      rawFilterShape = [16, 16, 1, 1]
+    // CHECK-SAME:      strides = [1, 1]
+    // CHECK-SAME:      -> tensor<1x16x16x16xf16, {mem_space = @CMX_NN, order = #NHWC}>
+}
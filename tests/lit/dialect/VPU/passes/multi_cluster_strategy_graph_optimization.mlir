@@ -0,0 +1,85 @@
+// RUN: vpux-opt --split-input-file --init-compiler="vpu-arch=VPUX30XX compilation-mode=DefaultHW" --multi-cluster-strategy-assignment="graph-optimization=true" %s | FileCheck %s
+
+#NHWC = affine_map<(d0, d1, d2, d3) -> (d0, d2, d3, d1)>
+
+// CHECK-LABEL: @ConvChainAssignedSOH
+func @ConvChainAssignedSOH(%arg0: tensor<1x48x28x28xf16, {order = #NHWC}>) -> tensor<1x48x28x28xf16, {order = #NHWC}> {
+    %cst = const.Declare tensor<48x1x1x4xsi32> = #const.Content<dense<10> : tensor<48x1x1x4xsi32>>
+    %cst_0 = const.Declare tensor<48x48x1x1xf16, {order = #NHWC}> = #const.Content<dense<1.000000e+00> : tensor<48x48x1x1xf16>, [#const.Reorder<#NHWC>]>
+    %0 = VPU.NCE.Convolution(%arg0, %cst_0, %cst) {pad = {bottom = 0 : i64, left = 0 : i64, right = 0 : i64, top = 0 : i64}, rawFilterShape = [48, 48, 1, 1], strides = [1, 1]} -> tensor<1x48x28x28xf16, {order = #NHWC}>
+    %1 = VPU.NCE.Convolution(%0, %cst_0, %cst) {pad = {bottom = 0 : i64, left = 0 : i64, right = 0 : i64, top = 0 : i64}, rawFilterShape = [48, 48, 1, 1], strides = [1, 1]} -> tensor<1x48x28x28xf16, {order = #NHWC}>
+    return %1 : tensor<1x48x28x28xf16, {order = #NHWC}>
+
+    //CHECK:        [[VAL0:%.+]] = VPU.NCE.Convolution(%arg0, %cst_0, %cst)
+    //CHECK-SAME:    {multiClusterStrategy = "SplitOverHeight", pad = {bottom = 0 : i64, left = 0 : i64, right = 0 : i64, top = 0 : i64}, rawFilterShape = [48, 48, 1, 1], strides = [1, 1]}
+    //CHECK-SAME:      -> tensor<1x48x28x28xf16, {order = #NHWC}>
+
+    //CHECK:        [[VAL1:%.+]] = VPU.NCE.Convolution([[VAL0]], %cst_0, %cst)
+    //CHECK-SAME:    {multiClusterStrategy = "SplitOverHeight", pad = {bottom = 0 : i64, left = 0 : i64, right = 0 : i64, top = 0 : i64}, rawFilterShape = [48, 48, 1, 1], strides = [1, 1]}
+    //CHECK-SAME:      -> tensor<1x48x28x28xf16, {order = #NHWC}>
+
+    //CHECK:        return [[VAL1]] : tensor<1x48x28x28xf16, {order = #NHWC}>
+}
+
+// -----
+
+#NHWC = affine_map<(d0, d1, d2, d3) -> (d0, d2, d3, d1)>
+
+// The producer alone is assigned SOK (see @ConvAssignedSOK in multi_cluster_strategy_assignment.mlir).
+// The consumer has too few output channels for SOK, so the SOK output would be spilled to DDR and read back
+// for it. The transition cost makes the producer follow the consumer with SOH.
+
+// CHECK-LABEL: @SOKProducerFollowsSOHConsumer
+func @SOKProducerFollowsSOHConsumer(%arg0: tensor<1x128x28x28xf16, {order = #NHWC}>) -> tensor<1x48x28x28xf16, {order = #NHWC}> {
+    %cst = const.Declare tensor<64x1x1x4xsi32> = #const.Content<dense<10> : tensor<64x1x1x4xsi32>>
+    %cst_0 = const.Declare tensor<64x128x1x1xf16, {order = #NHWC}> = #const.Content<dense<1.000000e+00> : tensor<64x128x1x1xf16>, [#const.Reorder<#NHWC>]>
+    %cst_1 = const.Declare tensor<48x1x1x4xsi32> = #const.Content<dense<10> : tensor<48x1x1x4xsi32>>
+    %cst_2 = const.Declare tensor<48x64x1x1xf16, {order = #NHWC}> = #const.Content<dense<1.000000e+00> : tensor<48x64x1x1xf16>, [#const.Reorder<#NHWC>]>
+    %0 = VPU.NCE.Convolution(%arg0, %cst_0, %cst) {pad = {bottom = 0 : i64, left = 0 : i64, right = 0 : i64, top = 0 : i64}, rawFilterShape = [64, 128, 1, 1], strides = [1, 1]} -> tensor<1x64x28x28xf16, {order = #NHWC}>
+    %1 = VPU.NCE.Convolution(%0, %cst_2, %cst_1) {pad = {bottom = 0 : i64, left = 0 : i64, right = 0 : i64, top = 0 : i64}, rawFilterShape = [48, 64, 1, 1], strides = [1, 1]} -> tensor<1x48x28x28xf16, {order = #NHWC}>
+    return %1 : tensor<1x48x28x28xf16, {order = #NHWC}>
+
+    //CHECK:        [[VAL0:%.+]] = VPU.NCE.Convolution(%arg0, %cst_0, %cst)
+    //CHECK-SAME:    {multiClusterStrategy = "SplitOverHeight", pad = {bottom = 0 : i64, left = 0 : i64, right = 0 : i64, top = 0 : i64}, rawFilterShape = [64, 128, 1, 1], strides = [1, 1]}
+    //CHECK-SAME:      -> tensor<1x64x28x28xf16, {order = #NHWC}>
+
+    //CHECK:        [[VAL1:%.+]] = VPU.NCE.Convolution([[VAL0]], %cst_2, %cst_1)
+    //CHECK-SAME:    {multiClusterStrategy = "SplitOverHeight", pad = {bottom = 0 : i64, left = 0 : i64, right = 0 : i64, top = 0 : i64}, rawFilterShape = [48, 64, 1, 1], strides = [1, 1]}
+    //CHECK-SAME:      -> tensor<1x48x28x28xf16, {order = #NHWC}>
+
+    //CHECK:        return [[VAL1]] : tensor<1x48x28x28xf16, {order = #NHWC}>
+}
+
+// -----
+
+#NHWC = affine_map<(d0, d1, d2, d3) -> (d0, d2, d3, d1)>
+
+// The eltwise joins two branches, so the region is not a chain and is solved by the beam search.
+// Any Clustering layer would need its SOH input or output to be spilled, so all the layers stay SOH.
+
+// CHECK-LABEL: @DiamondWithEltwise
+func @DiamondWithEltwise(%arg0: tensor<1x48x28x28xf16, {order = #NHWC}>) -> tensor<1x48x28x28xf16, {order = #NHWC}> {
+    %cst = const.Declare tensor<48x1x1x4xsi32> = #const.Content<dense<10> : tensor<48x1x1x4xsi32>>
+    %cst_0 = const.Declare tensor<48x48x1x1xf16, {order = #NHWC}> = #const.Content<dense<1.000000e+00> : tensor<48x48x1x1xf16>, [#const.Reorder<#NHWC>]>
+    %0 = VPU.NCE.Convolution(%arg0, %cst_0, %cst) {pad = {bottom = 0 : i64, left = 0 : i64, right = 0 : i64, top = 0 : i64}, rawFilterShape = [48, 48, 1, 1], strides = [1, 1]} -> tensor<1x48x28x28xf16, {order = #NHWC}>
+    %1 = VPU.NCE.Convolution(%0, %cst_0, %cst) {pad = {bottom = 0 : i64, left = 0 : i64, right = 0 : i64, top = 0 : i64}, rawFilterShape = [48, 48, 1, 1], strides = [1, 1]} -> tensor<1x48x28x28xf16, {order = #NHWC}>
+    %2 = VPU.NCE.Convolution(%0, %cst_0, %cst) {pad = {bottom = 0 : i64, left = 0 : i64, right = 0 : i64, top = 0 : i64}, rawFilterShape = [48, 48, 1, 1], strides = [1, 1]} -> tensor<1x48x28x28xf16, {order = #NHWC}>
+    %3 = VPU.NCE.Eltwise(%1, %2) { op_type = "ADD" } :
+         tensor<1x48x28x28xf16, {order = #NHWC}>, tensor<1x48x28x28xf16, {order = #NHWC}>
+         -> tensor<1x48x28x28xf16, {order = #NHWC}>
+    return %3 : tensor<1x48x28x28xf16, {order = #NHWC}>
+
+    //CHECK:        [[VAL0:%.+]] = VPU.NCE.Convolution(%arg0, %cst_0, %cst)
+    //CHECK-SAME:    {multiClusterStrategy = "SplitOverHeight"
+
+    //CHECK:        [[VAL1:%.+]] = VPU.NCE.Convolution([[VAL0]], %cst_0, %cst)
+    //CHECK-SAME:    {multiClusterStrategy = "SplitOverHeight"
+
+    //CHECK:        [[VAL2:%.+]] = VPU.NCE.Convolution([[VAL0]], %cst_0, %cst)
+    //CHECK-SAME:    {multiClusterStrategy = "SplitOverHeight"
+
+    //CHECK:        [[VAL3:%.+]] = VPU.NCE.Eltwise([[VAL1]], [[VAL2]]) {multiClusterStrategy = "SplitOverHeight", op_type = "ADD"}
+    //CHECK-SAME:      -> tensor<1x48x28x28xf16, {order = #NHWC}>
+
+    //CHECK:        return [[VAL3]] : tensor<1x48x28x28xf16, {order = #NHWC}>
+}
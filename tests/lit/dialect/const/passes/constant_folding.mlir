@@ -1,4 +1,5 @@
 // RUN: vpux-opt --split-input-file --constant-folding %s | FileCheck %s
+// RUN: vpux-opt --split-input-file --mlir-disable-threading --constant-folding %s | FileCheck %s
 
 !qElemType = type !quant.uniform<u8:f16, 0.0039215686274509803>
 #map = affine_map<(d0, d1, d2, d3) -> (d2, d3, d0, d1)>
@@ -44,3 +45,26 @@ func @QuantConstFold() -> memref<16x3x1x1x!qElemType, #map> {
     // CHECK-SAME:       {order = #map}>
     // CHECK:       return [[CST]]
 }
+
+// -----
+
+#map = affine_map<(d0, d1, d2, d3) -> (d2, d3, d0, d1)>
+
+func @SharedContentFold() -> (memref<16x3x1x1xf16, #map>, memref<16x3x1x1xf16, #map>) {
+    %0 = const.Declare memref<16x3x1x1xf16, #map> =
+        #const.Content<dense<2.0> : tensor<16x3x1x1xf32>, [#const.ConvertElemType<f16>, #const.Reorder<#map>]>
+    %1 = const.Declare memref<16x3x1x1xf16, #map> =
+        #const.Content<dense<2.0> : tensor<16x3x1x1xf32>, [#const.ConvertElemType<f16>, #const.Reorder<#map>]>
+
+    return %0, %1 : memref<16x3x1x1xf16, #map>, memref<16x3x1x1xf16, #map>
+
+    // CHECK:       [[CST0:%.*]] = const.Declare memref<16x3x1x1xf16, #map>
+    // CHECK-SAME:       #const.Content<dense<
+    // CHECK-SAME:       tensor<16x3x1x1xf16
+    // CHECK-SAME:       {order = #map}>
+    // CHECK:       [[CST1:%.*]] = const.Declare memref<16x3x1x1xf16, #map>
+    // CHECK-SAME:       #const.Content<dense<
+    // CHECK-SAME:       tensor<16x3x1x1xf16
+    // CHECK-SAME:       {order = #map}>
+    // CHECK:       return [[CST0]], [[CST1]]
+}
@@ -0,0 +1,60 @@
+//
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "vpux_mapped_blob.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+class VPUXMappedBlobUnitTests : public ::testing::Test {
+protected:
+    void TearDown() override {
+        std::remove(_fileName.c_str());
+    }
+
+    void writeFile(const std::string& content) {
+        std::ofstream file(_fileName, std::ios::binary);
+        file.write(content.data(), content.size());
+    }
+
+    const std::string _fileName = "vpux_mapped_blob_unit_test.blob";
+};
+
+TEST_F(VPUXMappedBlobUnitTests, canMapBlobWithoutExportHeader) {
+    const std::string content = "compiled network";
+    writeFile(content);
+
+    const auto blob = vpux::MappedBlob::open(_fileName);
+    ASSERT_NE(nullptr, blob);
+    ASSERT_EQ(content, std::string(blob->data(), blob->size()));
+}
+
+TEST_F(VPUXMappedBlobUnitTests, skipsExportHeader) {
+    const std::string content = "compiled network";
+    writeFile(std::string("\x01\x0E\x0E\x01") + "network_name\n" + content);
+
+    const auto blob = vpux::MappedBlob::open(_fileName);
+    ASSERT_NE(nullptr, blob);
+    ASSERT_EQ(content, std::string(blob->data(), blob->size()));
+}
+
+TEST_F(VPUXMappedBlobUnitTests, sharesMappingOfSameFile) {
+    writeFile("compiled network");
+
+    const auto first = vpux::MappedBlob::open(_fileName);
+    const auto second = vpux::MappedBlob::open(_fileName);
+    ASSERT_EQ(first, second);
+    ASSERT_EQ(first->data(), second->data());
+}
+
+TEST_F(VPUXMappedBlobUnitTests, throwsOnMissingOrEmptyFile) {
+    ASSERT_ANY_THROW(vpux::MappedBlob::open(_fileName));
+
+    writeFile("");
+    ASSERT_ANY_THROW(vpux::MappedBlob::open(_fileName));
+}
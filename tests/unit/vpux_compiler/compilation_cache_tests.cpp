@@ -0,0 +1,101 @@
+//
+// Copyright (C) 2022 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+//
+
+#include "vpux/compiler/compilation_cache.hpp"
+
+#include <llvm/Support/FileSystem.h>
+
+#include <ngraph/ngraph.hpp>
+#include <ngraph/opsets/opset6.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace vpux;
+
+namespace {
+
+std::shared_ptr<ngraph::Function> buildFunction(float bias) {
+    // The automatic names are unique per node and function instance, so the functions built separately differ in them
+    const auto data = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{1, 2, 3, 4});
+    data->set_friendly_name("data");
+    const auto biasConst = ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{1}, {bias});
+    biasConst->set_friendly_name("bias");
+    const auto add = std::make_shared<ngraph::opset6::Add>(data, biasConst);
+    add->set_friendly_name("add");
+    const auto result = std::make_shared<ngraph::opset6::Result>(add);
+    result->set_friendly_name("result");
+    return std::make_shared<ngraph::Function>(ngraph::ResultVector{result}, ngraph::ParameterVector{data}, "net");
+}
+
+size_t countBlobs(StringRef dirPath) {
+    size_t count = 0;
+    std::error_code ec;
+    for (llvm::sys::fs::directory_iterator it(dirPath, ec), end; it != end && !ec; it.increment(ec)) {
+        ++count;
+    }
+    return count;
+}
+
+class MLIR_CompilationCacheTests : public testing::Test {
+protected:
+    void SetUp() override {
+        SmallString path;
+        ASSERT_FALSE(llvm::sys::fs::createUniqueDirectory("vpux-compilation-cache", path));
+        _dirPath = path.str().str();
+    }
+
+    void TearDown() override {
+        llvm::sys::fs::remove_directories(_dirPath);
+    }
+
+    std::string _dirPath;
+};
+
+}  // namespace
+
+TEST_F(MLIR_CompilationCacheTests, Key) {
+    const InferenceEngine::InputsDataMap inputsInfo;
+    const InferenceEngine::OutputsDataMap outputsInfo;
+
+    const auto key = CompilationCache::getKey(buildFunction(1.0f), inputsInfo, outputsInfo, "mode=DefaultHW");
+
+    EXPECT_EQ(key, CompilationCache::getKey(buildFunction(1.0f), inputsInfo, outputsInfo, "mode=DefaultHW"));
+    EXPECT_NE(key, CompilationCache::getKey(buildFunction(2.0f), inputsInfo, outputsInfo, "mode=DefaultHW"));
+    EXPECT_NE(key, CompilationCache::getKey(buildFunction(1.0f), inputsInfo, outputsInfo, "mode=ReferenceSW"));
+}
+
+TEST_F(MLIR_CompilationCacheTests, StoreAndLoad) {
+    CompilationCache cache(_dirPath, 0, Logger::global());
+
+    EXPECT_EQ(cache.load("key"), nullptr);
+
+    const std::vector<char> blob(100, 'b');
+    cache.store("key", blob);
+
+    const auto loaded = cache.load("key");
+    ASSERT_NE(loaded, nullptr);
+    ASSERT_EQ(loaded->size(), blob.size());
+    EXPECT_TRUE(std::equal(blob.begin(), blob.end(), loaded->data()));
+}
+
+TEST_F(MLIR_CompilationCacheTests, Eviction) {
+    CompilationCache cache(_dirPath, 250, Logger::global());
+
+    const std::vector<char> blob(100, 'b');
+    cache.store("first", blob);
+    cache.store("second", blob);
+    cache.store("third", blob);
+
+    // The blob being stored is never evicted
+    EXPECT_EQ(countBlobs(_dirPath), 2);
+    EXPECT_NE(cache.load("third"), nullptr);
+
+    // Blobs above the limit are not stored at all
+    const std::vector<char> largeBlob(300, 'l');
+    cache.store("large", largeBlob);
+    EXPECT_EQ(cache.load("large"), nullptr);
+}
@@ -0,0 +1,142 @@
+//
+// Copyright (C) 2022 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+//
+
+#include "vpux/compiler/core/async_deps_info.hpp"
+
+#include "vpux/utils/core/checked_cast.hpp"
+#include "vpux/utils/core/small_vector.hpp"
+
+#include <mlir/Dialect/Async/IR/Async.h>
+#include <mlir/Dialect/StandardOps/IR/Ops.h>
+#include <mlir/IR/BuiltinOps.h>
+#include <mlir/IR/MLIRContext.h>
+#include <mlir/Parser.h>
+
+#include <llvm/ADT/BitVector.h>
+#include <llvm/ADT/STLExtras.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <sstream>
+
+using namespace vpux;
+
+namespace {
+
+using DepsGraph = SmallVector<SmallVector<size_t>>;
+
+// Operations depend mostly on the nearby ones, with some long range dependencies, like the unrolled graphs
+DepsGraph generateGraph(size_t numOps) {
+    std::mt19937 gen(42);
+
+    DepsGraph deps(numOps);
+    for (size_t opInd = 1; opInd < numOps; ++opInd) {
+        const auto numDeps = gen() % 4;
+        for (size_t i = 0; i < numDeps; ++i) {
+            const auto window = std::min<size_t>(opInd, 16);
+            const auto depInd = gen() % 8 == 0 ? gen() % opInd : opInd - 1 - gen() % window;
+            deps[opInd].push_back(depInd);
+        }
+        llvm::sort(deps[opInd]);
+        deps[opInd].erase(std::unique(deps[opInd].begin(), deps[opInd].end()), deps[opInd].end());
+    }
+    return deps;
+}
+
+std::string printGraph(const DepsGraph& deps) {
+    std::ostringstream ir;
+    ir << "module @test {\n";
+    ir << "    func @main() {\n";
+    for (size_t opInd = 0; opInd < deps.size(); ++opInd) {
+        ir << "        %t" << opInd << " = async.execute ";
+        if (!deps[opInd].empty()) {
+            ir << "[";
+            for (size_t i = 0; i < deps[opInd].size(); ++i) {
+                ir << (i == 0 ? "" : ", ") << "%t" << deps[opInd][i];
+            }
+            ir << "] ";
+        }
+        ir << "{\n            async.yield\n        }\n";
+    }
+    ir << "        return\n";
+    ir << "    }\n";
+    ir << "}\n";
+    return ir.str();
+}
+
+// Keeps the dependencies, which are not reachable from the other dependencies
+DepsGraph referenceReduction(const DepsGraph& deps) {
+    const auto numOps = checked_cast<uint32_t>(deps.size());
+
+    SmallVector<llvm::BitVector> closure(numOps, llvm::BitVector(numOps));
+    for (size_t opInd = 0; opInd < numOps; ++opInd) {
+        for (auto depInd : deps[opInd]) {
+            closure[opInd].set(depInd);
+            closure[opInd] |= closure[depInd];
+        }
+    }
+
+    DepsGraph reduced(numOps);
+    for (size_t opInd = 0; opInd < numOps; ++opInd) {
+        for (auto depInd : deps[opInd]) {
+            const auto isImplicit = llvm::any_of(deps[opInd], [&](size_t otherInd) {
+                return otherInd != depInd && closure[otherInd].test(depInd);
+            });
+            if (!isImplicit) {
+                reduced[opInd].push_back(depInd);
+            }
+        }
+    }
+    return reduced;
+}
+
+void checkOptimizeDepsMap(size_t numOps) {
+    mlir::DialectRegistry registry;
+    registry.insert<mlir::async::AsyncDialect>();
+    registry.insert<mlir::StandardOpsDialect>();
+
+    mlir::MLIRContext ctx(registry);
+
+    const auto deps = generateGraph(numOps);
+
+    auto module = mlir::parseSourceString(printGraph(deps), &ctx);
+    ASSERT_TRUE(module.get() != nullptr);
+
+    auto func = module.get().lookupSymbol<mlir::FuncOp>("main");
+    ASSERT_TRUE(func != nullptr);
+
+    AsyncDepsInfo info(func);
+    info.optimizeDepsMap();
+
+    const auto reduced = referenceReduction(deps);
+    for (size_t opInd = 0; opInd < numOps; ++opInd) {
+        ASSERT_EQ(info.getOpDeps(opInd), reduced[opInd]) << "Operation " << opInd;
+    }
+
+    info.buildConsMap();
+    const auto outDegree = info.calculateOpOutDegreeTable();
+    for (size_t opInd = 0; opInd < numOps; ++opInd) {
+        for (auto depInd : reduced[opInd]) {
+            const auto consumers = info.getConsumerOps(depInd);
+            EXPECT_TRUE(llvm::is_contained(consumers, opInd));
+            EXPECT_EQ(outDegree.at(depInd), consumers.size());
+        }
+    }
+}
+
+}  // namespace
+
+TEST(MLIR_AsyncDepsInfo, OptimizeDepsMapSmallGraph) {
+    checkOptimizeDepsMap(500);
+}
+
+// Above the limit of the dense transitive closure
+TEST(MLIR_AsyncDepsInfo, OptimizeDepsMapLargeGraph) {
+    checkOptimizeDepsMap(10000);
+}
@@ -11,6 +11,8 @@
 #include "vpux/compiler/dialect/VPUIP/dpu_tiler.hpp"
 #include "vpux/compiler/init.hpp"
 
+#include "vpux/utils/core/range.hpp"
+
 #include <file_utils.h>
 #include <llvm/ADT/SmallString.h>
 #include <llvm/Support/FileSystem.h>
@@ -100,3 +102,38 @@ TEST(MLIR_VPU_WorkloadCost, VPUNNCostInterface) {
         }
     }
 }
+
+TEST(MLIR_VPU_WorkloadCost, BatchedCostsMatchSingleQueries) {
+    mlir::MLIRContext ctx;
+
+    const auto costModel = vpux::VPU::createCostModel(vpux::VPU::ArchKind::VPUX30XX);
+    vpux::VPUIP::WorkloadCostCache costCache(costModel);
+
+    const NceOpTensorShape testTensor(vpux::ShapeRef({1, 64, 32, 32}), vpux::ShapeRef({1, 64, 32, 32}));
+    const auto costParams = buildWorkloadCost(testTensor, &ctx);
+
+    vpux::VPUIP::DpuTiler dpuTiler(costParams.outputShape, vpux::VPU::MPEMode::VECTOR);
+
+    vpux::VPUIP::WorkloadSplitPool splitPoolSet;
+    dpuTiler.tileOverH(numDPU, splitPoolSet);
+    for (auto& splitNum : dpuTiler.generateSplitNumberPool(numDPU, maxSplitNum)) {
+        dpuTiler.tileOverZ(splitNum, splitPoolSet);
+    }
+    const auto splitPool = vpux::to_std_vector(splitPoolSet);
+
+    const auto splitCosts = vpux::VPUIP::computeSplitCosts(splitPool, costParams, costCache);
+    ASSERT_EQ(splitCosts.size(), splitPool.size());
+
+    size_t numWorkloads = 0;
+    for (const auto ind : vpux::irange(splitPool.size())) {
+        EXPECT_EQ(splitCosts[ind], vpux::VPUIP::computeSplitCost(splitPool[ind], costParams, costModel));
+        numWorkloads += splitPool[ind].size();
+    }
+
+    // Identical workloads are queried only once
+    const auto numCachedWorkloads = costCache.size();
+    EXPECT_LE(numCachedWorkloads, numWorkloads);
+
+    vpux::VPUIP::computeSplitCosts(splitPool, costParams, costCache);
+    EXPECT_EQ(costCache.size(), numCachedWorkloads);
+}
@@ -0,0 +1,135 @@
+//
+// Copyright (C) 2022 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+//
+
+#include "vpux/compiler/dialect/const/ops.hpp"
+#include "vpux/compiler/dialect/const/utils/content_cache.hpp"
+#include "vpux/compiler/init.hpp"
+
+#include <mlir/IR/MLIRContext.h>
+
+#include <gtest/gtest.h>
+
+using namespace vpux;
+
+namespace {
+
+Const::ContentAttr createContent(mlir::MLIRContext* ctx, ArrayRef<float> vals) {
+    const auto baseType =
+            mlir::RankedTensorType::get({checked_cast<int64_t>(vals.size())}, mlir::Float32Type::get(ctx));
+    const auto baseAttr = mlir::DenseElementsAttr::get(baseType, vals);
+    return Const::ContentAttr::get(baseAttr).rescale(2.0);
+}
+
+Const::ContentAttr createContent(mlir::MLIRContext* ctx, int64_t size, float val) {
+    const std::vector<float> vals(checked_cast<size_t>(size), val);
+    return createContent(ctx, makeArrayRef(vals));
+}
+
+std::unique_ptr<mlir::MLIRContext> createContext() {
+    mlir::DialectRegistry registry;
+    registerDialects(registry);
+
+    auto ctx = std::make_unique<mlir::MLIRContext>(registry);
+    ctx->loadDialect<Const::ConstDialect>();
+    return ctx;
+}
+
+}  // namespace
+
+TEST(MLIR_ConstFoldedContentCache, HitAcrossContexts) {
+    Const::FoldedContentCache cache(1_MB);
+    Const::FoldedContentCache::Statistics stats;
+
+    const auto ctx1 = createContext();
+    const auto buf1 = cache.getOrFold(createContent(ctx1.get(), 16, 1.0f), stats);
+    ASSERT_NE(buf1, nullptr);
+    EXPECT_EQ(buf1->size(), 16 * sizeof(float));
+    EXPECT_EQ(reinterpret_cast<const float*>(buf1->data())[0], 2.0f);
+
+    // The content is stored only once it is requested for the second time
+    const auto ctx2 = createContext();
+    const auto buf2 = cache.getOrFold(createContent(ctx2.get(), 16, 1.0f), stats);
+    EXPECT_EQ(cache.getUsedSize(), Byte(16 * sizeof(float)));
+
+    const auto buf3 = cache.getOrFold(createContent(ctx2.get(), 16, 1.0f), stats);
+    EXPECT_EQ(buf2, buf3);
+
+    const auto buf4 = cache.getOrFold(createContent(ctx2.get(), 16, 3.0f), stats);
+    EXPECT_NE(buf3, buf4);
+    EXPECT_EQ(reinterpret_cast<const float*>(buf4->data())[0], 6.0f);
+
+    EXPECT_EQ(stats.hits, 1u);
+    EXPECT_EQ(stats.misses, 3u);
+    EXPECT_EQ(cache.getUsedSize(), Byte(16 * sizeof(float)));
+}
+
+TEST(MLIR_ConstFoldedContentCache, DistinguishSameSizeContents) {
+    const auto ctx = createContext();
+    Const::FoldedContentCache cache(1_MB);
+    Const::FoldedContentCache::Statistics stats;
+
+    std::vector<float> vals(64, 1.0f);
+    const auto first = createContent(ctx.get(), vals);
+    vals.back() = 5.0f;
+    const auto second = createContent(ctx.get(), vals);
+
+    cache.getOrFold(first, stats);
+    cache.getOrFold(first, stats);
+
+    const auto buf = cache.getOrFold(second, stats);
+    EXPECT_EQ(reinterpret_cast<const float*>(buf->data())[63], 10.0f);
+    EXPECT_EQ(stats.hits, 0u);
+}
+
+TEST(MLIR_ConstFoldedContentCache, EvictLeastRecentlyUsed) {
+    const auto ctx = createContext();
+
+    const int64_t size = 256;
+    const auto entrySize = Byte(size * sizeof(float));
+    Const::FoldedContentCache cache(entrySize * 2);
+    Const::FoldedContentCache::Statistics stats;
+
+    const auto first = createContent(ctx.get(), size, 1.0f);
+    const auto second = createContent(ctx.get(), size, 2.0f);
+    const auto third = createContent(ctx.get(), size, 3.0f);
+
+    for (const auto& content : {first, second, first, third, third}) {
+        cache.getOrFold(content, stats);
+        cache.getOrFold(content, stats);
+    }
+
+    EXPECT_EQ(stats.evictions, 1u);
+    EXPECT_EQ(cache.getUsedSize(), entrySize * 2);
+
+    // `second` was the least recently used entry
+    const auto hits = stats.hits;
+    cache.getOrFold(first, stats);
+    EXPECT_EQ(stats.hits, hits + 1);
+
+    const auto misses = stats.misses;
+    cache.getOrFold(second, stats);
+    EXPECT_EQ(stats.misses, misses + 1);
+}
+
+TEST(MLIR_ConstFoldedContentCache, FoldWithoutContextCache) {
+    const auto ctx = createContext();
+    const auto content = createContent(ctx.get(), 16, 1.0f);
+
+    const auto buf = Const::foldContent(content);
+    EXPECT_EQ(reinterpret_cast<const float*>(buf->data())[0], 2.0f);
+
+    auto* dialect = ctx->getLoadedDialect<Const::ConstDialect>();
+    EXPECT_EQ(dialect->getFoldedContentCache(), nullptr);
+
+    dialect->setFoldedContentCache(std::make_shared<Const::FoldedContentCache>(1_MB));
+    Const::foldContent(content);
+    Const::foldContent(content);
+    Const::foldContent(content);
+
+    EXPECT_EQ(dialect->getFoldedContentCacheStatistics().hits, 1u);
+    EXPECT_EQ(dialect->getFoldedContentCacheStatistics().misses, 2u);
+}
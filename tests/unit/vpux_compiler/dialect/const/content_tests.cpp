@@ -1013,3 +1013,84 @@ TEST_F(MLIR_ConstContentAttrTest, SparsifyQuntized) {
 
     EXPECT_TRUE(std::equal(actVals.begin(), actVals.end(), expectedResult.begin()));
 }
+
+TEST_F(MLIR_ConstContentAttrTest, FusedElementWiseChain) {
+    const auto baseType = mlir::RankedTensorType::get({1, 2, 3, 4}, mlir::Float32Type::get(&ctx));
+
+    const float scale = 0.5f;
+    const float bias = 10.0f;
+    const auto vals = generateValues<float>(baseType.getNumElements());
+    std::vector<float> expectedVals(vals.size());
+    std::transform(vals.begin(), vals.end(), expectedVals.begin(), [&](float item) {
+        return item * scale + bias;
+    });
+
+    const auto baseAttr = mlir::DenseElementsAttr::get(baseType, makeArrayRef(vals));
+
+    const auto baseContentAttr = Const::ContentAttr::get(baseAttr);
+    ASSERT_NE(baseContentAttr, nullptr);
+
+    const auto contentAttr =
+            baseContentAttr.convertElemType(mlir::Float16Type::get(&ctx)).rescale(scale).add(bias);
+    ASSERT_NE(contentAttr, nullptr);
+
+    const auto content = contentAttr.fold();
+    EXPECT_EQ(content.getType(), contentAttr.getType());
+    EXPECT_FALSE(content.isSplat());
+
+    const auto contentVals = content.getValues<float>();
+    EXPECT_EQ(contentVals.size(), vals.size());
+
+    for (size_t i = 0; i < contentVals.size(); ++i) {
+        EXPECT_EQ(contentVals[i], expectedVals[i]);
+    }
+}
+
+TEST_F(MLIR_ConstContentAttrTest, FusedIndexRemappingChain) {
+    const int64_t IC = 2;
+    const int64_t IH = 3;
+    const int64_t IW = 4;
+    const auto baseType = mlir::RankedTensorType::get({1, IC, IH, IW}, getSInt32Type(&ctx));
+
+    const auto vals = generateValues<int32_t>(baseType.getNumElements());
+    const auto baseAttr = mlir::DenseElementsAttr::get(baseType, makeArrayRef(vals));
+
+    const auto baseContentAttr = Const::ContentAttr::get(baseAttr);
+    ASSERT_NE(baseContentAttr, nullptr);
+
+    const int64_t OFF_H = 1;
+    const int64_t OFF_W = 1;
+    const int64_t SH = 2;
+    const int64_t SW = 2;
+    const int64_t PH = 1;
+    const int64_t PW = 1;
+
+    const auto contentAttr = baseContentAttr.subview({0, 0, OFF_H, OFF_W}, {1, IC, SH, SW})
+                                     .reorder(DimsOrder::NHWC)
+                                     .padWithZero({0, 0, PH, PW}, {0, 0, PH, PW});
+    ASSERT_NE(contentAttr, nullptr);
+
+    const auto content = contentAttr.fold();
+    EXPECT_EQ(content.getType(), contentAttr.getType());
+    EXPECT_FALSE(content.isSplat());
+
+    const int64_t OH = SH + 2 * PH;
+    const int64_t OW = SW + 2 * PW;
+
+    const auto contentVals = content.getValues<int32_t>();
+    EXPECT_EQ(contentVals.size(), checked_cast<size_t>(IC * OH * OW));
+
+    for (int64_t c = 0; c < IC; ++c) {
+        for (int64_t h = 0; h < OH; ++h) {
+            for (int64_t w = 0; w < OW; ++w) {
+                const auto newIndex = c + w * IC + h * IC * OW;
+                if (h < PH || h >= SH + PH || w < PW || w >= SW + PW) {
+                    EXPECT_EQ(contentVals[newIndex], 0) << c << " " << h << " " << w;
+                } else {
+                    const auto origIndex = (w - PW + OFF_W) + (h - PH + OFF_H) * IW + c * IW * IH;
+                    EXPECT_EQ(contentVals[newIndex], vals[origIndex]) << c << " " << h << " " << w;
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,112 @@
+//
+// Copyright (C) 2022 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+//
+
+#include "vpux/compiler/utils/offline_packing.hpp"
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+using namespace vpux;
+
+namespace {
+
+PackingBuffer makeBuffer(size_t firstUse, size_t lastUse, AddressType size, AddressType alignment = 1) {
+    PackingBuffer buf;
+    buf.firstUse = firstUse;
+    buf.lastUse = lastUse;
+    buf.size = size;
+    buf.alignment = alignment;
+    return buf;
+}
+
+void checkPlacement(ArrayRef<PackingBuffer> buffers, const PackingResult& result) {
+    ASSERT_EQ(result.addresses.size(), buffers.size());
+    EXPECT_GE(result.footprint, result.lowerBound);
+
+    for (size_t i = 0; i < buffers.size(); ++i) {
+        const auto addr = result.addresses[i];
+        ASSERT_NE(addr, InvalidAddress);
+        EXPECT_EQ(addr % buffers[i].alignment, 0) << "Buffer " << i;
+        EXPECT_LE(addr + buffers[i].size, result.footprint) << "Buffer " << i;
+
+        if (buffers[i].fixedAddress != InvalidAddress) {
+            EXPECT_EQ(addr, buffers[i].fixedAddress) << "Buffer " << i;
+        }
+
+        for (size_t j = 0; j < i; ++j) {
+            const auto sameTime = buffers[i].firstUse <= buffers[j].lastUse &&
+                                  buffers[j].firstUse <= buffers[i].lastUse;
+            if (sameTime) {
+                EXPECT_FALSE(Partitioner::intersects(addr, buffers[i].size, result.addresses[j], buffers[j].size))
+                        << "Buffers " << i << " and " << j;
+            }
+        }
+    }
+}
+
+}  // namespace
+
+TEST(MLIR_OfflinePackingTests, LowerBound) {
+    const SmallVector<PackingBuffer> buffers = {
+            makeBuffer(0, 1, 10),
+            makeBuffer(1, 2, 20),
+            makeBuffer(2, 3, 15),
+            makeBuffer(3, 3, 1),
+    };
+
+    // Step 2 holds the second and the third buffers
+    EXPECT_EQ(getPackingLowerBound(buffers), 35);
+}
+
+// The linear scan places the first two buffers in the order they become alive and
+// then has no room left below them for the third one: it needs 6 bytes.
+TEST(MLIR_OfflinePackingTests, ReachesLowerBound) {
+    const SmallVector<PackingBuffer> buffers = {
+            makeBuffer(0, 0, 2),
+            makeBuffer(0, 3, 1),
+            makeBuffer(1, 2, 3),
+    };
+
+    const auto result = packBuffers(buffers);
+    checkPlacement(buffers, result);
+
+    EXPECT_EQ(result.lowerBound, 4);
+    EXPECT_EQ(result.footprint, 4);
+}
+
+TEST(MLIR_OfflinePackingTests, FixedBuffers) {
+    auto fixed = makeBuffer(0, 4, 8);
+    fixed.fixedAddress = 0;
+
+    const SmallVector<PackingBuffer> buffers = {
+            makeBuffer(0, 4, 100),
+            fixed,
+            makeBuffer(2, 3, 4, 16),
+    };
+
+    const auto result = packBuffers(buffers);
+    checkPlacement(buffers, result);
+
+    EXPECT_EQ(result.addresses[1], 0);
+}
+
+TEST(MLIR_OfflinePackingTests, RandomBuffers) {
+    std::mt19937 gen(42);
+
+    SmallVector<PackingBuffer> buffers;
+    for (size_t i = 0; i < 500; ++i) {
+        const auto firstUse = gen() % 200;
+        const auto lastUse = firstUse + gen() % 20;
+        const auto size = 1 + gen() % 4096;
+        const auto alignment = gen() % 2 == 0 ? 1 : 64;
+        buffers.push_back(makeBuffer(firstUse, lastUse, size, alignment));
+    }
+
+    const auto result = packBuffers(buffers);
+    checkPlacement(buffers, result);
+}
@@ -245,3 +245,63 @@ TEST(MLIR_PartitionerTests, SimpleCases) {
         ASSERT_EQ(alloc.gaps()[0].end, 10);
     }
 }
+
+TEST(MLIR_PartitionerTests, BestFit) {
+    // Gaps: [0, 8) [16, 20) [32, 36) [48, 64) [80, 128)
+    const auto makePartitioner = []() {
+        Partitioner alloc(128);
+        alloc.allocFixed(8, 8);
+        alloc.allocFixed(20, 12);
+        alloc.allocFixed(36, 12);
+        alloc.allocFixed(64, 16);
+        return alloc;
+    };
+
+    {
+        // The smallest gap, the first one among the equal gaps
+        auto alloc = makePartitioner();
+        ASSERT_EQ(alloc.alloc(4), 16);
+        ASSERT_EQ(alloc.alloc(4), 32);
+        ASSERT_EQ(alloc.alloc(4), 0);
+        ASSERT_EQ(alloc.maxFreeSize(), 48);
+    }
+
+    {
+        // The equal gaps are visited from the top in Down direction
+        auto alloc = makePartitioner();
+        ASSERT_EQ(alloc.alloc(4, 1, Partitioner::Direction::Down), 32);
+        ASSERT_EQ(alloc.alloc(4, 1, Partitioner::Direction::Down), 16);
+    }
+
+    {
+        // The smaller gaps are skipped when the alignment does not fit them
+        auto alloc = makePartitioner();
+        ASSERT_EQ(alloc.alloc(4, 64), 0);
+        ASSERT_EQ(alloc.alloc(4, 16), 16);
+        ASSERT_EQ(alloc.alloc(4, 32), 32);
+        ASSERT_EQ(alloc.alloc(4, 64), InvalidAddress);
+    }
+
+    {
+        // The last gap in current direction is used only if no other gap fits
+        auto alloc = makePartitioner();
+        ASSERT_EQ(alloc.alloc(20), 80);
+        ASSERT_EQ(alloc.alloc(10, 1, Partitioner::Direction::Down), 54);
+        ASSERT_EQ(alloc.alloc(8, 1, Partitioner::Direction::Down), 120);
+        ASSERT_EQ(alloc.alloc(20, 1, Partitioner::Direction::Down), 100);
+        ASSERT_EQ(alloc.alloc(8, 1, Partitioner::Direction::Down), 0);
+    }
+
+    {
+        // Freeing coalesces with both neighbours
+        auto alloc = makePartitioner();
+        alloc.free(20, 12);
+        ASSERT_EQ(alloc.gaps().size(), 4);
+        ASSERT_EQ(alloc.maxFreeSize(), 48);
+        alloc.free(8, 8);
+        alloc.free(36, 12);
+        alloc.free(64, 16);
+        ASSERT_EQ(alloc.gaps().size(), 1);
+        ASSERT_EQ(alloc.totalFreeSize(), 128);
+    }
+}
@@ -0,0 +1,194 @@
+//
+// Copyright (C) 2022 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+//
+
+#include "vpux/utils/IE/blob.hpp"
+#include "vpux/utils/IE/float16.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <functional>
+#include <iostream>
+
+using namespace vpux;
+using namespace InferenceEngine;
+
+namespace {
+
+template <typename T>
+MemoryBlob::Ptr makeFilledBlob(const TensorDesc& desc) {
+    const auto blob = makeBlob(desc);
+    const auto mem = blob->wmap();
+    const auto ptr = mem.as<T*>();
+    for (size_t i = 0; i < blob->size(); ++i) {
+        ptr[i] = static_cast<T>(static_cast<float>(i % 1021));
+    }
+    return blob;
+}
+
+// Offset of the element with logical NCHW / NCDHW / CHW coordinates, computed by the blocking descriptor
+size_t getOffset(const TensorDesc& desc, const SizeVector& coords) {
+    const auto& order = desc.getBlockingDesc().getOrder();
+    const auto& strides = desc.getBlockingDesc().getStrides();
+
+    size_t offset = 0;
+    for (size_t i = 0; i < order.size(); ++i) {
+        offset += coords[order[i]] * strides[i];
+    }
+    return offset;
+}
+
+SizeVector unravel(size_t index, const SizeVector& dims) {
+    SizeVector coords(dims.size());
+    for (size_t i = dims.size(); i > 0; --i) {
+        coords[i - 1] = index % dims[i - 1];
+        index /= dims[i - 1];
+    }
+    return coords;
+}
+
+template <typename InT, typename OutT>
+void checkLayoutConversion(const MemoryBlob::Ptr& in, const MemoryBlob::Ptr& out) {
+    const auto& inDesc = in->getTensorDesc();
+    const auto& outDesc = out->getTensorDesc();
+    ASSERT_EQ(inDesc.getDims(), outDesc.getDims());
+
+    const auto inMem = in->rmap();
+    const auto outMem = out->rmap();
+    const auto inPtr = inMem.as<const InT*>();
+    const auto outPtr = outMem.as<const OutT*>();
+
+    for (size_t i = 0; i < in->size(); ++i) {
+        const auto coords = unravel(i, inDesc.getDims());
+        const auto expected = static_cast<float>(inPtr[getOffset(inDesc, coords)]);
+        const auto actual = static_cast<float>(outPtr[getOffset(outDesc, coords)]);
+        ASSERT_EQ(expected, actual) << inDesc.getLayout() << " -> " << outDesc.getLayout() << " at index " << i;
+    }
+}
+
+template <typename T>
+void checkLayout(const Precision& precision, const SizeVector& dims, Layout inLayout, Layout outLayout) {
+    const auto in = makeFilledBlob<T>(TensorDesc(precision, dims, inLayout));
+    const auto out = toLayout(in, outLayout);
+    checkLayoutConversion<T, T>(in, out);
+}
+
+}  // namespace
+
+TEST(MLIR_BlobLayout, NCHWtoNHWC) {
+    // Sizes not divisible by the tile size to cover the tails
+    const SizeVector dims = {2, 37, 9, 11};
+
+    checkLayout<uint8_t>(Precision::U8, dims, Layout::NCHW, Layout::NHWC);
+    checkLayout<float16>(Precision::FP16, dims, Layout::NCHW, Layout::NHWC);
+    checkLayout<float>(Precision::FP32, dims, Layout::NCHW, Layout::NHWC);
+    checkLayout<int64_t>(Precision::I64, dims, Layout::NCHW, Layout::NHWC);
+}
+
+TEST(MLIR_BlobLayout, NHWCtoNCHW) {
+    const SizeVector dims = {2, 37, 9, 11};
+
+    checkLayout<uint8_t>(Precision::U8, dims, Layout::NHWC, Layout::NCHW);
+    checkLayout<float16>(Precision::FP16, dims, Layout::NHWC, Layout::NCHW);
+    checkLayout<float>(Precision::FP32, dims, Layout::NHWC, Layout::NCHW);
+}
+
+TEST(MLIR_BlobLayout, NCDHWtoNDHWC) {
+    const SizeVector dims = {1, 3, 5, 17, 33};
+
+    checkLayout<float>(Precision::FP32, dims, Layout::NCDHW, Layout::NDHWC);
+    checkLayout<float>(Precision::FP32, dims, Layout::NDHWC, Layout::NCDHW);
+}
+
+TEST(MLIR_BlobLayout, CHWtoHWC) {
+    const SizeVector dims = {3, 64, 65};
+
+    checkLayout<uint8_t>(Precision::U8, dims, Layout::CHW, Layout::HWC);
+    checkLayout<uint8_t>(Precision::U8, dims, Layout::HWC, Layout::CHW);
+}
+
+TEST(MLIR_BlobLayout, FusedPrecisionAndLayout) {
+    const SizeVector dims = {2, 19, 33, 7};
+
+    const auto in = makeFilledBlob<float>(TensorDesc(Precision::FP32, dims, Layout::NCHW));
+    const auto out = toPrecisionAndLayout(in, Precision::FP16, Layout::NHWC);
+    EXPECT_EQ(Precision::FP16, out->getTensorDesc().getPrecision());
+    EXPECT_EQ(Layout::NHWC, out->getTensorDesc().getLayout());
+    checkLayoutConversion<float, float16>(in, out);
+
+    const auto back = toPrecisionAndLayout(out, Precision::FP32, Layout::NCHW);
+    checkLayoutConversion<float16, float>(out, back);
+}
+
+TEST(MLIR_BlobLayout, FusedMatchesSeparateSteps) {
+    const SizeVector dims = {1, 3, 40, 50};
+    const QuantizationParam quantParams(0.5f, 10);
+
+    const auto checkSame = [](const MemoryBlob::Ptr& fused, const MemoryBlob::Ptr& separate) {
+        ASSERT_EQ(separate->byteSize(), fused->byteSize());
+
+        const auto fusedMem = fused->rmap();
+        const auto separateMem = separate->rmap();
+        const auto fusedPtr = fusedMem.as<const uint8_t*>();
+        const auto separatePtr = separateMem.as<const uint8_t*>();
+        for (size_t i = 0; i < fused->byteSize(); ++i) {
+            ASSERT_EQ(separatePtr[i], fusedPtr[i]) << "byte " << i;
+        }
+    };
+
+    const auto in = makeBlob(TensorDesc(Precision::FP32, dims, Layout::NCHW));
+    {
+        // Fractional values, which need rounding in FP16
+        const auto mem = in->wmap();
+        const auto ptr = mem.as<float*>();
+        for (size_t i = 0; i < in->size(); ++i) {
+            ptr[i] = static_cast<float>(i % 1021) * 0.37f + 0.013f;
+        }
+    }
+
+    // The fused path converts short tile rows, the rounding must not depend on the row length
+    checkSame(toPrecisionAndLayout(in, Precision::U8, Layout::NHWC, quantParams),
+              toLayout(toPrecision(in, Precision::U8, quantParams), Layout::NHWC));
+    checkSame(toPrecisionAndLayout(in, Precision::FP16, Layout::NHWC),
+              toLayout(toPrecision(in, Precision::FP16), Layout::NHWC));
+}
+
+//
+// Performance comparison with the separate conversions
+//
+
+// TODO create separate target for performance tests
+TEST(MLIR_BlobLayoutPerf, DISABLED_FP32NCHWtoFP16NHWC) {
+    constexpr int NUM_ITERS = 5;
+
+    const auto in = makeFilledBlob<float>(TensorDesc(Precision::FP32, {1, 3, 1080, 1920}, Layout::NCHW));
+    const auto dst = makeBlob(TensorDesc(Precision::FP16, in->getTensorDesc().getDims(), Layout::NHWC));
+
+    const auto measureMs = [&](const std::function<void()>& func) {
+        const auto start = std::chrono::steady_clock::now();
+        for (int iter = 0; iter < NUM_ITERS; ++iter) {
+            func();
+        }
+        const auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::milli>(end - start).count() / NUM_ITERS;
+    };
+
+    const auto separateMs = measureMs([&]() {
+        toLayout(toPrecision(in, Precision::FP16), Layout::NHWC);
+    });
+    const auto fusedMs = measureMs([&]() {
+        toPrecisionAndLayout(in, Precision::FP16, Layout::NHWC);
+    });
+    // The way the zero backend fills the user output blob
+    const auto fusedInPlaceMs = measureMs([&]() {
+        const auto mem = dst->wmap();
+        toPrecisionAndLayout(in, Precision::FP16, Layout::NHWC, vpux::None, nullptr, mem.as<void*>());
+    });
+
+    std::cout << "FP32 NCHW -> FP16 NHWC: separate " << separateMs << " ms, fused " << fusedMs
+              << " ms, fused into the destination " << fusedInPlaceMs << " ms" << std::endl;
+}
@@ -0,0 +1,346 @@
+//
+// Copyright (C) 2022 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+//
+
+#include "vpux/utils/IE/cvt_kernels.hpp"
+#include "vpux/utils/IE/float16.hpp"
+#include "vpux/utils/core/checked_cast.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <ios>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <utility>
+#include <vector>
+
+using namespace vpux;
+using InferenceEngine::Precision;
+
+namespace {
+
+// Odd size to cover the tails of the kernels
+constexpr size_t TEST_SIZE = 1037;
+
+template <typename T>
+std::vector<T> genValues(size_t size, float low, float high) {
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> dist(low, high);
+
+    std::vector<T> vals(size);
+    for (auto& val : vals) {
+        val = static_cast<T>(dist(gen));
+    }
+    return vals;
+}
+
+template <typename T>
+uint64_t toBits(T val) {
+    uint64_t bits = 0;
+    std::memcpy(&bits, &val, sizeof(T));
+    return bits;
+}
+
+template <typename T>
+T fromBits(uint64_t bits) {
+    T val;
+    std::memcpy(&val, &bits, sizeof(T));
+    return val;
+}
+
+// Scalar reference, the same as the generic conversion of cvtBlobPrecision
+template <typename InT, typename OutT>
+OutT refConvert(InT val, const QuantizationParam* quantParams) {
+    if (quantParams == nullptr) {
+        return checked_cast<OutT>(val);
+    }
+
+    const float minU8 = static_cast<float>(std::numeric_limits<uint8_t>::lowest());
+    const float maxU8 = static_cast<float>(std::numeric_limits<uint8_t>::max());
+    const float zeroPoint = static_cast<float>(quantParams->_zeroPoint);
+    const float quant = zeroPoint + quantParams->_reverseScale * static_cast<float>(val) + 0.5f;
+    return static_cast<OutT>(quant < minU8 ? minU8 : (quant > maxU8 ? maxU8 : quant));
+}
+
+// `maxBitsDiff` allows the last mantissa bit to differ for the rounding conversions
+template <typename InT, typename OutT>
+void checkKernel(CvtKernelIsa isa, Precision inPrecision, Precision outPrecision, const std::vector<InT>& in,
+                 const QuantizationParam* quantParams = nullptr, uint64_t maxBitsDiff = 0) {
+    const auto kernel = getCvtKernel(inPrecision, outPrecision, quantParams != nullptr, isa);
+    if (kernel == nullptr) {
+        return;
+    }
+
+    std::vector<OutT> out(in.size());
+    kernel(in.data(), out.data(), static_cast<int64_t>(in.size()), quantParams);
+
+    for (size_t i = 0; i < in.size(); ++i) {
+        const auto refBits = toBits(refConvert<InT, OutT>(in[i], quantParams));
+        const auto outBits = toBits(out[i]);
+        const auto diff = refBits > outBits ? refBits - outBits : outBits - refBits;
+        ASSERT_LE(diff, maxBitsDiff) << inPrecision << " -> " << outPrecision << " with "
+                                     << stringifyEnum(isa).data() << " at index " << i;
+    }
+}
+
+// Places the values at every offset within the vector width, so each of them is converted by the main loop
+// and by the tail, and compares the results with the expected bit patterns
+template <typename InT, typename OutT>
+void checkKernelBits(CvtKernelIsa isa, Precision inPrecision, Precision outPrecision,
+                     const std::vector<std::pair<uint64_t, uint64_t>>& inOutBits,
+                     const QuantizationParam* quantParams = nullptr) {
+    const auto kernel = getCvtKernel(inPrecision, outPrecision, quantParams != nullptr, isa);
+    if (kernel == nullptr) {
+        return;
+    }
+
+    constexpr size_t MAX_VECTOR_WIDTH = 16;
+
+    for (size_t offset = 0; offset < 2 * MAX_VECTOR_WIDTH; ++offset) {
+        std::vector<InT> in(offset + inOutBits.size(), fromBits<InT>(0));
+        for (size_t i = 0; i < inOutBits.size(); ++i) {
+            in[offset + i] = fromBits<InT>(inOutBits[i].first);
+        }
+
+        std::vector<OutT> out(in.size());
+        kernel(in.data(), out.data(), static_cast<int64_t>(in.size()), quantParams);
+
+        for (size_t i = 0; i < inOutBits.size(); ++i) {
+            ASSERT_EQ(toBits(out[offset + i]), inOutBits[i].second)
+                    << inPrecision << " -> " << outPrecision << " with " << stringifyEnum(isa).data() << " for 0x"
+                    << std::hex << inOutBits[i].first << " at offset " << std::dec << offset;
+        }
+    }
+}
+
+// The results must not depend on how the range is split between the threads
+template <typename InT, typename OutT>
+void checkKernelSplit(CvtKernelIsa isa, Precision inPrecision, Precision outPrecision, const std::vector<InT>& in,
+                      const QuantizationParam* quantParams = nullptr) {
+    const auto kernel = getCvtKernel(inPrecision, outPrecision, quantParams != nullptr, isa);
+    if (kernel == nullptr) {
+        return;
+    }
+
+    std::vector<OutT> whole(in.size());
+    kernel(in.data(), whole.data(), static_cast<int64_t>(in.size()), quantParams);
+
+    std::vector<OutT> split(in.size());
+    for (size_t start = 0, chunk = 1; start < in.size(); start += chunk, chunk = chunk * 2 + 1) {
+        const auto count = std::min(chunk, in.size() - start);
+        kernel(in.data() + start, split.data() + start, static_cast<int64_t>(count), quantParams);
+    }
+
+    for (size_t i = 0; i < in.size(); ++i) {
+        ASSERT_EQ(toBits(whole[i]), toBits(split[i]))
+                << inPrecision << " -> " << outPrecision << " with " << stringifyEnum(isa).data() << " at index " << i;
+    }
+}
+
+}  // namespace
+
+class MLIR_CvtKernels : public testing::TestWithParam<CvtKernelIsa> {
+protected:
+    void SetUp() override {
+        if (GetParam() > getHostCvtKernelIsa()) {
+            GTEST_SKIP() << stringifyEnum(GetParam()).data() << " is not supported by the host";
+        }
+    }
+};
+
+TEST_P(MLIR_CvtKernels, FP32toFP16) {
+    checkKernel<float, float16>(GetParam(), Precision::FP32, Precision::FP16, genValues<float>(TEST_SIZE, -300, 300),
+                                nullptr, 1);
+}
+
+TEST_P(MLIR_CvtKernels, FP16toFP32) {
+    checkKernel<float16, float>(GetParam(), Precision::FP16, Precision::FP32, genValues<float16>(TEST_SIZE, -300, 300));
+}
+
+TEST_P(MLIR_CvtKernels, FP32toBF16) {
+    checkKernel<float, bfloat16>(GetParam(), Precision::FP32, Precision::BF16, genValues<float>(TEST_SIZE, -300, 300),
+                                 nullptr, 1);
+}
+
+TEST_P(MLIR_CvtKernels, BF16toFP32) {
+    checkKernel<bfloat16, float>(GetParam(), Precision::BF16, Precision::FP32,
+                                 genValues<bfloat16>(TEST_SIZE, -300, 300));
+}
+
+TEST_P(MLIR_CvtKernels, U8toFP32) {
+    checkKernel<uint8_t, float>(GetParam(), Precision::U8, Precision::FP32, genValues<uint8_t>(TEST_SIZE, 0, 255));
+}
+
+TEST_P(MLIR_CvtKernels, U8toFP16) {
+    checkKernel<uint8_t, float16>(GetParam(), Precision::U8, Precision::FP16, genValues<uint8_t>(TEST_SIZE, 0, 255));
+}
+
+TEST_P(MLIR_CvtKernels, FP32toU8WithQuantization) {
+    const QuantizationParam quantParams(0.37f, 13);
+    checkKernel<float, uint8_t>(GetParam(), Precision::FP32, Precision::U8, genValues<float>(TEST_SIZE, -300, 900),
+                                &quantParams);
+}
+
+TEST_P(MLIR_CvtKernels, I64toI32) {
+    checkKernel<int64_t, int32_t>(GetParam(), Precision::I64, Precision::I32,
+                                  genValues<int64_t>(TEST_SIZE, -1e9f, 1e9f));
+}
+
+TEST_P(MLIR_CvtKernels, FP32toFP16SpecialValues) {
+    checkKernelBits<float, float16>(GetParam(), Precision::FP32, Precision::FP16,
+                                    {
+                                            {0x7FC00000, 0x7E00},  // NaN
+                                            {0x7F800001, 0x7E00},  // signaling NaN is quieted
+                                            {0x7F800000, 0x7C00},  // +Inf
+                                            {0xFF800000, 0xFC00},  // -Inf
+                                            {0x477FE000, 0x7BFF},  // 65504, the maximum
+                                            {0x477FEFFF, 0x7BFF},  // rounded down to the maximum
+                                            {0x477FF000, 0x7C00},  // 65520, overflows to +Inf
+                                            {0xC9742400, 0xFC00},  // -1e6, overflows to -Inf
+                                            {0x00000001, 0x0000},  // FP32 denormal
+                                            {0x80000001, 0x8000},  // negative FP32 denormal
+                                            {0x33800000, 0x0001},  // the smallest FP16 denormal
+                                            {0x33000000, 0x0000},  // tie, rounded to even
+                                            {0x33C00000, 0x0002},  // tie, rounded to even
+                                            {0x387FC000, 0x03FF},  // the largest FP16 denormal
+                                    });
+}
+
+TEST_P(MLIR_CvtKernels, FP16toFP32SpecialValues) {
+    checkKernelBits<float16, float>(GetParam(), Precision::FP16, Precision::FP32,
+                                    {
+                                            {0x7E00, 0x7FC00000},  // NaN
+                                            {0x7C00, 0x7F800000},  // +Inf
+                                            {0xFC00, 0xFF800000},  // -Inf
+                                            {0x7BFF, 0x477FE000},  // 65504
+                                            {0x0001, 0x33800000},  // the smallest denormal
+                                            {0x03FF, 0x387FC000},  // the largest denormal
+                                            {0x8000, 0x80000000},  // -0
+                                    });
+}
+
+TEST_P(MLIR_CvtKernels, FP32toBF16SpecialValues) {
+    checkKernelBits<float, bfloat16>(GetParam(), Precision::FP32, Precision::BF16,
+                                     {
+                                             {0x7FC00000, 0x7FC0},  // NaN
+                                             {0x7F800001, 0x7FC0},  // signaling NaN is quieted
+                                             {0x7F800000, 0x7F80},  // +Inf
+                                             {0xFF800000, 0xFF80},  // -Inf
+                                             {0x7F7FFFFF, 0x7F80},  // FP32 maximum overflows to +Inf
+                                             {0x477FE000, 0x4780},  // 65504
+                                             {0x3F808000, 0x3F80},  // tie, rounded to even
+                                             {0x3F818000, 0x3F82},  // tie, rounded to even
+                                             {0x00000001, 0x0000},  // denormal
+                                             {0x80000001, 0x8000},  // negative denormal
+                                     });
+}
+
+TEST_P(MLIR_CvtKernels, FP32toU8WithQuantizationSpecialValues) {
+    const QuantizationParam quantParams(0.5f, 10);
+    checkKernelBits<float, uint8_t>(GetParam(), Precision::FP32, Precision::U8,
+                                    {
+                                            {0x7FC00000, 255},  // NaN is saturated to the maximum
+                                            {0x7F800000, 255},  // +Inf
+                                            {0xFF800000, 0},    // -Inf
+                                            {0x49742400, 255},  // 1e6
+                                            {0xC9742400, 0},    // -1e6
+                                            {0x00000001, 10},   // denormal
+                                            {0x40400000, 12},   // 3.0
+                                    },
+                                    &quantParams);
+}
+
+TEST_P(MLIR_CvtKernels, SplitIndependent) {
+    const QuantizationParam quantParams(0.37f, 13);
+    const auto in = genValues<float>(TEST_SIZE, -70000, 70000);
+
+    checkKernelSplit<float, float16>(GetParam(), Precision::FP32, Precision::FP16, in);
+    checkKernelSplit<float, bfloat16>(GetParam(), Precision::FP32, Precision::BF16, in);
+    checkKernelSplit<float, uint8_t>(GetParam(), Precision::FP32, Precision::U8, in, &quantParams);
+}
+
+TEST_P(MLIR_CvtKernels, I64toI32OutOfRange) {
+    const auto kernel = getCvtKernel(Precision::I64, Precision::I32, false, GetParam());
+    if (kernel == nullptr) {
+        return;
+    }
+
+    auto in = genValues<int64_t>(TEST_SIZE, -1e9f, 1e9f);
+    in[TEST_SIZE / 2] = std::numeric_limits<int64_t>::max();
+    std::vector<int32_t> out(in.size());
+    EXPECT_ANY_THROW(kernel(in.data(), out.data(), static_cast<int64_t>(in.size()), nullptr));
+}
+
+TEST_P(MLIR_CvtKernels, NoKernelForScalar) {
+    if (GetParam() != CvtKernelIsa::Scalar) {
+        return;
+    }
+    EXPECT_EQ(nullptr, getCvtKernel(Precision::FP32, Precision::FP16, false, CvtKernelIsa::Scalar));
+}
+
+INSTANTIATE_TEST_SUITE_P(Isa, MLIR_CvtKernels,
+                         testing::Values(CvtKernelIsa::Scalar, CvtKernelIsa::SSE42, CvtKernelIsa::AVX2,
+                                         CvtKernelIsa::AVX512));
+
+//
+// Performance comparison with the scalar conversion
+//
+
+namespace {
+
+template <typename InT, typename OutT>
+void compareWithScalar(Precision inPrecision, Precision outPrecision, const QuantizationParam* quantParams = nullptr) {
+    constexpr size_t SIZE = 10 * 1000 * 1000;
+    constexpr int NUM_ITERS = 5;
+
+    const auto in = genValues<InT>(SIZE, 0, 255);
+    std::vector<OutT> out(SIZE);
+
+    const auto measureMs = [&](CvtKernel kernel) {
+        const auto start = std::chrono::steady_clock::now();
+        for (int iter = 0; iter < NUM_ITERS; ++iter) {
+            if (kernel != nullptr) {
+                kernel(in.data(), out.data(), static_cast<int64_t>(SIZE), quantParams);
+            } else {
+                for (size_t i = 0; i < SIZE; ++i) {
+                    out[i] = refConvert<InT, OutT>(in[i], quantParams);
+                }
+            }
+        }
+        const auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::milli>(end - start).count() / NUM_ITERS;
+    };
+
+    std::cout << inPrecision << " -> " << outPrecision << ": Scalar " << measureMs(nullptr) << " ms";
+    for (const auto isa : {CvtKernelIsa::SSE42, CvtKernelIsa::AVX2, CvtKernelIsa::AVX512}) {
+        const auto kernel = getCvtKernel(inPrecision, outPrecision, quantParams != nullptr, isa);
+        if (isa <= getHostCvtKernelIsa() && kernel != nullptr) {
+            std::cout << ", " << stringifyEnum(isa).data() << " " << measureMs(kernel) << " ms";
+        }
+    }
+    std::cout << std::endl;
+}
+
+}  // namespace
+
+// TODO create separate target for performance tests
+TEST(MLIR_CvtKernelsPerf, DISABLED_Matrix) {
+    const QuantizationParam quantParams(0.5f, 10);
+
+    compareWithScalar<float, float16>(Precision::FP32, Precision::FP16);
+    compareWithScalar<float16, float>(Precision::FP16, Precision::FP32);
+    compareWithScalar<float, bfloat16>(Precision::FP32, Precision::BF16);
+    compareWithScalar<bfloat16, float>(Precision::BF16, Precision::FP32);
+    compareWithScalar<uint8_t, float>(Precision::U8, Precision::FP32);
+    compareWithScalar<uint8_t, float16>(Precision::U8, Precision::FP16);
+    compareWithScalar<float, uint8_t>(Precision::FP32, Precision::U8, &quantParams);
+    compareWithScalar<int64_t, int32_t>(Precision::I64, Precision::I32);
+}
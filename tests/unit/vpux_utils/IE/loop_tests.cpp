@@ -0,0 +1,161 @@
+//
+// Copyright (C) 2022 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+//
+
+#include "vpux/utils/IE/loop.hpp"
+#include "vpux/utils/IE/float16.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+using namespace vpux;
+
+namespace {
+
+std::vector<int> countVisits(LoopExecPolicy policy, int64_t size, int64_t grain, std::atomic<int64_t>& numCalls) {
+    std::vector<int> visits(size, 0);
+    loop_1d_chunked(policy, size, grain, [&](int64_t begin, int64_t end) {
+        EXPECT_LE(0, begin);
+        EXPECT_LT(begin, end);
+        EXPECT_LE(end, size);
+        ++numCalls;
+        for (int64_t i = begin; i < end; ++i) {
+            ++visits[i];
+        }
+    });
+    return visits;
+}
+
+}  // namespace
+
+TEST(MLIR_LoopChunked, CoversRangeOnce) {
+    for (const auto policy : {LoopExecPolicy::Sequential, LoopExecPolicy::Parallel}) {
+        for (const int64_t size : {1, 7, 4096, 100003}) {
+            std::atomic<int64_t> numCalls(0);
+            const auto visits = countVisits(policy, size, 16, numCalls);
+
+            for (int64_t i = 0; i < size; ++i) {
+                ASSERT_EQ(1, visits[i]) << "policy " << stringifyEnum(policy).data() << ", size " << size
+                                        << ", index " << i;
+            }
+        }
+    }
+}
+
+TEST(MLIR_LoopChunked, SingleChunk) {
+    std::atomic<int64_t> numCalls(0);
+    countVisits(LoopExecPolicy::Sequential, 100000, 16, numCalls);
+    EXPECT_EQ(1, numCalls.load()) << "Sequential policy must process the whole range at once";
+
+    numCalls = 0;
+    countVisits(LoopExecPolicy::Parallel, 100, 1000, numCalls);
+    EXPECT_EQ(1, numCalls.load()) << "Range smaller than the grain must not be split";
+}
+
+TEST(MLIR_LoopChunked, EmptyRange) {
+    bool called = false;
+    loop_1d_chunked(LoopExecPolicy::Parallel, 0, [&](int64_t, int64_t) {
+        called = true;
+    });
+    EXPECT_FALSE(called);
+}
+
+TEST(MLIR_LoopChunked, WrongGrain) {
+    EXPECT_ANY_THROW(loop_1d_chunked(LoopExecPolicy::Parallel, 10, 0, [](int64_t, int64_t) {}));
+}
+
+//
+// Performance comparison with the per-element loop_1d
+//
+
+namespace {
+
+template <typename InT, typename OutT>
+void convertPerElement(const std::vector<InT>& in, std::vector<OutT>& out) {
+    const auto* inPtr = in.data();
+    auto* outPtr = out.data();
+    loop_1d(LoopExecPolicy::Parallel, static_cast<int64_t>(in.size()), [inPtr, outPtr](int64_t i) {
+        outPtr[i] = static_cast<OutT>(static_cast<float>(inPtr[i]));
+    });
+}
+
+template <typename InT, typename OutT>
+void convertChunked(const std::vector<InT>& in, std::vector<OutT>& out) {
+    const auto* inPtr = in.data();
+    auto* outPtr = out.data();
+    loop_1d_chunked(LoopExecPolicy::Parallel, static_cast<int64_t>(in.size()),
+                    [inPtr, outPtr](int64_t begin, int64_t end) {
+                        for (int64_t i = begin; i < end; ++i) {
+                            outPtr[i] = static_cast<OutT>(static_cast<float>(inPtr[i]));
+                        }
+                    });
+}
+
+template <typename Func>
+double measureMs(Func&& func) {
+    constexpr int NUM_ITERS = 5;
+
+    func();  // warm up
+
+    const auto start = std::chrono::steady_clock::now();
+    for (int iter = 0; iter < NUM_ITERS; ++iter) {
+        func();
+    }
+    const auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::milli>(end - start).count() / NUM_ITERS;
+}
+
+template <typename InT, typename OutT>
+void compareLoops(const char* name, size_t size) {
+    std::vector<InT> in(size);
+    for (size_t i = 0; i < size; ++i) {
+        in[i] = static_cast<InT>(static_cast<float>(i % 251));
+    }
+    std::vector<OutT> perElementOut(size);
+    std::vector<OutT> chunkedOut(size);
+
+    const auto perElementMs = measureMs([&]() {
+        convertPerElement(in, perElementOut);
+    });
+    const auto chunkedMs = measureMs([&]() {
+        convertChunked(in, chunkedOut);
+    });
+
+    for (size_t i = 0; i < size; ++i) {
+        ASSERT_EQ(static_cast<float>(perElementOut[i]), static_cast<float>(chunkedOut[i])) << "index " << i;
+    }
+
+    std::cout << name << " x " << size << ": loop_1d " << perElementMs << " ms, loop_1d_chunked " << chunkedMs
+              << " ms" << std::endl;
+}
+
+}  // namespace
+
+class MLIR_LoopChunkedPerf : public testing::TestWithParam<size_t> {};
+
+// TODO create separate target for performance tests
+TEST_P(MLIR_LoopChunkedPerf, DISABLED_FP32toFP16) {
+    compareLoops<float, float16>("FP32 -> FP16", GetParam());
+}
+
+TEST_P(MLIR_LoopChunkedPerf, DISABLED_FP16toFP32) {
+    compareLoops<float16, float>("FP16 -> FP32", GetParam());
+}
+
+TEST_P(MLIR_LoopChunkedPerf, DISABLED_U8toFP32) {
+    compareLoops<uint8_t, float>("U8 -> FP32", GetParam());
+}
+
+TEST_P(MLIR_LoopChunkedPerf, DISABLED_FP32toU8) {
+    compareLoops<float, uint8_t>("FP32 -> U8", GetParam());
+}
+
+INSTANTIATE_TEST_SUITE_P(Sizes, MLIR_LoopChunkedPerf, testing::Values(1000000, 10000000, 100000000));